@@ -43,6 +43,9 @@ struct CmdOptions {
         SoundProfile,
         ExtensionUri,
         PageNumber,
+        BatchWorkerCount,
+        BatchJobTimeout,
+        BatchReportPath,
     };
 
     muse::IApplication::RunMode runMode = muse::IApplication::RunMode::GuiApp;
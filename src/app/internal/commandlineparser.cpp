@@ -90,6 +90,13 @@ void CommandLineParser::init()
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
     m_parser.addOption(QCommandLineOption("extension", "Use extension to process a conversion job", "uri"));
+    m_parser.addOption(QCommandLineOption("batch-workers",
+                                          "Use with '-j <file>', run the jobs in the given number of worker processes", "count"));
+    m_parser.addOption(QCommandLineOption("batch-job-timeout",
+                                          "Use with '-j <file>' and '--batch-workers', stop a job that runs longer than the given time",
+                                          "seconds"));
+    m_parser.addOption(QCommandLineOption("batch-report", "Use with '-j <file>', write a JSON summary of the jobs to the given file",
+                                          "file"));
 
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -332,6 +339,18 @@ void CommandLineParser::parse(int argc, char** argv)
         m_options.runMode = IApplication::RunMode::ConsoleApp;
         m_options.converterTask.type = ConvertType::Batch;
         m_options.converterTask.inputFile = fromUserInputPath(m_parser.value("j"));
+
+        if (m_parser.isSet("batch-workers")) {
+            m_options.converterTask.params[CmdOptions::ParamKey::BatchWorkerCount] = m_parser.value("batch-workers").toInt();
+        }
+
+        if (m_parser.isSet("batch-job-timeout")) {
+            m_options.converterTask.params[CmdOptions::ParamKey::BatchJobTimeout] = m_parser.value("batch-job-timeout").toInt();
+        }
+
+        if (m_parser.isSet("batch-report")) {
+            m_options.converterTask.params[CmdOptions::ParamKey::BatchReportPath] = fromUserInputPath(m_parser.value("batch-report"));
+        }
     }
 
     if (m_parser.isSet("score-media")) {
@@ -303,9 +303,13 @@ int ConsoleApp::processConverter(const CmdOptions::ConverterTask& task)
     openParams.unrollRepeats = task.params[CmdOptions::ParamKey::UnrollRepeats].toBool();
 
     switch (task.type) {
-    case ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, openParams, soundProfile, extensionUri);
-        break;
+    case ConvertType::Batch: {
+        converter::IConverterController::BatchParams batchParams;
+        batchParams.workerCount = std::max(task.params[CmdOptions::ParamKey::BatchWorkerCount].toInt(), 1);
+        batchParams.jobTimeoutSec = task.params[CmdOptions::ParamKey::BatchJobTimeout].toInt();
+        batchParams.reportPath = task.params[CmdOptions::ParamKey::BatchReportPath].toString();
+        ret = converter()->batchConvert(task.inputFile, openParams, soundProfile, extensionUri, nullptr, batchParams);
+    } break;
     case ConvertType::File: {
         std::string transposeOptionsJson = task.params[CmdOptions::ParamKey::ScoreTransposeOptions].toString().toStdString();
         std::optional<size_t> pageNum = parsePageNum(task.params);
@@ -34,6 +34,8 @@ enum class Err {
 
     ConvertFailed = 1303,
     TransposeFailed = 1304,
+    BatchJobTimeout = 1305,
+    BatchJobCrashed = 1306,
 
     ConvertTypeUnknown = 1310,
     InvalidTransposeOptions = 1311,
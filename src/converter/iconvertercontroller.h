@@ -42,6 +42,14 @@ public:
         bool unrollRepeats = false;
     };
 
+    struct BatchParams {
+        BatchParams() {}
+
+        size_t workerCount = 1;         // more than one - every job runs in its own process
+        int jobTimeoutSec = 0;          // used with worker processes, 0 - no timeout
+        muse::io::path_t reportPath;    // JSON summary of the batch, if set
+    };
+
     virtual muse::Ret fileConvert(const muse::io::path_t& in, const muse::io::path_t& out, const OpenParams& openParams = {},
                                   const muse::String& soundProfile = muse::String(),
                                   const muse::UriQuery& extensionUri = muse::UriQuery(), const std::string& transposeOptionsJson = {},
@@ -49,7 +57,8 @@ public:
 
     virtual muse::Ret batchConvert(const muse::io::path_t& batchJobFile, const OpenParams& openParams = {},
                                    const muse::String& soundProfile = muse::String(),
-                                   const muse::UriQuery& extensionUri = muse::UriQuery(), muse::ProgressPtr progress = nullptr) = 0;
+                                   const muse::UriQuery& extensionUri = muse::UriQuery(), muse::ProgressPtr progress = nullptr,
+                                   const BatchParams& batchParams = {}) = 0;
 
     virtual muse::Ret convertScoreParts(const muse::io::path_t& in, const muse::io::path_t& out, const OpenParams& openParams = {}) = 0;
 
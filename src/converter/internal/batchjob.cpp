@@ -0,0 +1,263 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "batchjob.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QJsonParseError>
+
+#include "global/io/dir.h"
+#include "types/string.h"
+
+#include "engraving/infrastructure/mscio.h"
+
+#include "convertercodes.h"
+#include "converterutils.h"
+
+using namespace mu::converter;
+using namespace mu::notation;
+using namespace muse;
+
+RetVal<BatchJob::Jobs> BatchJob::parse(const QByteArray& data)
+{
+    RetVal<Jobs> rv;
+
+    QJsonParseError err;
+    const QJsonDocument doc = QJsonDocument::fromJson(data, &err);
+    if (err.error != QJsonParseError::NoError || !doc.isArray()) {
+        rv.ret = make_ret(Err::BatchJobFileFailedParse, err.errorString().toStdString());
+        return rv;
+    }
+
+    const QJsonArray arr = doc.array();
+
+    auto correctUserInputPath = [](const QString& path) -> QString {
+        return io::Dir::fromNativeSeparators(path).toQString();
+    };
+
+    for (const auto obj : arr) {
+        Job job;
+        job.in = correctUserInputPath(obj[u"in"].toString());
+
+        QJsonObject transposeOptionsObj = obj[u"transpose"].toObject();
+        if (!transposeOptionsObj.isEmpty()) {
+            RetVal<TransposeOptions> transposeOptions = ConverterUtils::parseTransposeOptions(transposeOptionsObj);
+            if (!transposeOptions.ret) {
+                rv.ret = transposeOptions.ret;
+                return rv;
+            }
+            job.transposeOptions = transposeOptions.val;
+            job.transposeOptionsJson = QJsonDocument(transposeOptionsObj).toJson(QJsonDocument::Compact).toStdString();
+        }
+
+        QJsonValue pageVal = obj[u"page"];
+        if (!pageVal.isUndefined()) {
+            job.pageNum = pageVal.toInt() - 1;
+        }
+
+        //! NOTE All outputs of a job share one load and layout of the score
+        const QJsonValue outValue = obj[u"out"];
+        if (outValue.isString()) {
+            job.outs.push_back(correctUserInputPath(outValue.toString()));
+        } else if (outValue.isArray()) {
+            const QJsonArray outArray = outValue.toArray();
+            for (const auto outItem : outArray) {
+                muse::io::path_t out;
+                if (outItem.isString()) {
+                    out = correctUserInputPath(outItem.toString());
+                } else if (outItem.isArray() && outItem.toArray().size() == 2) {
+                    const QJsonArray partOutArray = outItem.toArray();
+                    const QString prefix = correctUserInputPath(partOutArray[0].toString());
+                    const QString suffix = partOutArray[1].toString();
+                    out = prefix + "*" + suffix; // Use "*" as a placeholder for part names
+                }
+                job.outs.push_back(out);
+            }
+        }
+
+        if (!job.outs.empty()) {
+            rv.val.push_back(std::move(job));
+        }
+    }
+
+    rv.ret = make_ret(Ret::Code::Ok);
+    return rv;
+}
+
+bool BatchJob::isPartsOutput(const muse::io::path_t& out)
+{
+    return io::completeBasename(out).toStdString().find('*') != std::string::npos;
+}
+
+bool BatchJob::isScoreOutput(const muse::io::path_t& out)
+{
+    const std::string suffix = io::suffix(out);
+    return suffix == engraving::MSCZ || suffix == engraving::MSCX || suffix == engraving::MSCS;
+}
+
+BatchJob::Outputs BatchJob::sortOutputs(const std::vector<muse::io::path_t>& outs)
+{
+    Outputs outputs;
+    for (const muse::io::path_t& out : outs) {
+        if (isPartsOutput(out)) {
+            outputs.parts.push_back(out);
+        } else if (isScoreOutput(out)) {
+            outputs.scores.push_back(out);
+        } else {
+            outputs.exports.push_back(out);
+        }
+    }
+
+    return outputs;
+}
+
+QByteArray BatchJob::workerJobData(const Job& job)
+{
+    QJsonObject jobObj;
+    jobObj["in"] = job.in.toQString();
+
+    QJsonArray outsArr;
+    for (const muse::io::path_t& out : job.outs) {
+        outsArr << out.toQString();
+    }
+    jobObj["out"] = outsArr;
+
+    if (!job.transposeOptionsJson.empty()) {
+        jobObj["transpose"] = QJsonDocument::fromJson(QByteArray::fromStdString(job.transposeOptionsJson)).object();
+    }
+
+    if (job.pageNum.has_value()) {
+        jobObj["page"] = static_cast<int>(job.pageNum.value() + 1);
+    }
+
+    return QJsonDocument(QJsonArray { jobObj }).toJson(QJsonDocument::Compact);
+}
+
+QStringList BatchJob::workerArguments(const QStringList& appArguments, const QString& workerJobFilePath)
+{
+    static const QStringList OPTIONS_WITH_VALUE = {
+        "-j", "--job", "--batch-workers", "--batch-job-timeout", "--batch-report"
+    };
+
+    QStringList args = appArguments;
+    if (!args.isEmpty()) {
+        args.removeFirst(); // program
+    }
+
+    QStringList result;
+    for (qsizetype i = 0; i < args.size(); ++i) {
+        const QString& arg = args.at(i);
+        if (OPTIONS_WITH_VALUE.contains(arg)) {
+            ++i; // skip the value too
+            continue;
+        }
+
+        const QString name = arg.section('=', 0, 0);
+        if (arg.contains('=') && OPTIONS_WITH_VALUE.contains(name)) {
+            continue;
+        }
+
+        result << arg;
+    }
+
+    result << "-j" << workerJobFilePath;
+
+    return result;
+}
+
+Ret BatchJob::workerResult(const WorkerExit& exit)
+{
+    if (exit.timedOut) {
+        return make_ret(Err::BatchJobTimeout);
+    }
+
+    if (exit.failedToStart) {
+        return make_ret(Err::UnknownError, exit.errorString);
+    }
+
+    if (exit.crashed) {
+        return make_ret(Err::BatchJobCrashed);
+    }
+
+    if (exit.exitCode != 0) {
+        //! NOTE The exit code may be truncated by the system, so it is only reported as text
+        return make_ret(Err::ConvertFailed, "worker exit code: " + std::to_string(exit.exitCode));
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+Ret BatchJob::batchResult(const Jobs& jobs, const JobResults& results)
+{
+    StringList errors;
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Ret& ret = results.at(i).ret;
+        if (!ret) {
+            errors.emplace_back(String(u"failed convert, err: %1, in: %2")
+                                .arg(String::fromStdString(ret.toString())).arg(jobs.at(i).in.toString()));
+        }
+    }
+
+    if (!errors.empty()) {
+        return make_ret(Err::ConvertFailed, errors.join(u"\n").toStdString());
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+QByteArray BatchJob::report(const Jobs& jobs, const JobResults& results)
+{
+    QJsonArray jobsArr;
+    int failedCount = 0;
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Job& job = jobs.at(i);
+        const JobResult& result = results.at(i);
+
+        QJsonObject jobObj;
+        jobObj["in"] = job.in.toQString();
+        QJsonArray outsArr;
+        for (const muse::io::path_t& out : job.outs) {
+            outsArr << out.toQString();
+        }
+        jobObj["out"] = outsArr;
+        jobObj["ok"] = result.ret.success();
+        jobObj["durationMs"] = static_cast<qint64>(result.durationMs);
+
+        if (!result.ret) {
+            jobObj["errorCode"] = result.ret.code();
+            jobObj["error"] = QString::fromStdString(result.ret.toString());
+            ++failedCount;
+        }
+
+        jobsArr << jobObj;
+    }
+
+    QJsonObject reportObj;
+    reportObj["total"] = static_cast<int>(results.size());
+    reportObj["succeeded"] = static_cast<int>(results.size()) - failedCount;
+    reportObj["failed"] = failedCount;
+    reportObj["jobs"] = jobsArr;
+
+    return QJsonDocument(reportObj).toJson();
+}
@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <QByteArray>
+#include <QStringList>
+
+#include "io/path.h"
+#include "types/retval.h"
+
+#include "notation/notationtypes.h"
+
+namespace mu::converter {
+//! NOTE Parsing of batch job files and the bookkeeping of their results,
+//! shared by the in-process conversion and the worker processes
+class BatchJob
+{
+public:
+    struct Job {
+        muse::io::path_t in;
+        std::vector<muse::io::path_t> outs; // converted after a single load of `in`
+        std::optional<notation::TransposeOptions> transposeOptions;
+        std::string transposeOptionsJson; // passed as is to worker processes
+        std::optional<size_t> pageNum;
+    };
+
+    using Jobs = std::vector<Job>;
+
+    struct JobResult {
+        muse::Ret ret;
+        int64_t durationMs = 0;
+    };
+
+    using JobResults = std::vector<JobResult>;
+
+    //! NOTE The outputs of a job in the order they are converted
+    struct Outputs {
+        std::vector<muse::io::path_t> parts;    // before the extension is run, as when they were jobs of their own
+        std::vector<muse::io::path_t> exports;
+        std::vector<muse::io::path_t> scores;   // last, saving a score file changes the path of the project
+    };
+
+    //! NOTE How a worker process ended
+    struct WorkerExit {
+        bool failedToStart = false;
+        bool timedOut = false;
+        bool crashed = false;
+        int exitCode = 0;
+        std::string errorString;
+    };
+
+    static muse::RetVal<Jobs> parse(const QByteArray& data);
+
+    static bool isPartsOutput(const muse::io::path_t& out);
+    static bool isScoreOutput(const muse::io::path_t& out);
+    static Outputs sortOutputs(const std::vector<muse::io::path_t>& outs);
+
+    //! NOTE A worker converts a job file with the single job, so all outputs of the job still share one load
+    static QByteArray workerJobData(const Job& job);
+
+    //! NOTE Worker processes get the same options as this one, except for the job file and the batch options
+    static QStringList workerArguments(const QStringList& appArguments, const QString& workerJobFilePath);
+
+    static muse::Ret workerResult(const WorkerExit& exit);
+
+    static muse::Ret batchResult(const Jobs& jobs, const JobResults& results);
+    static QByteArray report(const Jobs& jobs, const JobResults& results);
+};
+}
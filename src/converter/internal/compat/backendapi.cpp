@@ -343,25 +343,26 @@ Ret BackendApi::exportScorePngs(const INotationPtr notation, BackendJsonWriter&
 
     const PageList& notationPages = notation->elements()->pages();
 
-    bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
-        ByteArray pngData;
-        Buffer pngDevice(&pngData);
-        pngDevice.open(IODevice::ReadWrite);
+    std::vector<ByteArray> pngDatas(notationPages.size());
 
-        INotationWriter::Options options = {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-            { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
-        };
+    INotationWriter::Options options = {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
+    };
 
-        Ret writeRet = pngWriter->write(notation, pngDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
-            result = false;
-        }
+    bool result = true;
+    Ret writeRet = pngWriter->writePages(notation, pngDatas.size(), [&pngDatas](size_t pageIndex) {
+        auto pngDevice = std::make_unique<Buffer>(&pngDatas[pageIndex]);
+        pngDevice->open(IODevice::ReadWrite);
+        return std::unique_ptr<IODevice>(std::move(pngDevice));
+    }, options);
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
+        result = false;
+    }
 
-        bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(pngData.toQByteArrayNoCopy().toBase64(), !lastArrayValue);
+    for (size_t i = 0; i < pngDatas.size(); ++i) {
+        bool lastArrayValue = ((pngDatas.size() - 1) == i);
+        jsonWriter.addValue(pngDatas[i].toQByteArrayNoCopy().toBase64(), !lastArrayValue);
     }
 
     jsonWriter.closeArray(addSeparator);
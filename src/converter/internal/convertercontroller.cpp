@@ -21,16 +21,23 @@
  */
 #include "convertercontroller.h"
 
-#include <QJsonDocument>
-#include <QJsonObject>
-#include <QJsonArray>
-#include <QJsonParseError>
+#include <QFile>
+#include <QElapsedTimer>
+#include <QCoreApplication>
+
+#include "muse_framework_config.h"
+
+#ifdef QT_QPROCESS_SUPPORTED
+#include <QProcess>
+#include <QTemporaryFile>
+#include <QDir>
+#endif
 
 #include "defer.h"
 #include "global/io/file.h"
 #include "global/io/dir.h"
 
-#include "engraving/infrastructure/mscio.h"
+#include "engraving/dom/masterscore.h"
 
 #include "convertercodes.h"
 #include "compat/backendapi.h"
@@ -51,7 +58,7 @@ static const std::string MP3_SUFFIX = "mp3";
 
 Ret ConverterController::batchConvert(const muse::io::path_t& batchJobFile, const OpenParams& openParams,
                                       const String& soundProfile, const muse::UriQuery& extensionUri,
-                                      muse::ProgressPtr progress)
+                                      muse::ProgressPtr progress, const BatchParams& batchParams)
 {
     TRACEFUNC;
 
@@ -59,44 +66,166 @@ Ret ConverterController::batchConvert(const muse::io::path_t& batchJobFile, cons
         progress->start();
     }
 
-    RetVal<BatchJob> batchJob = parseBatchJob(batchJobFile);
-    if (!batchJob.ret) {
-        LOGE() << "failed parse batch job file, err: " << batchJob.ret.toString();
+    RetVal<BatchJob::Jobs> jobs = parseBatchJob(batchJobFile);
+    if (!jobs.ret) {
+        LOGE() << "failed parse batch job file, err: " << jobs.ret.toString();
         if (progress) {
-            progress->finish(ProgressResult(batchJob.ret));
+            progress->finish(ProgressResult(jobs.ret));
         }
-        return batchJob.ret;
+        return jobs.ret;
     }
 
-    StringList errors;
+    bool useWorkers = batchParams.workerCount > 1;
+#ifndef QT_QPROCESS_SUPPORTED
+    if (useWorkers) {
+        LOGW() << "worker processes are not supported, converting in this process";
+        useWorkers = false;
+    }
+#endif
+
+    BatchJob::JobResults results;
+    if (useWorkers) {
+        results = convertJobsInWorkers(jobs.val, batchParams, progress);
+    } else {
+        results = convertJobsInProcess(jobs.val, openParams, soundProfile, extensionUri, progress);
+    }
+
+    if (!batchParams.reportPath.empty()) {
+        QByteArray report = BatchJob::report(jobs.val, results);
+        Ret reportRet = File::writeFile(batchParams.reportPath, ByteArray::fromQByteArrayNoCopy(report));
+        if (!reportRet) {
+            LOGE() << "failed write batch report, err: " << reportRet.toString() << ", path: " << batchParams.reportPath;
+        }
+    }
+
+    Ret ret = BatchJob::batchResult(jobs.val, results);
+
+    if (progress) {
+        progress->finish(ProgressResult(ret));
+    }
+
+    return ret;
+}
+
+BatchJob::JobResults ConverterController::convertJobsInProcess(const BatchJob::Jobs& jobs, const OpenParams& openParams,
+                                                               const String& soundProfile, const muse::UriQuery& extensionUri,
+                                                               muse::ProgressPtr progress)
+{
+    BatchJob::JobResults results;
+    results.reserve(jobs.size());
 
     int64_t current = 0;
-    int64_t total = batchJob.val.size();
-    for (const Job& job : batchJob.val) {
+    int64_t total = jobs.size();
+    for (const BatchJob::Job& job : jobs) {
         if (progress) {
             ++current;
             progress->progress(current, total, job.in.toStdString());
         }
 
-        Ret ret = fileConvert(job.in, job.out, openParams, soundProfile, extensionUri, job.transposeOptions, job.pageNum);
-        if (!ret) {
-            errors.emplace_back(String(u"failed convert, err: %1, in: %2, out: %3")
-                                .arg(String::fromStdString(ret.toString())).arg(job.in.toString()).arg(job.out.toString()));
-        }
-    }
+        QElapsedTimer timer;
+        timer.start();
 
-    Ret ret;
-    if (!errors.empty()) {
-        ret = make_ret(Err::ConvertFailed, errors.join(u"\n").toStdString());
-    } else {
-        ret = make_ret(Ret::Code::Ok);
+        BatchJob::JobResult result;
+        result.ret = fileConvert(job.in, job.outs, openParams, soundProfile, extensionUri, job.transposeOptions, job.pageNum);
+        result.durationMs = timer.elapsed();
+        results.push_back(result);
     }
 
-    if (progress) {
-        progress->finish(ProgressResult(ret));
+    return results;
+}
+
+BatchJob::JobResults ConverterController::convertJobsInWorkers(const BatchJob::Jobs& jobs, const BatchParams& batchParams,
+                                                               muse::ProgressPtr progress)
+{
+#ifdef QT_QPROCESS_SUPPORTED
+    struct Worker {
+        std::unique_ptr<QProcess> process;
+        std::unique_ptr<QTemporaryFile> jobFile;
+        size_t jobIdx = 0;
+        QElapsedTimer timer;
+    };
+
+    //! NOTE Every job runs in its own process, so a score that crashes or hangs
+    //! the converter only fails its own job. At most workerCount jobs run at once.
+    static constexpr int POLL_INTERVAL_MS = 20;
+
+    const QString program = QCoreApplication::applicationFilePath();
+    const QStringList appArgs = QCoreApplication::arguments();
+    const qint64 timeoutMs = static_cast<qint64>(batchParams.jobTimeoutSec) * 1000;
+
+    BatchJob::JobResults results(jobs.size());
+    std::vector<Worker> workers;
+    workers.reserve(batchParams.workerCount);
+
+    size_t nextJobIdx = 0;
+    int64_t finished = 0;
+    int64_t total = jobs.size();
+
+    while (nextJobIdx < jobs.size() || !workers.empty()) {
+        while (workers.size() < batchParams.workerCount && nextJobIdx < jobs.size()) {
+            const BatchJob::Job& job = jobs.at(nextJobIdx);
+
+            Worker worker;
+            worker.jobIdx = nextJobIdx++;
+            worker.timer.start();
+
+            worker.jobFile = std::make_unique<QTemporaryFile>(QDir::tempPath() + "/batchjob_XXXXXX.json");
+            if (!worker.jobFile->open() || worker.jobFile->write(BatchJob::workerJobData(job)) < 0) {
+                results.at(worker.jobIdx).ret = make_ret(Err::BatchJobFileFailedOpen, worker.jobFile->errorString().toStdString());
+                if (progress) {
+                    progress->progress(++finished, total, job.in.toStdString());
+                }
+                continue;
+            }
+            worker.jobFile->close();
+
+            worker.process = std::make_unique<QProcess>();
+            worker.process->setProcessChannelMode(QProcess::ForwardedChannels);
+            worker.process->start(program, BatchJob::workerArguments(appArgs, worker.jobFile->fileName()));
+
+            workers.push_back(std::move(worker));
+        }
+
+        for (auto it = workers.begin(); it != workers.end();) {
+            QProcess* process = it->process.get();
+
+            BatchJob::WorkerExit exit;
+            bool done = process->state() == QProcess::NotRunning || process->waitForFinished(POLL_INTERVAL_MS);
+            if (!done) {
+                if (timeoutMs <= 0 || it->timer.elapsed() < timeoutMs) {
+                    ++it;
+                    continue;
+                }
+
+                process->kill();
+                process->waitForFinished();
+                exit.timedOut = true;
+            } else {
+                exit.failedToStart = process->error() == QProcess::FailedToStart;
+                exit.crashed = process->exitStatus() == QProcess::CrashExit;
+                exit.exitCode = process->exitCode();
+                exit.errorString = process->errorString().toStdString();
+            }
+
+            BatchJob::JobResult& result = results.at(it->jobIdx);
+            result.ret = BatchJob::workerResult(exit);
+            result.durationMs = it->timer.elapsed();
+
+            if (progress) {
+                progress->progress(++finished, total, jobs.at(it->jobIdx).in.toStdString());
+            }
+
+            it = workers.erase(it);
+        }
     }
 
-    return ret;
+    return results;
+#else
+    UNUSED(batchParams);
+    UNUSED(progress);
+    NOT_SUPPORTED;
+    return BatchJob::JobResults(jobs.size(), BatchJob::JobResult { make_ret(Ret::Code::NotSupported), 0 });
+#endif
 }
 
 Ret ConverterController::fileConvert(const muse::io::path_t& in, const muse::io::path_t& out,
@@ -117,10 +246,10 @@ Ret ConverterController::fileConvert(const muse::io::path_t& in, const muse::io:
         transposeOptions = transposeOptionsRet.val;
     }
 
-    return fileConvert(in, out, openParams, soundProfile, extensionUri, transposeOptions, pageNum);
+    return fileConvert(in, std::vector<muse::io::path_t> { out }, openParams, soundProfile, extensionUri, transposeOptions, pageNum);
 }
 
-Ret ConverterController::fileConvert(const muse::io::path_t& in, const muse::io::path_t& out,
+Ret ConverterController::fileConvert(const muse::io::path_t& in, const std::vector<muse::io::path_t>& outs,
                                      const OpenParams& openParams,
                                      const String& soundProfile,
                                      const muse::UriQuery& extensionUri,
@@ -129,13 +258,13 @@ Ret ConverterController::fileConvert(const muse::io::path_t& in, const muse::io:
 {
     TRACEFUNC;
 
-    LOGI() << "in: " << in << ", out: " << out;
-
-    std::string suffix = io::suffix(out);
+    LOGI() << "in: " << in << ", outs: " << outs.size();
 
-    auto writer = writers()->writer(suffix);
-    if (!writer) {
-        return make_ret(Err::ConvertTypeUnknown);
+    for (const muse::io::path_t& out : outs) {
+        if (!writers()->writer(io::suffix(out))) {
+            LOGE() << "unknown convert type, out: " << out;
+            return make_ret(Err::ConvertTypeUnknown);
+        }
     }
 
     auto notationProject = notationCreator()->newProject(iocContext());
@@ -168,22 +297,78 @@ Ret ConverterController::fileConvert(const muse::io::path_t& in, const muse::io:
         globalContext()->setCurrentProject(nullptr);
     };
 
+    const BatchJob::Outputs outputs = BatchJob::sortOutputs(outs);
+
+    StringList errors;
+    auto convertOutputs = [&](const std::vector<muse::io::path_t>& outputPaths) {
+        for (const muse::io::path_t& out : outputPaths) {
+            ret = convertProject(notationProject, out, extensionUri.isValid(), pageNum);
+            if (!ret) {
+                errors.emplace_back(String(u"out: %1, err: %2").arg(out.toString()).arg(String::fromStdString(ret.toString())));
+            }
+        }
+    };
+
+    //! NOTE Parts are converted without the extension
+    convertOutputs(outputs.parts);
+
+    //! NOTE The extension can modify the notation (score), so it is done once for all other outputs
+    if (extensionUri.isValid() && (!outputs.exports.empty() || !outputs.scores.empty())) {
+        ret = extensionsProvider()->perform(extensionUri);
+        if (!ret) {
+            LOGE() << "Failed to perform extension, err: " << ret.toString();
+            return ret;
+        }
+    }
+
+    //! NOTE The pages recorded for one export are replayed by the others, until the last one is done
+    engraving::MasterScore* masterScore = notationProject->masterNotation()->masterScore();
+    masterScore->beginPaintJob();
+    convertOutputs(outputs.exports);
+    masterScore->endPaintJob();
+
+    convertOutputs(outputs.scores);
+
+    if (outs.size() == 1) {
+        return ret;
+    }
+
+    if (!errors.empty()) {
+        return make_ret(Err::ConvertFailed, errors.join(u"\n").toStdString());
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+Ret ConverterController::convertProject(INotationProjectPtr notationProject, const muse::io::path_t& out, bool byExtension,
+                                        const std::optional<size_t>& pageNum)
+{
+    LOGI() << "out: " << out;
+
+    std::string suffix = io::suffix(out);
+
+    auto writer = writers()->writer(suffix);
+    if (!writer) {
+        return make_ret(Err::ConvertTypeUnknown);
+    }
+
     // Check if this is a part conversion job
-    QString baseName = QString::fromStdString(io::completeBasename(out).toStdString());
-    if (baseName.contains('*')) {
+    if (BatchJob::isPartsOutput(out)) {
         return convertScoreParts(writer, notationProject->masterNotation(), out);
     }
 
+    Ret ret;
+
     // use a extension for convert
-    if (extensionUri.isValid()) {
-        ret = convertByExtension(writer, notationProject->masterNotation()->notation(), out, extensionUri);
+    if (byExtension) {
+        ret = convertByExtension(writer, notationProject->masterNotation()->notation(), out);
         if (!ret) {
             LOGE() << "Failed to convert by extension, err: " << ret.toString();
         }
     }
     // standart convert
     else {
-        if (suffix == engraving::MSCZ || suffix == engraving::MSCX || suffix == engraving::MSCS) {
+        if (BatchJob::isScoreOutput(out)) {
             if (pageNum.has_value()) {
                 return notationProject->savePage(out, pageNum.value());
             }
@@ -253,92 +438,29 @@ Ret ConverterController::convertScoreParts(INotationWriterPtr writer, IMasterNot
     return make_ret(Ret::Code::NotSupported);
 }
 
-RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(const muse::io::path_t& batchJobFile) const
+RetVal<BatchJob::Jobs> ConverterController::parseBatchJob(const muse::io::path_t& batchJobFile) const
 {
     TRACEFUNC;
 
-    RetVal<BatchJob> rv;
     QFile file(batchJobFile.toQString());
     if (!file.open(QIODevice::ReadOnly)) {
+        RetVal<BatchJob::Jobs> rv;
         rv.ret = make_ret(Err::BatchJobFileFailedOpen, file.errorString().toStdString());
         return rv;
     }
 
-    const QByteArray data = file.readAll();
-
-    QJsonParseError err;
-    const QJsonDocument doc = QJsonDocument::fromJson(data, &err);
-    if (err.error != QJsonParseError::NoError || !doc.isArray()) {
-        rv.ret = make_ret(Err::BatchJobFileFailedParse, err.errorString().toStdString());
-        return rv;
-    }
-
-    const QJsonArray arr = doc.array();
-
-    auto correctUserInputPath = [](const QString& path) -> QString {
-        return io::Dir::fromNativeSeparators(path).toQString();
-    };
-
-    for (const auto obj : arr) {
-        Job job;
-        job.in = correctUserInputPath(obj[u"in"].toString());
-
-        QJsonObject transposeOptionsObj = obj[u"transpose"].toObject();
-        if (!transposeOptionsObj.isEmpty()) {
-            RetVal<TransposeOptions> transposeOptions = ConverterUtils::parseTransposeOptions(transposeOptionsObj);
-            if (!transposeOptions.ret) {
-                rv.ret = transposeOptions.ret;
-                return rv;
-            }
-            job.transposeOptions = transposeOptions.val;
-        }
-
-        QJsonValue pageVal = obj[u"page"];
-        if (!pageVal.isUndefined()) {
-            job.pageNum = pageVal.toInt() - 1;
-        }
-
-        const QJsonValue outValue = obj[u"out"];
-        if (outValue.isString()) {
-            job.out = correctUserInputPath(outValue.toString());
-            rv.val.push_back(std::move(job));
-        } else if (outValue.isArray()) {
-            const QJsonArray outArray = outValue.toArray();
-            for (const auto outItem : outArray) {
-                Job partJob = job; // Copy the input path
-                if (outItem.isString()) {
-                    partJob.out = correctUserInputPath(outItem.toString());
-                } else if (outItem.isArray() && outItem.toArray().size() == 2) {
-                    const QJsonArray partOutArray = outItem.toArray();
-                    const QString prefix = correctUserInputPath(partOutArray[0].toString());
-                    const QString suffix = partOutArray[1].toString();
-                    partJob.out = prefix + "*" + suffix; // Use "*" as a placeholder for part names
-                }
-                rv.val.push_back(std::move(partJob));
-            }
-        }
-    }
-
-    rv.ret = make_ret(Ret::Code::Ok);
-    return rv;
+    return BatchJob::parse(file.readAll());
 }
 
-Ret ConverterController::convertByExtension(INotationWriterPtr writer, INotationPtr notation, const muse::io::path_t& out,
-                                            const muse::UriQuery& extensionUri)
+Ret ConverterController::convertByExtension(INotationWriterPtr writer, INotationPtr notation, const muse::io::path_t& out)
 {
-    //! NOTE First we do the extension, it can modify the notation (score)
-    Ret ret = extensionsProvider()->perform(extensionUri);
-    if (!ret) {
-        return ret;
-    }
-
     File file(out);
     if (!file.open(File::WriteOnly)) {
         return make_ret(Err::OutFileFailedOpen);
     }
 
     file.setMeta("file_path", out.toStdString());
-    ret = writer->write(notation, file);
+    Ret ret = writer->write(notation, file);
     if (!ret) {
         LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
         return make_ret(Err::OutFileFailedWrite);
@@ -363,15 +485,60 @@ Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotationP
 {
     TRACEFUNC;
 
-    for (size_t i = 0; i < notation->elements()->pages().size(); i++) {
-        const String filePath = muse::io::path_t(io::dirpath(out) + "/"
+    const size_t pageCount = notation->elements()->pages().size();
+
+    auto pageFilePath = [&out](size_t pageIndex) {
+        return muse::io::path_t(muse::io::path_t(io::dirpath(out) + "/"
                                                  + io::completeBasename(out) + "-%1."
-                                                 + io::suffix(out)).toString().arg(i + 1);
+                                                 + io::suffix(out)).toString().arg(pageIndex + 1));
+    };
 
-        Ret ret = convertPage(writer, notation, i, filePath, out);
-        if (!ret) {
-            return ret;
+    //! NOTE Don't leave the pages written so far when the conversion fails
+    auto removePages = [&pageFilePath](size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            const muse::io::path_t filePath = pageFilePath(i);
+            if (File::exists(filePath)) {
+                File::remove(filePath);
+            }
         }
+    };
+
+    //! NOTE Only the PNG writer prepares several pages at once, the other writers gain nothing from it
+    if (io::suffix(out) != PNG_SUFFIX) {
+        for (size_t i = 0; i < pageCount; i++) {
+            Ret ret = convertPage(writer, notation, i, pageFilePath(i), out);
+            if (!ret) {
+                removePages(ret.code() == static_cast<int>(Err::OutFileFailedOpen) ? i : i + 1);
+                return ret;
+            }
+        }
+
+        return make_ret(Ret::Code::Ok);
+    }
+
+    size_t openedPageCount = 0;
+    bool openFailed = false;
+
+    Ret ret = writer->writePages(notation, pageCount, [&](size_t pageIndex) -> std::unique_ptr<io::IODevice> {
+        const muse::io::path_t filePath = pageFilePath(pageIndex);
+
+        auto file = std::make_unique<File>(filePath);
+        if (!file->open(File::WriteOnly)) {
+            openFailed = true;
+            return nullptr;
+        }
+
+        ++openedPageCount; // the pages are written in order
+
+        file->setMeta("file_path", filePath.toStdString());
+        file->setMeta("dir_path", out.toStdString());
+
+        return file;
+    });
+
+    if (!ret) {
+        removePages(openedPageCount);
+        return make_ret(openFailed ? Err::OutFileFailedOpen : Err::OutFileFailedWrite);
     }
 
     return make_ret(Ret::Code::Ok);
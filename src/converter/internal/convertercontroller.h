@@ -34,6 +34,8 @@
 
 #include "types/retval.h"
 
+#include "batchjob.h"
+
 namespace mu::converter {
 class ConverterController : public IConverterController, public muse::Injectable
 {
@@ -54,7 +56,8 @@ public:
 
     muse::Ret batchConvert(const muse::io::path_t& batchJobFile, const OpenParams& openParams = {},
                            const muse::String& soundProfile = muse::String(),
-                           const muse::UriQuery& extensionUri = muse::UriQuery(), muse::ProgressPtr progress = nullptr) override;
+                           const muse::UriQuery& extensionUri = muse::UriQuery(), muse::ProgressPtr progress = nullptr,
+                           const BatchParams& batchParams = {}) override;
 
     muse::Ret convertScoreParts(const muse::io::path_t& in, const muse::io::path_t& out, const OpenParams& openParams = {}) override;
 
@@ -75,26 +78,23 @@ public:
 
 private:
 
-    struct Job {
-        muse::io::path_t in;
-        muse::io::path_t out;
-        std::optional<notation::TransposeOptions> transposeOptions;
-        std::optional<size_t> pageNum;
-    };
-
-    using BatchJob = std::vector<Job>;
+    muse::RetVal<BatchJob::Jobs> parseBatchJob(const muse::io::path_t& batchJobFile) const;
 
-    muse::RetVal<BatchJob> parseBatchJob(const muse::io::path_t& batchJobFile) const;
+    BatchJob::JobResults convertJobsInProcess(const BatchJob::Jobs& jobs, const OpenParams& openParams, const muse::String& soundProfile,
+                                              const muse::UriQuery& extensionUri, muse::ProgressPtr progress);
+    BatchJob::JobResults convertJobsInWorkers(const BatchJob::Jobs& jobs, const BatchParams& batchParams, muse::ProgressPtr progress);
 
-    muse::Ret fileConvert(const muse::io::path_t& in, const muse::io::path_t& out, const OpenParams& openParams = {},
+    muse::Ret fileConvert(const muse::io::path_t& in, const std::vector<muse::io::path_t>& outs, const OpenParams& openParams = {},
                           const muse::String& soundProfile = muse::String(),
                           const muse::UriQuery& extensionUri = muse::UriQuery(), const std::optional<notation::TransposeOptions>& transposeOptions = std::nullopt, const std::optional<size_t>& pageNum = std::nullopt);
 
+    muse::Ret convertProject(project::INotationProjectPtr notationProject, const muse::io::path_t& out, bool byExtension,
+                             const std::optional<size_t>& pageNum);
+
     muse::Ret convertScoreParts(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation,
                                 const muse::io::path_t& out);
 
-    muse::Ret convertByExtension(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out,
-                                 const muse::UriQuery& extensionUri);
+    muse::Ret convertByExtension(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out);
     bool isConvertPageByPage(const std::string& suffix) const;
     muse::Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out) const;
     muse::Ret convertPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const size_t pageNum,
@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+
+#include "converter/internal/batchjob.h"
+#include "converter/convertercodes.h"
+
+using namespace mu::converter;
+using namespace muse;
+
+class Converter_BatchJobTests : public ::testing::Test
+{
+};
+
+TEST_F(Converter_BatchJobTests, ParseJobs)
+{
+    // [GIVEN] Job file with a single output, several outputs with parts, and an entry without outputs
+    const QByteArray data = R"([
+        { "in": "a.mscz", "out": "a.pdf" },
+        { "in": "b.mscz", "out": [ "b.pdf", [ "b-", ".pdf" ], "b.mscz" ], "page": 2 },
+        { "in": "c.mscz" }
+    ])";
+
+    // [WHEN] Parse the job file
+    RetVal<BatchJob::Jobs> jobs = BatchJob::parse(data);
+
+    // [THEN] Every entry with outputs is one job, the outputs of an entry are not split into several jobs
+    ASSERT_TRUE(jobs.ret);
+    ASSERT_EQ(jobs.val.size(), 2);
+
+    EXPECT_EQ(jobs.val.at(0).in, "a.mscz");
+    EXPECT_EQ(jobs.val.at(0).outs, std::vector<io::path_t>({ "a.pdf" }));
+    EXPECT_FALSE(jobs.val.at(0).pageNum.has_value());
+
+    EXPECT_EQ(jobs.val.at(1).in, "b.mscz");
+    EXPECT_EQ(jobs.val.at(1).outs, std::vector<io::path_t>({ "b.pdf", "b-*.pdf", "b.mscz" }));
+    EXPECT_EQ(jobs.val.at(1).pageNum.value_or(0), 1);
+}
+
+TEST_F(Converter_BatchJobTests, ParseBrokenFile)
+{
+    // [WHEN] Parse a job file that is not an array of jobs
+    RetVal<BatchJob::Jobs> jobs = BatchJob::parse(R"({ "in": "a.mscz", "out": "a.pdf" })");
+
+    // [THEN] Parsing fails
+    EXPECT_EQ(jobs.ret.code(), static_cast<int>(Err::BatchJobFileFailedParse));
+    EXPECT_TRUE(jobs.val.empty());
+}
+
+TEST_F(Converter_BatchJobTests, SortOutputs)
+{
+    // [GIVEN] Outputs of a job in the order of the job file
+    const std::vector<io::path_t> outs = { "b.mscz", "b.pdf", "parts/b-*.pdf", "b.png", "b.mscx", "b-*.mp3" };
+
+    // [WHEN] Sort the outputs
+    BatchJob::Outputs outputs = BatchJob::sortOutputs(outs);
+
+    // [THEN] Parts go before the extension is run, score files go last, the job file order is kept otherwise
+    EXPECT_EQ(outputs.parts, std::vector<io::path_t>({ "parts/b-*.pdf", "b-*.mp3" }));
+    EXPECT_EQ(outputs.exports, std::vector<io::path_t>({ "b.pdf", "b.png" }));
+    EXPECT_EQ(outputs.scores, std::vector<io::path_t>({ "b.mscz", "b.mscx" }));
+}
+
+TEST_F(Converter_BatchJobTests, WorkerJobFile)
+{
+    // [GIVEN] Job with several outputs
+    BatchJob::Job job;
+    job.in = "b.mscz";
+    job.outs = { "b.pdf", "b-*.pdf", "b.png" };
+    job.pageNum = 3;
+
+    // [WHEN] Write the job file of a worker and parse it back
+    RetVal<BatchJob::Jobs> jobs = BatchJob::parse(BatchJob::workerJobData(job));
+
+    // [THEN] The worker gets exactly this job, with all of its outputs
+    ASSERT_TRUE(jobs.ret);
+    ASSERT_EQ(jobs.val.size(), 1);
+    EXPECT_EQ(jobs.val.front().in, job.in);
+    EXPECT_EQ(jobs.val.front().outs, job.outs);
+    EXPECT_EQ(jobs.val.front().pageNum.value_or(0), 3);
+}
+
+TEST_F(Converter_BatchJobTests, WorkerArguments)
+{
+    // [GIVEN] Command line of a batch conversion with workers
+    const QStringList appArgs = {
+        "mscore", "-j", "jobs.json", "--batch-workers", "4", "--batch-report=report.json", "-r", "300", "--batch-job-timeout", "60"
+    };
+
+    // [WHEN] Make the command line of a worker
+    QStringList args = BatchJob::workerArguments(appArgs, "worker.json");
+
+    // [THEN] The export options are kept, the job file and the batch options are replaced
+    EXPECT_EQ(args, QStringList({ "-r", "300", "-j", "worker.json" }));
+}
+
+TEST_F(Converter_BatchJobTests, WorkerResults)
+{
+    // [GIVEN] Worker that finished successfully
+    BatchJob::WorkerExit exit;
+    EXPECT_TRUE(BatchJob::workerResult(exit));
+
+    // [GIVEN] Worker that failed to convert
+    exit.exitCode = 1320;
+    Ret ret = BatchJob::workerResult(exit);
+    EXPECT_EQ(ret.code(), static_cast<int>(Err::ConvertFailed));
+    EXPECT_NE(ret.text().find("1320"), std::string::npos);
+
+    // [GIVEN] Worker that crashed
+    exit.crashed = true;
+    EXPECT_EQ(BatchJob::workerResult(exit).code(), static_cast<int>(Err::BatchJobCrashed));
+
+    // [GIVEN] Worker that was killed after the timeout
+    exit.timedOut = true;
+    EXPECT_EQ(BatchJob::workerResult(exit).code(), static_cast<int>(Err::BatchJobTimeout));
+
+    // [GIVEN] Worker that couldn't be started
+    BatchJob::WorkerExit notStarted;
+    notStarted.failedToStart = true;
+    notStarted.errorString = "no such program";
+    ret = BatchJob::workerResult(notStarted);
+    EXPECT_EQ(ret.code(), static_cast<int>(Err::UnknownError));
+    EXPECT_EQ(ret.text(), "no such program");
+}
+
+TEST_F(Converter_BatchJobTests, CollectResults)
+{
+    // [GIVEN] Batch where one of three jobs failed
+    BatchJob::Jobs jobs(3);
+    jobs.at(0).in = "a.mscz";
+    jobs.at(0).outs = { "a.pdf" };
+    jobs.at(1).in = "b.mscz";
+    jobs.at(1).outs = { "b.pdf", "b.png" };
+    jobs.at(2).in = "c.mscz";
+    jobs.at(2).outs = { "c.pdf" };
+
+    BatchJob::JobResults results(3);
+    results.at(0).ret = make_ret(Ret::Code::Ok);
+    results.at(1).ret = make_ret(Err::BatchJobCrashed);
+    results.at(2).ret = make_ret(Ret::Code::Ok);
+
+    // [WHEN] Collect the results
+    Ret ret = BatchJob::batchResult(jobs, results);
+
+    // [THEN] The batch fails and names the failed job only
+    EXPECT_EQ(ret.code(), static_cast<int>(Err::ConvertFailed));
+    EXPECT_NE(ret.text().find("b.mscz"), std::string::npos);
+    EXPECT_EQ(ret.text().find("a.mscz"), std::string::npos);
+    EXPECT_EQ(ret.text().find("c.mscz"), std::string::npos);
+
+    // [WHEN] Write the report
+    QJsonObject report = QJsonDocument::fromJson(BatchJob::report(jobs, results)).object();
+
+    // [THEN] The report has every job with its result
+    EXPECT_EQ(report["total"].toInt(), 3);
+    EXPECT_EQ(report["succeeded"].toInt(), 2);
+    EXPECT_EQ(report["failed"].toInt(), 1);
+
+    const QJsonArray reportJobs = report["jobs"].toArray();
+    ASSERT_EQ(reportJobs.size(), 3);
+    EXPECT_TRUE(reportJobs.at(0).toObject()["ok"].toBool());
+    EXPECT_FALSE(reportJobs.at(1).toObject()["ok"].toBool());
+    EXPECT_EQ(reportJobs.at(1).toObject()["errorCode"].toInt(), static_cast<int>(Err::BatchJobCrashed));
+    EXPECT_EQ(reportJobs.at(1).toObject()["out"].toArray().size(), 2);
+
+    // [GIVEN] All jobs succeeded
+    results.at(1).ret = make_ret(Ret::Code::Ok);
+
+    // [THEN] The batch succeeds
+    EXPECT_TRUE(BatchJob::batchResult(jobs, results));
+}
@@ -1729,6 +1729,12 @@ void EngravingItem::drawSymbols(const SymIdList& symbols, Painter* p, const Poin
     score()->engravingFont()->draw(symbols, p, SizeF(magS() * scale), o);
 }
 
+void EngravingItem::drawSymbols(const SymIdList& symbols, Painter* p, const std::vector<PointF>& positions, double scale) const
+{
+    const double mag = magS() * scale;
+    score()->engravingFont()->draw(symbols, p, SizeF(mag, mag), positions);
+}
+
 //---------------------------------------------------------
 //   symHeight
 //---------------------------------------------------------
@@ -22,6 +22,8 @@
 
 #include "page.h"
 
+#include <atomic>
+
 #ifndef ENGRAVING_NO_ACCESSIBILITY
 #include "accessibility/accessibleitem.h"
 #endif
@@ -52,6 +54,19 @@ Page::Page(RootItem* parent)
     : EngravingItem(ElementType::PAGE, parent, ElementFlag::NOT_SELECTABLE), m_no(0)
 {
     m_bspTreeValid = false;
+    touchContent();
+}
+
+//---------------------------------------------------------
+//   touchContent
+//---------------------------------------------------------
+
+void Page::touchContent()
+{
+    //! NOTE Stamps are unique across the pages, so a new page never reuses the stamp of a deleted one.
+    //! Pages aren't only created on the main thread, hence the atomic
+    static std::atomic<uint64_t> lastContentStamp = 0;
+    m_contentStamp = ++lastContentStamp;
 }
 
 //---------------------------------------------------------
@@ -22,8 +22,11 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
+#include "draw/types/drawdata.h"
+
 #include "engravingitem.h"
 #include "bsp.h"
 #include "text.h"
@@ -75,7 +78,29 @@ public:
 
     std::vector<EngravingItem*> items(const RectF& r);
     std::vector<EngravingItem*> items(const PointF& p);
-    void invalidateBspTree() { m_bspTreeValid = false; }
+    void invalidateBspTree() { m_bspTreeValid = false; touchContent(); }
+
+    //! NOTE Changes whenever the content of the page may have changed,
+    //! so that views can tell which of their cached drawing is stale
+    uint64_t contentStamp() const { return m_contentStamp; }
+    void touchContent();
+
+    //! NOTE Drawing of the page items, recorded when the page is painted for print
+    //! and replayed on the next paints of the same paint job (see Score::beginPaintJob)
+    struct DisplayList {
+        struct Entry {
+            muse::draw::DrawDataPtr data;           // recorded run of items
+            const EngravingItem* item = nullptr;    // item that is painted live
+        };
+
+        std::vector<Entry> entries;
+        double pixelRatio = 0.0;
+        bool invertColors = false;
+    };
+
+    const std::shared_ptr<DisplayList>& displayList() const { return m_displayList; }
+    void setDisplayList(const std::shared_ptr<DisplayList>& list) { m_displayList = list; }
+    void invalidateDisplayList() { m_displayList.reset(); }
     PointF pagePos() const override { return PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
     RectF tbbox() const;                             // tight bounding box, excluding white space
@@ -103,5 +128,8 @@ private:
 
     BspTree bspTree;
     bool m_bspTreeValid = false;
+    uint64_t m_contentStamp = 0;
+
+    std::shared_ptr<DisplayList> m_displayList;
 };
 }
@@ -141,8 +141,6 @@ const std::vector<const Measure*>& RepeatSegment::measureList() const
 RepeatList::RepeatList(Score* s)
 {
     m_score = s;
-    m_idx1  = 0;
-    m_idx2  = 0;
 }
 
 //---------------------------------------------------------
@@ -228,10 +226,11 @@ int RepeatList::utick2tick(int tick) const
     if (tick < 0) {
         return 0;
     }
-    unsigned ii = (m_idx1 < n) && (tick >= at(m_idx1)->utick) ? m_idx1 : 0;
+    const unsigned idx = m_idx1.load(std::memory_order_relaxed);
+    unsigned ii = (idx < n) && (tick >= at(idx)->utick) ? idx : 0;
     for (unsigned i = ii; i < n; ++i) {
         if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
-            m_idx1 = i;
+            m_idx1.store(i, std::memory_order_relaxed);
             return tick - (at(i)->utick - at(i)->tick);
         }
     }
@@ -264,7 +263,8 @@ int RepeatList::tick2utick(int tick) const
 double RepeatList::utick2utime(int tick) const
 {
     size_t n = size();
-    unsigned ii = (m_idx1 < n) && (tick >= at(m_idx1)->utick) ? m_idx1 : 0;
+    const unsigned idx = m_idx1.load(std::memory_order_relaxed);
+    unsigned ii = (idx < n) && (tick >= at(idx)->utick) ? idx : 0;
     for (unsigned i = ii; i < n; ++i) {
         if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
             int t     = tick - (at(i)->utick - at(i)->tick);
@@ -282,10 +282,11 @@ double RepeatList::utick2utime(int tick) const
 int RepeatList::utime2utick(double secs) const
 {
     size_t repeatSegmentsCount = size();
-    unsigned ii = (m_idx2 < repeatSegmentsCount) && (secs >= at(m_idx2)->utime) ? m_idx2 : 0;
+    const unsigned idx = m_idx2.load(std::memory_order_relaxed);
+    unsigned ii = (idx < repeatSegmentsCount) && (secs >= at(idx)->utime) ? idx : 0;
     for (unsigned i = ii; i < repeatSegmentsCount; ++i) {
         if ((secs >= at(i)->utime) && ((i + 1 == repeatSegmentsCount) || (secs < at(i + 1)->utime))) {
-            m_idx2 = i;
+            m_idx2.store(i, std::memory_order_relaxed);
             return m_score->tempomap()->time2tick(secs - at(i)->timeOffset) + (at(i)->utick - at(i)->tick);
         }
     }
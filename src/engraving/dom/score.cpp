@@ -5844,6 +5844,29 @@ void Score::rebuildBspTree()
     }
 }
 
+void Score::invalidateDisplayLists()
+{
+    for (Page* page : pages()) {
+        page->invalidateDisplayList();
+    }
+}
+
+void Score::beginPaintJob()
+{
+    ++m_paintJobCount;
+}
+
+void Score::endPaintJob()
+{
+    IF_ASSERT_FAILED(m_paintJobCount > 0) {
+        return;
+    }
+
+    if (--m_paintJobCount == 0) {
+        invalidateDisplayLists();
+    }
+}
+
 //---------------------------------------------------------
 //   scanElements
 //    scan all elements
@@ -5996,8 +6019,11 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
         end = std::max(et, spanner->tick2());
     }
 
+    invalidateDisplayLists();
+
     m_engravingFont = engravingFonts()->fontByName(style().value(Sid::musicalSymbolFont).value<String>().toStdString());
     m_layoutOptions.noteHeadWidth = m_engravingFont->width(SymId::noteheadBlack, style().spatium() / SPATIUM20);
+    m_layoutOptions.isParallelLayout = configuration()->parallelLayoutEnabled();
 
     if (this->cmdState().layoutFlags & LayoutFlag::REBUILD_MIDI_MAPPING) {
         if (this->isMaster()) {
@@ -6007,6 +6033,9 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
 
     renderer()->layoutScore(this, start, end);
 
+    //! NOTE The hints describe the layout of the file as it was saved, later layouts must find the breaks themselves
+    m_layoutOptions.systemBreakHints.clear();
+
     if (m_resetAutoplace) {
         m_resetAutoplace = false;
         resetAutoplace();
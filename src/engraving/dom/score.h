@@ -44,6 +44,7 @@
 
 #include "../rendering/iscorerenderer.h"
 #include "../rendering/layoutoptions.h"
+#include "../rendering/layoutstatistics.h"
 #include "../rendering/paddingtable.h"
 
 #include "../style/style.h"
@@ -366,6 +367,12 @@ public:
     muse::async::Channel<float> layoutProgressChannel() const;
 
     void rebuildBspTree();
+    void invalidateDisplayLists();
+
+    //! NOTE The recorded drawing of the pages is kept while a paint job is open,
+    //! e.g. an export to several formats, and dropped when the last one ends
+    void beginPaintJob();
+    void endPaintJob();
     bool noStaves() const { return m_staves.empty(); }
     void insertPart(Part*, size_t targetPartIdx);
     void appendPart(Part*);
@@ -924,6 +931,10 @@ public:
     void setShowVBox(bool v) { m_layoutOptions.isShowVBox = v; }
     double noteHeadWidth() const { return m_layoutOptions.noteHeadWidth; }
     void setNoteHeadWidth(double n) { m_layoutOptions.noteHeadWidth = n; }
+    void setSystemBreakHints(const std::map<int, int>& hints) { m_layoutOptions.systemBreakHints = hints; }
+
+    const LayoutStatistics& layoutStatistics() const { return m_layoutStatistics; }
+    void setLayoutStatistics(const LayoutStatistics& s) { m_layoutStatistics = s; }
 
     // temporary methods
     bool isLayoutMode(LayoutMode lm) const { return m_layoutOptions.isMode(lm); }
@@ -1212,6 +1223,7 @@ private:
     bool m_markIrregularMeasures = true;
     bool m_showInstrumentNames = true;
     bool m_printing = false;                // True if we are drawing to a printer
+    int m_paintJobCount = 0;
     bool m_savedCapture = false;            // True if we saved an image capture
     bool m_corrupted = false;
 
@@ -1234,6 +1246,7 @@ private:
 
     RootItem* m_rootItem = nullptr;
     LayoutOptions m_layoutOptions;
+    LayoutStatistics m_layoutStatistics;
 
     muse::async::Channel<EngravingItem*> m_elementDestroyed;
 
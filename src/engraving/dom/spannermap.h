@@ -44,8 +44,8 @@ public:
 
     SpannerMap();
 
-    const IntervalList& findContained(int start, int stop, bool excludeCollisions = false) const;
-    const IntervalList& findOverlapping(int start, int stop, bool excludeCollisions = false) const;
+    IntervalList findContained(int start, int stop, bool excludeCollisions = false) const;
+    IntervalList findOverlapping(int start, int stop, bool excludeCollisions = false) const;
     const std::multimap<int, Spanner*>& map() const { return *this; }
 
     void collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const;
@@ -59,6 +59,7 @@ public:
     void clear() { std::multimap<int, Spanner*>::clear(); m_dirty = true; }
     bool empty() const { return std::multimap<int, Spanner*>::empty(); }
     void update() const;
+    bool isDirty() const { return m_dirty; }
     void setDirty() const { m_dirty = true; }     // must be called if a spanner changes start/length
 #ifndef NDEBUG
     void dump() const;
@@ -69,7 +70,6 @@ private:
     mutable bool m_dirty = false;
     mutable interval_tree::IntervalTree<Spanner*> m_tree;
     mutable interval_tree::IntervalTree<Spanner*> m_collisionFreeTree;
-    mutable std::vector<interval_tree::Interval<Spanner*> > m_results;
 };
 } // namespace mu::engraving
 
@@ -463,6 +463,11 @@ void CmdState::dump()
 
 void Score::update(bool resetCmdState, bool layoutAllParts)
 {
+    //! NOTE Anything may have been changed, so the recorded drawing of the pages is stale
+    for (Score* s : masterScore()->scoreList()) {
+        s->invalidateDisplayLists();
+    }
+
     if (m_updatesLocked) {
         return;
     }
@@ -475,6 +480,15 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
         CmdState& cs = ms->cmdState();
         ms->deletePostponed();
 
+        //! NOTE Layout touches the pages it collects, anything else that asks for a redraw may touch any page
+        if (!cs.layoutRange() && (cs.updateAll() || cs.updateRange())) {
+            for (Score* s : ms->scoreList()) {
+                for (Page* page : s->pages()) {
+                    page->touchContent();
+                }
+            }
+        }
+
         if (cs.layoutRange()) {
             for (Score* s : ms->scoreList()) {
                 if (s != this && !s->isOpen() && ms->scoreList().size() > 1 && !layoutAllParts) {
@@ -135,6 +135,18 @@ public:
     virtual bool doNotSaveEIDsForBackCompat() const = 0;
     virtual void setDoNotSaveEIDsForBackCompat(bool doNotSave) = 0;
 
+    virtual bool parallelLayoutEnabled() const = 0;
+    virtual void setParallelLayoutEnabled(bool enabled) = 0;
+
+    virtual bool parallelReadingEnabled() const = 0;
+    virtual void setParallelReadingEnabled(bool enabled) = 0;
+
+    virtual bool layoutCacheEnabled() const = 0;
+    virtual void setLayoutCacheEnabled(bool enabled) = 0;
+
+    virtual bool parallelPlaybackLoadingEnabled() const = 0;
+    virtual void setParallelPlaybackLoadingEnabled(bool enabled) = 0;
+
     /// these configurations will be removed after solving https://github.com/musescore/MuseScore/issues/14294
     virtual bool guitarProImportExperimental() const = 0;
     virtual bool shouldAddParenthesisOnStandardStaff() const = 0;
@@ -56,6 +56,7 @@ public:
     virtual void draw(SymId id, muse::draw::Painter* p, const SizeF& mag, const PointF& pos, const double angle = 0) const = 0;
     virtual void draw(const SymIdList& ids, muse::draw::Painter* p, double mag, const PointF& pos, const double angle = 0) const = 0;
     virtual void draw(const SymIdList& ids, muse::draw::Painter* p, const SizeF& mag, const PointF& pos, const double angle = 0) const = 0;
+    virtual void draw(const SymIdList& ids, muse::draw::Painter* p, const SizeF& mag, const std::vector<PointF>& positions) const = 0;
 };
 
 using IEngravingFontPtr = std::shared_ptr<IEngravingFont>;
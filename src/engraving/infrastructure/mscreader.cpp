@@ -21,6 +21,8 @@
  */
 #include "mscreader.h"
 
+#include <chrono>
+
 #include "io/file.h"
 #include "io/fileinfo.h"
 #include "io/dir.h"
@@ -69,6 +71,7 @@ const MscReader::Params& MscReader::params() const
 
 Ret MscReader::open()
 {
+    m_readStatistics = ReadStatistics();
     return reader()->open(m_params.device, m_params.filePath);
 }
 
@@ -92,6 +95,11 @@ bool MscReader::isContainer() const
     return m_reader ? m_reader->isContainer() : false;
 }
 
+const MscReader::ReadStatistics& MscReader::readStatistics() const
+{
+    return m_readStatistics;
+}
+
 MscReader::IReader* MscReader::reader() const
 {
     if (!m_reader) {
@@ -121,7 +129,15 @@ bool MscReader::fileExists(const String& fileName) const
 
 ByteArray MscReader::fileData(const String& fileName) const
 {
-    return reader()->fileData(fileName);
+    auto start = std::chrono::steady_clock::now();
+
+    ByteArray data = reader()->fileData(fileName);
+
+    m_readStatistics.filesRead++;
+    m_readStatistics.bytesRead += data.size();
+    m_readStatistics.readTimeMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    return data;
 }
 
 ByteArray MscReader::readStyleFile() const
@@ -155,18 +171,19 @@ ByteArray MscReader::readScoreFile() const
 {
     String mscxFileName = mainFileName();
     ByteArray data = fileData(mscxFileName);
-    if (data.empty() && reader()->isContainer()) {
-        StringList files = reader()->fileList();
-        for (const String& name : files) {
-            // mscx file in the root dir
-            if (!name.contains(u'/') && name.endsWith(u".mscx", muse::CaseInsensitive)) {
-                mscxFileName = name;
-                break;
-            }
+    if (!data.empty() || !reader()->isContainer()) {
+        return data;
+    }
+
+    StringList files = reader()->fileList();
+    for (const String& name : files) {
+        // mscx file in the root dir
+        if (!name.contains(u'/') && name.endsWith(u".mscx", muse::CaseInsensitive)) {
+            return fileData(name);
         }
     }
 
-    return fileData(mscxFileName);
+    return data;
 }
 
 std::vector<String> MscReader::excerptFileNames() const
@@ -238,6 +255,14 @@ ByteArray MscReader::readAudioFile() const
     return fileData(u"audio.ogg");
 }
 
+ByteArray MscReader::readLayoutCacheFile() const
+{
+    if (!fileExists(u"layoutcache.bin")) {
+        return ByteArray();
+    }
+    return fileData(u"layoutcache.bin");
+}
+
 ByteArray MscReader::readAudioSettingsJsonFile(const muse::io::path_t& pathPrefix) const
 {
     return fileData(pathPrefix.toString() + u"audiosettings.json");
@@ -44,6 +44,13 @@ public:
         MscIoMode mode = MscIoMode::Zip;
     };
 
+    struct ReadStatistics
+    {
+        size_t filesRead = 0;
+        size_t bytesRead = 0; // uncompressed
+        double readTimeMs = 0.0;
+    };
+
     MscReader() = default;
     MscReader(const Params& params);
     ~MscReader();
@@ -56,6 +63,8 @@ public:
     bool isOpened() const;
     bool isContainer() const;
 
+    const ReadStatistics& readStatistics() const;
+
     muse::ByteArray readStyleFile() const;
     muse::ByteArray readScoreFile() const;
 
@@ -70,6 +79,7 @@ public:
     muse::ByteArray readImageFile(const muse::String& fileName) const;
 
     muse::ByteArray readAudioFile() const;
+    muse::ByteArray readLayoutCacheFile() const;
     muse::ByteArray readAudioSettingsJsonFile(const muse::io::path_t& pathPrefix = "") const;
     muse::ByteArray readViewSettingsJsonFile(const muse::io::path_t& pathPrefix = "") const;
 
@@ -141,5 +151,6 @@ private:
 
     Params m_params;
     mutable IReader* m_reader = nullptr;
+    mutable ReadStatistics m_readStatistics;
 };
 }
@@ -193,6 +193,11 @@ void MscWriter::writeAudioFile(const ByteArray& data)
     addFileData(u"audio.ogg", data);
 }
 
+void MscWriter::writeLayoutCacheFile(const ByteArray& data)
+{
+    addFileData(u"layoutcache.bin", data);
+}
+
 void MscWriter::writeAudioSettingsJsonFile(const ByteArray& data, const muse::io::path_t& pathPrefix)
 {
     addFileData(pathPrefix.toString() + u"audiosettings.json", data);
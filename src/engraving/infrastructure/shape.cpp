@@ -21,6 +21,14 @@
  */
 #include <cfloat>
 
+#if defined(__SSE2__) || defined(_M_AMD64) || defined(_M_X64)
+#include <emmintrin.h>
+#define MU_ENGRAVING_SHAPE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define MU_ENGRAVING_SHAPE_NEON
+#endif
+
 #include "shape.h"
 
 #include "draw/painter.h"
@@ -41,6 +49,7 @@ Shape::Shape(const std::vector<RectF>& rects, const EngravingItem* p)
     for (const RectF& rect : rects) {
         m_elements.emplace_back(ShapeElement(rect, p));
     }
+    updatePacked();
 }
 
 //---------------------------------------------------------
@@ -71,6 +80,7 @@ Shape& Shape::translate(const PointF& pt)
         r.translate(pt);
     }
     invalidateBBox();
+    updatePacked();
     return *this;
 }
 
@@ -81,6 +91,7 @@ void Shape::translateX(double xo)
         r.setRight(r.right() + xo);
     }
     invalidateBBox();
+    updatePacked();
 }
 
 void Shape::translateY(double yo)
@@ -90,6 +101,7 @@ void Shape::translateY(double yo)
         r.setBottom(r.bottom() + yo);
     }
     invalidateBBox();
+    updatePacked();
 }
 
 //---------------------------------------------------------
@@ -112,6 +124,7 @@ Shape& Shape::scale(const SizeF& mag)
         r.scale(mag);
     }
     invalidateBBox();
+    updatePacked();
     return *this;
 }
 
@@ -130,6 +143,7 @@ Shape& Shape::adjust(double xp1, double yp1, double xp2, double yp2)
     for (ShapeElement& element : m_elements) {
         element.adjust(xp1, yp1, xp2, yp2);
     }
+    updatePacked();
     return *this;
 }
 
@@ -149,6 +163,7 @@ Shape& Shape::pad(double p)
     for (ShapeElement& el : m_elements) {
         el.pad(p);
     }
+    updatePacked();
     return *this;
 }
 
@@ -212,6 +227,249 @@ std::optional<ShapeElement> Shape::get_first() const
     return std::make_optional(m_elements.at(0));
 }
 
+namespace {
+// below this size packing costs more than it saves
+static constexpr size_t MIN_SIZE_FOR_PACKED_EDGES = 8;
+
+//! NOTE Returns the max of (bottom - by1) over the packed rects [0, size) of positive height
+//! which horizontally intersect [bx1, bx2], with exactly the same semantics (and result)
+//! as the scalar loop using mu::engraving::intersects()
+static double maxVerticalOverlap(const double* x, const double* y, const double* w, const double* h, size_t size,
+                                 double bx1, double bx2, double by1, double minHorizontalClearance, double dist)
+{
+    if (bx1 == bx2) {
+        return dist;
+    }
+
+    const double bx2WithClearance = bx2 + minHorizontalClearance;
+
+    size_t i = 0;
+
+#if defined(MU_ENGRAVING_SHAPE_SSE2)
+    const __m128d vbx1 = _mm_set1_pd(bx1);
+    const __m128d vbx2 = _mm_set1_pd(bx2WithClearance);
+    const __m128d vby1 = _mm_set1_pd(by1);
+    const __m128d vclearance = _mm_set1_pd(minHorizontalClearance);
+    const __m128d vzero = _mm_setzero_pd();
+    __m128d vdist = _mm_set1_pd(dist);
+
+    for (; i + 2 <= size; i += 2) {
+        const __m128d ax1 = _mm_loadu_pd(x + i);
+        const __m128d ax2 = _mm_add_pd(ax1, _mm_loadu_pd(w + i));
+        const __m128d ah = _mm_loadu_pd(h + i);
+        const __m128d hit = _mm_and_pd(_mm_and_pd(_mm_cmpgt_pd(ah, vzero), _mm_cmpneq_pd(ax1, ax2)),
+                                       _mm_and_pd(_mm_cmpgt_pd(_mm_add_pd(ax2, vclearance), vbx1), _mm_cmplt_pd(ax1, vbx2)));
+        const __m128d d = _mm_sub_pd(_mm_add_pd(_mm_loadu_pd(y + i), ah), vby1);
+        vdist = _mm_max_pd(vdist, _mm_or_pd(_mm_and_pd(hit, d), _mm_andnot_pd(hit, vdist)));
+    }
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, vdist);
+    dist = std::max(lanes[0], lanes[1]);
+#elif defined(MU_ENGRAVING_SHAPE_NEON)
+    const float64x2_t vbx1 = vdupq_n_f64(bx1);
+    const float64x2_t vbx2 = vdupq_n_f64(bx2WithClearance);
+    const float64x2_t vby1 = vdupq_n_f64(by1);
+    const float64x2_t vclearance = vdupq_n_f64(minHorizontalClearance);
+    const float64x2_t vzero = vdupq_n_f64(0.0);
+    float64x2_t vdist = vdupq_n_f64(dist);
+
+    for (; i + 2 <= size; i += 2) {
+        const float64x2_t ax1 = vld1q_f64(x + i);
+        const float64x2_t ax2 = vaddq_f64(ax1, vld1q_f64(w + i));
+        const float64x2_t ah = vld1q_f64(h + i);
+        const uint64x2_t hit = vbicq_u64(vandq_u64(vandq_u64(vcgtq_f64(ah, vzero), vcgtq_f64(vaddq_f64(ax2, vclearance), vbx1)),
+                                                   vcltq_f64(ax1, vbx2)),
+                                         vceqq_f64(ax1, ax2));
+        const float64x2_t d = vsubq_f64(vaddq_f64(vld1q_f64(y + i), ah), vby1);
+        vdist = vmaxq_f64(vdist, vbslq_f64(hit, d, vdist));
+    }
+
+    dist = std::max(vgetq_lane_f64(vdist, 0), vgetq_lane_f64(vdist, 1));
+#endif
+
+    for (; i < size; ++i) {
+        if (h[i] <= 0.0) {
+            continue;
+        }
+        if (mu::engraving::intersects(x[i], x[i] + w[i], bx1, bx2, minHorizontalClearance)) {
+            dist = std::max(dist, y[i] + h[i] - by1);
+        }
+    }
+
+    return dist;
+}
+
+//! NOTE The distance one rect of the left shape requires to the rect r of the right shape,
+//! -DBL_MAX if it doesn't constrain it
+static inline double horizontalDistance(double x, double y, double w, double h, const RectF& r,
+                                        const Shape::HorizontalDistanceRule& rule)
+{
+    if (muse::is_zero(w) && muse::is_zero(h)) {
+        return -DBL_MAX;
+    }
+
+    // Temporary hack: shapes of zero-width are assumed to collide with everything
+    if (rule.alwaysCollide || w == 0 || mu::engraving::intersects(y, y + h, r.top(), r.bottom(), rule.verticalClearance)) {
+        return x + w - r.left() + rule.padding;
+    }
+
+    switch (rule.kerning) {
+    case KerningType::KERN_UNTIL_LEFT_EDGE:
+        return x - r.left();
+    case KerningType::KERN_UNTIL_CENTER:
+        return x + 0.5 * w - r.left();
+    case KerningType::KERN_UNTIL_RIGHT_EDGE:
+        return x + w - r.left();
+    default:
+        return -DBL_MAX;
+    }
+}
+
+//! NOTE Returns the max of horizontalDistance() over the packed rects [begin, end) and dist
+static double maxHorizontalDistance(const double* x, const double* y, const double* w, const double* h, size_t begin, size_t end,
+                                    const RectF& r, const Shape::HorizontalDistanceRule& rule, double dist)
+{
+    size_t i = begin;
+
+    // centering needs a multiply-add, which the compiler may contract in the scalar code only
+    const bool packedKerning = rule.kerning != KerningType::KERN_UNTIL_CENTER;
+
+#if defined(MU_ENGRAVING_SHAPE_SSE2) || defined(MU_ENGRAVING_SHAPE_NEON)
+    const double bx1 = r.left();
+    const double by1 = r.top();
+    const double by2 = r.bottom();
+    // the rect of r itself may prevent any intersection, see mu::engraving::intersects()
+    const bool canIntersect = by1 != by2;
+    const bool kernToLeftEdge = rule.kerning == KerningType::KERN_UNTIL_LEFT_EDGE;
+    const bool kernToRightEdge = rule.kerning == KerningType::KERN_UNTIL_RIGHT_EDGE;
+#endif
+
+#if defined(MU_ENGRAVING_SHAPE_SSE2)
+    if (packedKerning) {
+        const __m128d vallBits = _mm_castsi128_pd(_mm_set1_epi32(-1));
+        const __m128d valwaysCollide = rule.alwaysCollide ? vallBits : _mm_setzero_pd();
+        const __m128d vcanIntersect = canIntersect ? vallBits : _mm_setzero_pd();
+        const __m128d vsign = _mm_set1_pd(-0.0);
+        const __m128d veps = _mm_set1_pd(muse::_compare_real_epsilon);
+        const __m128d vzero = _mm_setzero_pd();
+        const __m128d vnone = _mm_set1_pd(-DBL_MAX);
+        const __m128d vbx1 = _mm_set1_pd(bx1);
+        const __m128d vby1 = _mm_set1_pd(by1);
+        const __m128d vby2 = _mm_set1_pd(by2 + rule.verticalClearance);
+        const __m128d vclearance = _mm_set1_pd(rule.verticalClearance);
+        const __m128d vpadding = _mm_set1_pd(rule.padding);
+        __m128d vdist = _mm_set1_pd(dist);
+
+        for (; i + 2 <= end; i += 2) {
+            const __m128d ax1 = _mm_loadu_pd(x + i);
+            const __m128d aw = _mm_loadu_pd(w + i);
+            const __m128d ay1 = _mm_loadu_pd(y + i);
+            const __m128d ah = _mm_loadu_pd(h + i);
+            const __m128d ax2 = _mm_add_pd(ax1, aw);
+            const __m128d ay2 = _mm_add_pd(ay1, ah);
+
+            const __m128d notNull = _mm_or_pd(_mm_cmpgt_pd(_mm_andnot_pd(vsign, aw), veps),
+                                              _mm_cmpgt_pd(_mm_andnot_pd(vsign, ah), veps));
+            const __m128d intersection = _mm_and_pd(_mm_and_pd(vcanIntersect, _mm_cmpneq_pd(ay1, ay2)),
+                                                    _mm_and_pd(_mm_cmpgt_pd(_mm_add_pd(ay2, vclearance), vby1),
+                                                               _mm_cmplt_pd(ay1, vby2)));
+            const __m128d collision = _mm_or_pd(_mm_or_pd(valwaysCollide, intersection), _mm_cmpeq_pd(aw, vzero));
+
+            const __m128d collisionDist = _mm_add_pd(_mm_sub_pd(ax2, vbx1), vpadding);
+            const __m128d kerningDist = kernToLeftEdge ? _mm_sub_pd(ax1, vbx1) : (kernToRightEdge ? _mm_sub_pd(ax2, vbx1) : vnone);
+            const __m128d d = _mm_or_pd(_mm_and_pd(collision, collisionDist), _mm_andnot_pd(collision, kerningDist));
+            vdist = _mm_max_pd(vdist, _mm_or_pd(_mm_and_pd(notNull, d), _mm_andnot_pd(notNull, vnone)));
+        }
+
+        double lanes[2];
+        _mm_storeu_pd(lanes, vdist);
+        dist = std::max(lanes[0], lanes[1]);
+    }
+#elif defined(MU_ENGRAVING_SHAPE_NEON)
+    if (packedKerning) {
+        const uint64x2_t valwaysCollide = vdupq_n_u64(rule.alwaysCollide ? ~uint64_t(0) : 0);
+        const uint64x2_t vcanIntersect = vdupq_n_u64(canIntersect ? ~uint64_t(0) : 0);
+        const float64x2_t veps = vdupq_n_f64(muse::_compare_real_epsilon);
+        const float64x2_t vzero = vdupq_n_f64(0.0);
+        const float64x2_t vnone = vdupq_n_f64(-DBL_MAX);
+        const float64x2_t vbx1 = vdupq_n_f64(bx1);
+        const float64x2_t vby1 = vdupq_n_f64(by1);
+        const float64x2_t vby2 = vdupq_n_f64(by2 + rule.verticalClearance);
+        const float64x2_t vclearance = vdupq_n_f64(rule.verticalClearance);
+        const float64x2_t vpadding = vdupq_n_f64(rule.padding);
+        float64x2_t vdist = vdupq_n_f64(dist);
+
+        for (; i + 2 <= end; i += 2) {
+            const float64x2_t ax1 = vld1q_f64(x + i);
+            const float64x2_t aw = vld1q_f64(w + i);
+            const float64x2_t ay1 = vld1q_f64(y + i);
+            const float64x2_t ah = vld1q_f64(h + i);
+            const float64x2_t ax2 = vaddq_f64(ax1, aw);
+            const float64x2_t ay2 = vaddq_f64(ay1, ah);
+
+            const uint64x2_t notNull = vorrq_u64(vcgtq_f64(vabsq_f64(aw), veps), vcgtq_f64(vabsq_f64(ah), veps));
+            const uint64x2_t intersection = vandq_u64(vbicq_u64(vcanIntersect, vceqq_f64(ay1, ay2)),
+                                                      vandq_u64(vcgtq_f64(vaddq_f64(ay2, vclearance), vby1), vcltq_f64(ay1, vby2)));
+            const uint64x2_t collision = vorrq_u64(vorrq_u64(valwaysCollide, intersection), vceqq_f64(aw, vzero));
+
+            const float64x2_t collisionDist = vaddq_f64(vsubq_f64(ax2, vbx1), vpadding);
+            const float64x2_t kerningDist = kernToLeftEdge ? vsubq_f64(ax1, vbx1) : (kernToRightEdge ? vsubq_f64(ax2, vbx1) : vnone);
+            const float64x2_t d = vbslq_f64(collision, collisionDist, kerningDist);
+            vdist = vmaxq_f64(vdist, vbslq_f64(notNull, d, vnone));
+        }
+
+        dist = std::max(vgetq_lane_f64(vdist, 0), vgetq_lane_f64(vdist, 1));
+    }
+#else
+    UNUSED(packedKerning);
+#endif
+
+    for (; i < end; ++i) {
+        dist = std::max(dist, horizontalDistance(x[i], y[i], w[i], h[i], r, rule));
+    }
+
+    return dist;
+}
+}
+
+//-------------------------------------------------------------------
+//   updatePacked
+//    Keeps the packed edges in sync with the elements [from, size()),
+//    the elements before are already packed
+//-------------------------------------------------------------------
+
+void Shape::updatePacked(size_t from)
+{
+    const size_t size = m_elements.size();
+    if (size < MIN_SIZE_FOR_PACKED_EDGES) {
+        m_packed.clear();
+        m_packedStride = 0;
+        m_packedValid = false;
+        return;
+    }
+
+    if (!m_packedValid || size > m_packedStride) {
+        // leave room for the elements which are usually added after
+        m_packedStride = size + size / 2;
+        m_packed.resize(4 * m_packedStride);
+        m_packedValid = true;
+        from = 0;
+    }
+
+    double* x = m_packed.data();
+    double* y = x + m_packedStride;
+    double* w = y + m_packedStride;
+    double* h = w + m_packedStride;
+    for (size_t i = from; i < size; ++i) {
+        const RectF& r = m_elements[i];
+        x[i] = r.x();
+        y[i] = r.y();
+        w[i] = r.width();
+        h[i] = r.height();
+    }
+}
+
 //-------------------------------------------------------------------
 //   minVerticalDistance
 //    a is located below this shape.
@@ -225,6 +483,19 @@ double Shape::minVerticalDistance(const Shape& a, double minHorizontalClearance)
     }
 
     double dist = -DBL_MAX; // min real
+
+    if (m_packedValid) {
+        const double* x = m_packed.data();
+        for (const RectF& r2 : a.m_elements) {
+            if (r2.height() <= 0.0) {
+                continue;
+            }
+            dist = maxVerticalOverlap(x, x + m_packedStride, x + 2 * m_packedStride, x + 3 * m_packedStride, m_elements.size(),
+                                      r2.left(), r2.right(), r2.top(), minHorizontalClearance, dist);
+        }
+        return dist;
+    }
+
     for (const RectF& r2 : a.m_elements) {
         if (r2.height() <= 0.0) {
             continue;
@@ -259,6 +530,20 @@ double Shape::verticalClearance(const Shape& a, double minHorizontalDistance) co
         return 0.0;
     }
 
+    if (m_packedValid) {
+        // min(top - bottom) == -max(bottom - top)
+        double overlap = -DBL_MAX;
+        const double* x = m_packed.data();
+        for (const RectF& r2 : a.m_elements) {
+            if (r2.height() <= 0.0) {
+                continue;
+            }
+            overlap = maxVerticalOverlap(x, x + m_packedStride, x + 2 * m_packedStride, x + 3 * m_packedStride, m_elements.size(),
+                                         r2.left(), r2.right(), r2.top(), minHorizontalDistance, overlap);
+        }
+        return -overlap;
+    }
+
     double dist = DBL_MAX; // max real
     for (const RectF& r2 : a.m_elements) {
         if (r2.height() <= 0.0) {
@@ -280,6 +565,27 @@ double Shape::verticalClearance(const Shape& a, double minHorizontalDistance) co
     return dist;
 }
 
+//-------------------------------------------------------------------
+//   minHorizontalDistance
+//    r is located right of the elements [begin, end) of this shape,
+//    which all follow the same rule.
+//    Returns the max of dist and the distance they require to r.
+//-------------------------------------------------------------------
+
+double Shape::minHorizontalDistance(size_t begin, size_t end, const RectF& r, const HorizontalDistanceRule& rule, double dist) const
+{
+    if (m_packedValid) {
+        const double* x = m_packed.data();
+        return maxHorizontalDistance(x, x + m_packedStride, x + 2 * m_packedStride, x + 3 * m_packedStride, begin, end, r, rule, dist);
+    }
+
+    for (size_t i = begin; i < end; ++i) {
+        const RectF& r1 = m_elements[i];
+        dist = std::max(dist, horizontalDistance(r1.x(), r1.y(), r1.width(), r1.height(), r, rule));
+    }
+    return dist;
+}
+
 //----------------------------------------------------------------
 // clearsVertically()
 // a is located below this shape
@@ -469,6 +775,7 @@ void Shape::setBBox(const RectF& r, const EngravingItem* p)
     } else {
         m_elements[0] = ShapeElement(r, p);
     }
+    updatePacked();
 }
 
 void Shape::addBBox(const RectF& r)
@@ -482,6 +789,7 @@ void Shape::addBBox(const RectF& r)
     }
 
     m_elements[0].unite(r);
+    updatePacked();
 }
 
 //---------------------------------------------------------
@@ -491,8 +799,10 @@ void Shape::addBBox(const RectF& r)
 void Shape::add(const Shape& s)
 {
     m_type = Type::Composite;
+    const size_t from = m_elements.size();
     m_elements.insert(m_elements.end(), s.m_elements.begin(), s.m_elements.end());
     invalidateBBox();
+    updatePacked(from);
 }
 
 void Shape::add(const ShapeElement& shapeEl)
@@ -500,6 +810,7 @@ void Shape::add(const ShapeElement& shapeEl)
     m_type = Type::Composite;
     m_elements.push_back(shapeEl);
     invalidateBBox();
+    updatePacked(m_elements.size() - 1);
 }
 
 //---------------------------------------------------------
@@ -511,6 +822,7 @@ void Shape::remove(const RectF& r)
     for (auto i = m_elements.begin(); i != m_elements.end(); ++i) {
         if (*i == r) {
             m_elements.erase(i);
+            updatePacked();
             return;
         }
     }
@@ -547,6 +859,7 @@ void Shape::removeInvisibles()
         return !shapeElement.item() || !shapeElement.item()->visible();
     });
     invalidateBBox();
+    updatePacked();
 }
 
 void Shape::removeTypes(const std::set<ElementType>& types)
@@ -555,6 +868,7 @@ void Shape::removeTypes(const std::set<ElementType>& types)
         return shapeElement.item() && muse::contains(types, shapeElement.item()->type());
     });
     invalidateBBox();
+    updatePacked();
 }
 
 //---------------------------------------------------------
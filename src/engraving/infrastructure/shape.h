@@ -36,6 +36,7 @@ class Painter;
 
 namespace mu::engraving {
 class EngravingItem;
+enum class KerningType : unsigned char;
 
 //---------------------------------------------------------
 //   ShapeElement
@@ -86,7 +87,7 @@ public:
 
     size_t size() const { return m_elements.size(); }
     bool empty() const { return m_elements.empty(); }
-    void clear() { m_elements.clear(); }
+    void clear() { m_elements.clear(); updatePacked(); }
 
     bool equal(const Shape& sh) const
     {
@@ -121,13 +122,20 @@ public:
         size_t origSize = m_elements.size();
         m_elements.erase(std::remove_if(m_elements.begin(), m_elements.end(), p), m_elements.end());
         invalidateBBox();
+        updatePacked();
         return origSize != m_elements.size();
     }
 
     // ---
 
     const std::vector<ShapeElement>& elements() const { return m_elements; }
-    std::vector<ShapeElement>& elements() { return m_elements; }
+    std::vector<ShapeElement>& elements()
+    {
+        // the elements may be changed through the reference, so the queries
+        // don't use the packed edges until the next modification of the shape
+        m_packedValid = false;
+        return m_elements;
+    }
     std::vector<RectF> toRects() const;
 
     std::optional<ShapeElement> find_if(const std::function<bool(const ShapeElement&)>& func) const;
@@ -153,6 +161,17 @@ public:
     const RectF& bbox() const;
     double minVerticalDistance(const Shape&, double minHorizontalClearance = 0.0) const;
     double verticalClearance(const Shape&, double minHorizontalDistance = 0.0) const;
+
+    // How the elements of one item keep their distance to a rect on their right,
+    // see HorizontalSpacing::minHorizontalDistance
+    struct HorizontalDistanceRule {
+        double verticalClearance = 0.0;
+        double padding = 0.0;
+        KerningType kerning {};
+        bool alwaysCollide = false;
+    };
+    double minHorizontalDistance(size_t begin, size_t end, const RectF& r, const HorizontalDistanceRule& rule, double dist) const;
+
     double topDistance(const PointF&) const;
     double bottomDistance(const PointF&) const;
     double left() const;
@@ -175,10 +194,18 @@ public:
 private:
 
     void invalidateBBox();
+    void updatePacked(size_t from = 0);
 
     Type m_type = Type::Fixed;
     std::vector<ShapeElement> m_elements;
     mutable RectF m_bbox;   // cache
+
+    // x, y, width and height of the elements of large shapes in separate arrays
+    // of m_packedStride values each, so that the distance queries can test several
+    // rects per instruction. They are updated with every modification of the shape.
+    std::vector<double> m_packed;
+    size_t m_packedStride = 0;
+    bool m_packedValid = false;
 };
 
 void dump(const ShapeElement& sh, std::stringstream& ss);
@@ -22,6 +22,8 @@
 
 #include "skyline.h"
 
+#include <algorithm>
+
 #include "realfn.h"
 #include "draw/painter.h"
 
@@ -103,6 +105,7 @@ SkylineLine SkylineLine::getFilteredCopy(std::function<bool(const ShapeElement&)
     SkylineLine newSkylineLine(*this);
 
     newSkylineLine.m_shape.clear();
+    newSkylineLine.invalidateXIndex();
 
     for (const ShapeElement& shapeEl : m_shape.elements()) {
         if (filterOut(shapeEl)) {
@@ -114,6 +117,107 @@ SkylineLine SkylineLine::getFilteredCopy(std::function<bool(const ShapeElement&)
     return newSkylineLine;
 }
 
+SkylineLine SkylineLine::getFilteredCopy(std::function<bool(const ShapeElement&)> filterOut, double startX, double endX) const
+{
+    SkylineLine newSkylineLine(*this);
+
+    newSkylineLine.m_shape.clear();
+    newSkylineLine.invalidateXIndex();
+
+    forEachElementInRange(startX, endX, [&](const ShapeElement& shapeEl) {
+        if (!filterOut(shapeEl)) {
+            newSkylineLine.m_shape.add(shapeEl);
+        }
+    });
+
+    if (newSkylineLine.m_shape.empty()) {
+        // Distances to an empty line are 0 rather than "no collision",
+        // so keep one element out of range if the full copy wouldn't be empty
+        for (const ShapeElement& shapeEl : m_shape.elements()) {
+            if (!filterOut(shapeEl)) {
+                newSkylineLine.m_shape.add(shapeEl);
+                break;
+            }
+        }
+    }
+
+    return newSkylineLine;
+}
+
+//---------------------------------------------------------
+//   ensureXIndex
+//    (re)build the index of elements sorted by left edge
+//---------------------------------------------------------
+
+void SkylineLine::ensureXIndex() const
+{
+    if (m_xIndexValid) {
+        return;
+    }
+
+    const std::vector<ShapeElement>& elements = m_shape.elements();
+
+    m_xIndex.resize(elements.size());
+    m_maxElementWidth = 0.0;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        m_xIndex[i] = i;
+        m_maxElementWidth = std::max(m_maxElementWidth, elements[i].width());
+    }
+
+    std::stable_sort(m_xIndex.begin(), m_xIndex.end(), [&elements](size_t a, size_t b) {
+        return elements[a].left() < elements[b].left();
+    });
+
+    m_xIndexValid = true;
+}
+
+void SkylineLine::insertIntoXIndex(size_t elementIdx)
+{
+    if (!m_xIndexValid) {
+        return;
+    }
+
+    const std::vector<ShapeElement>& elements = m_shape.elements();
+    const double left = elements[elementIdx].left();
+
+    auto pos = std::upper_bound(m_xIndex.begin(), m_xIndex.end(), left, [&elements](double x, size_t idx) {
+        return x < elements[idx].left();
+    });
+    m_xIndex.insert(pos, elementIdx);
+    m_maxElementWidth = std::max(m_maxElementWidth, elements[elementIdx].width());
+}
+
+//---------------------------------------------------------
+//   forEachElementInRange
+//    call func for every element with right > startX and left < endX,
+//    in left edge order
+//---------------------------------------------------------
+
+template<typename Func>
+void SkylineLine::forEachElementInRange(double startX, double endX, Func func) const
+{
+    ensureXIndex();
+
+    const std::vector<ShapeElement>& elements = m_shape.elements();
+
+    // right <= left + maxElementWidth, so elements starting well before startX - maxElementWidth can't reach startX
+    // (1.0 is a margin for rounding)
+    const double minLeft = startX == -DBL_MAX ? -DBL_MAX : startX - m_maxElementWidth - 1.0;
+    auto it = std::upper_bound(m_xIndex.begin(), m_xIndex.end(), minLeft, [&elements](double x, size_t idx) {
+        return x < elements[idx].left();
+    });
+
+    for (; it != m_xIndex.end(); ++it) {
+        const ShapeElement& element = elements[*it];
+        if (!(element.left() < endX)) {
+            break;
+        }
+        if (element.right() > startX) {
+            func(element);
+        }
+    }
+}
+
 void SkylineLine::add(const ShapeElement& r)
 {
     if (r.ignoreForLayout()) {
@@ -140,6 +244,7 @@ void SkylineLine::add(const ShapeElement& r)
     }
 
     m_shape.add(r);
+    insertIntoXIndex(m_shape.size() - 1);
 }
 
 double SkylineLine::staffLinesTopAtX(double x) const
@@ -187,6 +292,9 @@ void SkylineLine::clear()
 {
     m_staffLineEdges.clear();
     m_shape.clear();
+    m_xIndex.clear();
+    m_maxElementWidth = 0.0;
+    m_xIndexValid = true;
 }
 
 //-------------------------------------------------------------------
@@ -271,14 +379,12 @@ SkylineLine& SkylineLine::translateY(double y)
     return *this;
 }
 
-double SkylineLine::top(double startX, double endX)
+double SkylineLine::top(double startX, double endX) const
 {
     double top = DBL_MAX;
-    for (const ShapeElement& element : m_shape.elements()) {
-        if (element.right() > startX && element.left() < endX) {
-            top = std::min(top, element.top());
-        }
-    }
+    forEachElementInRange(startX, endX, [&top](const ShapeElement& element) {
+        top = std::min(top, element.top());
+    });
 
     if (top == DBL_MAX) {
         top = 0.0;
@@ -287,14 +393,12 @@ double SkylineLine::top(double startX, double endX)
     return top;
 }
 
-double SkylineLine::bottom(double startX, double endX)
+double SkylineLine::bottom(double startX, double endX) const
 {
     double bottom = -DBL_MAX;
-    for (const ShapeElement& element : m_shape.elements()) {
-        if (element.right() > startX && element.left() < endX) {
-            bottom = std::max(bottom, element.bottom());
-        }
-    }
+    forEachElementInRange(startX, endX, [&bottom](const ShapeElement& element) {
+        bottom = std::max(bottom, element.bottom());
+    });
 
     if (bottom == -DBL_MAX) {
         bottom = 0.0;
@@ -52,8 +52,14 @@ public:
     void add(const Shape& s);
 
     template<typename Predicate>
-    inline bool remove_if(Predicate p) { return m_shape.remove_if(p); }
+    inline bool remove_if(Predicate p)
+    {
+        invalidateXIndex();
+        return m_shape.remove_if(p);
+    }
     SkylineLine getFilteredCopy(std::function<bool(const ShapeElement&)> filterOut) const;
+    // Only copies the elements which horizontally overlap ]startX, endX[ (plus one other if none does)
+    SkylineLine getFilteredCopy(std::function<bool(const ShapeElement&)> filterOut, double startX, double endX) const;
 
     void clear();
     // TODO: avoid passing down minHorizontalClearance (in future it must be done
@@ -68,18 +74,30 @@ public:
 
     SkylineLine& translateY(double y);
 
-    double top(double startX = -DBL_MAX, double endX = DBL_MAX);
-    double bottom(double startX = -DBL_MAX, double endX = DBL_MAX);
+    double top(double startX = -DBL_MAX, double endX = DBL_MAX) const;
+    double bottom(double startX = -DBL_MAX, double endX = DBL_MAX) const;
 
     bool isNorth() const { return m_isNorth; }
 
     const std::vector<ShapeElement>& elements() const { return m_shape.elements(); }
-    std::vector<ShapeElement>& elements() { return m_shape.elements(); }
+    std::vector<ShapeElement>& elements()
+    {
+        invalidateXIndex();
+        return m_shape.elements();
+    }
 
 private:
     double staffLinesTopAtX(double x) const;
     double staffLinesBottomAtX(double x) const;
 
+    // Elements are kept in insertion order, the index sorts them by left edge
+    // so that range queries don't need to visit the whole line
+    void invalidateXIndex() { m_xIndexValid = false; }
+    void ensureXIndex() const;
+    void insertIntoXIndex(size_t elementIdx);
+    template<typename Func>
+    void forEachElementInRange(double startX, double endX, Func func) const;
+
 private:
     const bool m_isNorth;
     Shape m_shape;
@@ -93,6 +111,10 @@ private:
 
     std::map<double, StaffLineEdge> m_staffLineEdges;
     bool hasValidStaffLineEdges() const { return !m_staffLineEdges.empty(); }
+
+    mutable std::vector<size_t> m_xIndex;
+    mutable double m_maxElementWidth = 0.0;
+    mutable bool m_xIndexValid = true;
 };
 
 //---------------------------------------------------------
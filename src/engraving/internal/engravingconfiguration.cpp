@@ -57,6 +57,11 @@ static const Settings::Key FRETBOARD_DIAGRAMS_AUTO_UPDATE("engraving", "score/fr
 
 static const Settings::Key DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT("engraving", "engraving/compat/doNotSaveEIDsForBackCompat");
 
+static const Settings::Key PARALLEL_LAYOUT("engraving", "engraving/layout/parallel");
+static const Settings::Key PARALLEL_READING("engraving", "engraving/read/parallel");
+static const Settings::Key LAYOUT_CACHE("engraving", "engraving/layout/cache");
+static const Settings::Key PARALLEL_PLAYBACK_LOADING("engraving", "engraving/playback/parallel");
+
 struct VoiceColor {
     Settings::Key key;
     Color color;
@@ -164,6 +169,22 @@ void EngravingConfiguration::init()
     settings()->setDefaultValue(DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT, Val(false));
     settings()->setDescription(DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT, muse::trc("engraving", "Do not save EIDs"));
     settings()->setCanBeManuallyEdited(DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT, false);
+
+    settings()->setDefaultValue(PARALLEL_LAYOUT, Val(false));
+    settings()->setDescription(PARALLEL_LAYOUT, muse::trc("engraving", "Build the skylines of the staves in parallel"));
+    settings()->setCanBeManuallyEdited(PARALLEL_LAYOUT, true);
+
+    settings()->setDefaultValue(PARALLEL_READING, Val(false));
+    settings()->setDescription(PARALLEL_READING, muse::trc("engraving", "Parse the parts of a score file in parallel"));
+    settings()->setCanBeManuallyEdited(PARALLEL_READING, true);
+
+    settings()->setDefaultValue(LAYOUT_CACHE, Val(false));
+    settings()->setDescription(LAYOUT_CACHE, muse::trc("engraving", "Save the system breaks in the score file and use them when opening it"));
+    settings()->setCanBeManuallyEdited(LAYOUT_CACHE, true);
+
+    settings()->setDefaultValue(PARALLEL_PLAYBACK_LOADING, Val(false));
+    settings()->setDescription(PARALLEL_PLAYBACK_LOADING, muse::trc("engraving", "Render the playback of the instruments in parallel when opening a score"));
+    settings()->setCanBeManuallyEdited(PARALLEL_PLAYBACK_LOADING, true);
 }
 
 muse::io::path_t EngravingConfiguration::appDataPath() const
@@ -467,6 +488,46 @@ void EngravingConfiguration::setDoNotSaveEIDsForBackCompat(bool doNotSave)
     settings()->setSharedValue(DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT, Val(doNotSave));
 }
 
+bool EngravingConfiguration::parallelLayoutEnabled() const
+{
+    return settings()->value(PARALLEL_LAYOUT).toBool();
+}
+
+void EngravingConfiguration::setParallelLayoutEnabled(bool enabled)
+{
+    settings()->setSharedValue(PARALLEL_LAYOUT, Val(enabled));
+}
+
+bool EngravingConfiguration::parallelReadingEnabled() const
+{
+    return settings()->value(PARALLEL_READING).toBool();
+}
+
+void EngravingConfiguration::setParallelReadingEnabled(bool enabled)
+{
+    settings()->setSharedValue(PARALLEL_READING, Val(enabled));
+}
+
+bool EngravingConfiguration::layoutCacheEnabled() const
+{
+    return settings()->value(LAYOUT_CACHE).toBool();
+}
+
+void EngravingConfiguration::setLayoutCacheEnabled(bool enabled)
+{
+    settings()->setSharedValue(LAYOUT_CACHE, Val(enabled));
+}
+
+bool EngravingConfiguration::parallelPlaybackLoadingEnabled() const
+{
+    return settings()->value(PARALLEL_PLAYBACK_LOADING).toBool();
+}
+
+void EngravingConfiguration::setParallelPlaybackLoadingEnabled(bool enabled)
+{
+    settings()->setSharedValue(PARALLEL_PLAYBACK_LOADING, Val(enabled));
+}
+
 bool EngravingConfiguration::guitarProImportExperimental() const
 {
     return guitarProConfiguration() ? guitarProConfiguration()->experimental() : false;
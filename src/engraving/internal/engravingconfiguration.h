@@ -118,6 +118,18 @@ public:
     bool doNotSaveEIDsForBackCompat() const override;
     void setDoNotSaveEIDsForBackCompat(bool doNotSave) override;
 
+    bool parallelLayoutEnabled() const override;
+    void setParallelLayoutEnabled(bool enabled) override;
+
+    bool parallelReadingEnabled() const override;
+    void setParallelReadingEnabled(bool enabled) override;
+
+    bool layoutCacheEnabled() const override;
+    void setLayoutCacheEnabled(bool enabled) override;
+
+    bool parallelPlaybackLoadingEnabled() const override;
+    void setParallelPlaybackLoadingEnabled(bool enabled) override;
+
     bool guitarProImportExperimental() const override;
     bool shouldAddParenthesisOnStandardStaff() const override;
     bool negativeFretsAllowed() const override;
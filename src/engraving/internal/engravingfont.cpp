@@ -30,6 +30,7 @@
 #include "dom/mscore.h"
 
 #include "smufl.h"
+#include "engravingfontmetricstable.h"
 
 #include "log.h"
 
@@ -99,6 +100,8 @@ void EngravingFont::ensureLoad()
         return;
     }
 
+    TRACEFUNC;
+
     if (-1 == fontProvider()->addSymbolFont(String::fromStdString(m_family), m_fontPath)) {
         LOGE() << "fatal error: cannot load internal font: " << m_fontPath;
         return;
@@ -110,6 +113,13 @@ void EngravingFont::ensureLoad()
     m_font.setNoFontMerging(true);
     m_font.setHinting(Font::Hinting::PreferVerticalHinting);
 
+    const uint64_t metricsStamp = metricsSourceStamp();
+    if (loadMetricsCache(metricsStamp)) {
+        loadComposedGlyphs();
+        m_loaded = true;
+        return;
+    }
+
     for (size_t id = 0; id < m_symbols.size(); ++id) {
         Smufl::Code code = Smufl::code(static_cast<SymId>(id));
         if (!code.isValid()) {
@@ -141,6 +151,8 @@ void EngravingFont::ensureLoad()
     loadStylisticAlternates(metadataJson.value("glyphsWithAlternates").toObject());
     loadEngravingDefaults(metadataJson.value("engravingDefaults").toObject());
 
+    saveMetricsCache(metricsStamp);
+
     m_loaded = true;
 }
 
@@ -854,6 +866,167 @@ void EngravingFont::computeMetrics(EngravingFont::Sym& sym, const Smufl::Code& c
     }
 }
 
+// =============================================
+// Metrics cache
+// =============================================
+
+uint64_t EngravingFont::metricsSourceStamp() const
+{
+    if (!fileSystem()) {
+        return 0;
+    }
+
+    std::string source;
+
+    //! NOTE The table stores the ids of symbols, anchors and styles, another build may number them differently
+    if (application()) {
+        source += application()->version().toString().toStdString();
+        source += '|' + application()->revision().toStdString() + '|';
+    }
+
+    for (const path_t& path : { m_fontPath, m_metadataPath }) {
+        source += path.toStdString();
+        source += '|' + std::to_string(fileSystem()->fileSize(path).val);
+        source += '|' + fileSystem()->lastModified(path).toString().toStdString();
+        source += '|';
+    }
+
+    //! NOTE FNV-1a, stable between the launches unlike std::hash
+    uint64_t stamp = 14695981039346656037ull;
+    for (unsigned char c : source) {
+        stamp ^= c;
+        stamp *= 1099511628211ull;
+    }
+
+    return stamp;
+}
+
+path_t EngravingFont::metricsCachePath() const
+{
+    if (!globalConfiguration()) {
+        return path_t();
+    }
+
+    return globalConfiguration()->userAppDataPath() + "/engraving_fonts/" + m_name + ".metrics";
+}
+
+bool EngravingFont::loadMetricsCache(uint64_t sourceStamp)
+{
+    const path_t path = metricsCachePath();
+    if (sourceStamp == 0 || path.empty() || !fileSystem()->exists(path)) {
+        return false;
+    }
+
+    RetVal<ByteArray> data = fileSystem()->readFile(path);
+    if (!data.ret) {
+        return false;
+    }
+
+    const EngravingFontMetricsTable table = EngravingFontMetricsTable::fromData(data.val);
+    if (table.sourceStamp != sourceStamp || table.symbols.size() != m_symbols.size()) {
+        return false;
+    }
+
+    for (size_t id = 0; id < m_symbols.size(); ++id) {
+        const EngravingFontMetricsTable::Symbol& record = table.symbols.at(id);
+
+        Sym& sym = m_symbols[id];
+        sym.code = record.code;
+        sym.bbox = RectF(record.bboxX, record.bboxY, record.bboxWidth, record.bboxHeight);
+        sym.advance = record.advance;
+
+        for (uint32_t i = record.firstAnchor; i < record.firstAnchor + record.anchorCount; ++i) {
+            const EngravingFontMetricsTable::Anchor& anchor = table.anchors.at(i);
+            sym.smuflAnchors[static_cast<SmuflAnchorId>(anchor.id)] = PointF(anchor.x, anchor.y);
+        }
+    }
+
+    for (const EngravingFontMetricsTable::Default& def : table.defaults) {
+        if (def.type == EngravingFontMetricsTable::DefaultType::Bool) {
+            m_engravingDefaults.insert({ static_cast<Sid>(def.sid), def.value != 0.0 });
+        } else {
+            m_engravingDefaults.insert({ static_cast<Sid>(def.sid), def.value });
+        }
+    }
+
+    if (table.hasEngravingDefaults) {
+        m_engravingDefaults.insert({ Sid::musicalTextFont, String(u"%1 Text").arg(String::fromStdString(m_family)) });
+    }
+
+    m_textEnclosureThickness = table.textEnclosureThickness;
+
+    return true;
+}
+
+void EngravingFont::saveMetricsCache(uint64_t sourceStamp) const
+{
+    const path_t path = metricsCachePath();
+    if (sourceStamp == 0 || path.empty()) {
+        return;
+    }
+
+    EngravingFontMetricsTable table;
+    table.sourceStamp = sourceStamp;
+    table.textEnclosureThickness = m_textEnclosureThickness;
+    table.symbols.reserve(m_symbols.size());
+
+    for (const Sym& sym : m_symbols) {
+        EngravingFontMetricsTable::Symbol record;
+        record.code = static_cast<uint32_t>(sym.code);
+        record.firstAnchor = static_cast<uint32_t>(table.anchors.size());
+        record.anchorCount = static_cast<uint32_t>(sym.smuflAnchors.size());
+        record.bboxX = sym.bbox.x();
+        record.bboxY = sym.bbox.y();
+        record.bboxWidth = sym.bbox.width();
+        record.bboxHeight = sym.bbox.height();
+        record.advance = sym.advance;
+        table.symbols.push_back(record);
+
+        for (const auto& [id, pos] : sym.smuflAnchors) {
+            EngravingFontMetricsTable::Anchor anchor;
+            anchor.id = static_cast<uint32_t>(id);
+            anchor.x = pos.x();
+            anchor.y = pos.y();
+            table.anchors.push_back(anchor);
+        }
+    }
+
+    for (const auto& [sid, value] : m_engravingDefaults) {
+        if (sid == Sid::musicalTextFont) {
+            table.hasEngravingDefaults = true;
+            continue;
+        }
+
+        EngravingFontMetricsTable::Default def;
+        def.sid = static_cast<int32_t>(sid);
+
+        switch (value.type()) {
+        case P_TYPE::REAL:
+            def.type = EngravingFontMetricsTable::DefaultType::Real;
+            def.value = value.toReal();
+            break;
+        case P_TYPE::BOOL:
+            def.type = EngravingFontMetricsTable::DefaultType::Bool;
+            def.value = value.toBool() ? 1.0 : 0.0;
+            break;
+        default:
+            LOGW() << "Unexpected type of the engraving default: " << static_cast<int>(sid);
+            return;
+        }
+
+        table.defaults.push_back(def);
+    }
+
+    Ret ret = fileSystem()->makePath(io::dirpath(path));
+    if (ret) {
+        ret = fileSystem()->writeFile(path, table.toData());
+    }
+
+    if (!ret) {
+        LOGW() << "Failed to write the metrics cache of " << m_name << ": " << ret.toString();
+    }
+}
+
 // =============================================
 // Symbol properties
 // =============================================
@@ -1107,10 +1280,8 @@ void EngravingFont::draw(SymId id, Painter* painter, const SizeF& mag, const Poi
     }
 
     painter->save();
-    double size = 20.0 * MScore::pixelRatio;
-    m_font.setPointSizeF(size);
     painter->scale(mag.width(), mag.height());
-    painter->setFont(m_font);
+    setupFont(painter);
     if (angle != 0) {
         const double _width = sym.bbox.width() / 2;
         const double _height = sym.bbox.height() / 2;
@@ -1129,18 +1300,79 @@ void EngravingFont::draw(SymId id, Painter* painter, double mag, const PointF& p
 
 void EngravingFont::draw(const SymIdList& ids, Painter* painter, double mag, const PointF& startPos, const double angle) const
 {
-    PointF pos(startPos);
-    for (SymId id : ids) {
-        draw(id, painter, mag, pos, angle);
-        pos.setX(pos.x() + advance(id, mag));
-    }
+    draw(ids, painter, SizeF(mag, mag), startPos, angle);
 }
 
 void EngravingFont::draw(const SymIdList& ids, Painter* painter, const SizeF& mag, const PointF& startPos, const double angle) const
 {
     PointF pos(startPos);
+
+    //! NOTE Each rotated symbol is rotated around its own center, so they can't be drawn as one run
+    if (angle != 0) {
+        for (SymId id : ids) {
+            draw(id, painter, mag, pos, angle);
+            pos.setX(pos.x() + advance(id, mag.width()));
+        }
+        return;
+    }
+
+    std::vector<PointF> positions;
+    positions.reserve(ids.size());
     for (SymId id : ids) {
-        draw(id, painter, mag, pos, angle);
+        positions.push_back(pos);
         pos.setX(pos.x() + advance(id, mag.width()));
     }
+
+    draw(ids, painter, mag, positions);
+}
+
+void EngravingFont::draw(const SymIdList& ids, Painter* painter, const SizeF& mag, const std::vector<PointF>& positions) const
+{
+    IF_ASSERT_FAILED(ids.size() == positions.size()) {
+        return;
+    }
+
+    std::vector<PointF> runPoints;
+    std::vector<char32_t> runCodes;
+    runPoints.reserve(ids.size());
+    runCodes.reserve(ids.size());
+
+    auto drawRun = [&]() {
+        if (runCodes.empty()) {
+            return;
+        }
+
+        painter->save();
+        painter->scale(mag.width(), mag.height());
+        setupFont(painter);
+        painter->drawSymbols(runPoints.data(), runCodes.data(), runCodes.size());
+        painter->restore();
+
+        runPoints.clear();
+        runCodes.clear();
+    };
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const Sym& sym = this->sym(ids[i]);
+        if (!sym.isValid() || sym.isCompound()) {
+            drawRun();
+            draw(ids[i], painter, mag, positions[i]);
+            continue;
+        }
+
+        runPoints.emplace_back(positions[i].x() / mag.width(), positions[i].y() / mag.height());
+        runCodes.push_back(sym.code);
+    }
+
+    drawRun();
+}
+
+void EngravingFont::setupFont(Painter* painter) const
+{
+    const double size = 20.0 * MScore::pixelRatio;
+    if (m_font.pointSizeF() != size) {
+        m_font.setPointSizeF(size);
+    }
+
+    painter->setFont(m_font);
 }
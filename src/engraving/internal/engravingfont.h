@@ -25,6 +25,9 @@
 
 #include "iengravingfont.h"
 #include "modularity/ioc.h"
+#include "global/iglobalconfiguration.h"
+#include "global/iapplication.h"
+#include "io/ifilesystem.h"
 #include "draw/ifontprovider.h"
 #include "draw/types/geometry.h"
 #include "iengravingfontsprovider.h"
@@ -52,6 +55,9 @@ class EngravingFont : public IEngravingFont, public muse::Injectable
 {
     muse::Inject<muse::draw::IFontProvider> fontProvider = { this };
     muse::Inject<IEngravingFontsProvider> engravingFonts = { this };
+    muse::Inject<muse::IGlobalConfiguration> globalConfiguration = { this };
+    muse::Inject<muse::io::IFileSystem> fileSystem = { this };
+    muse::GlobalInject<muse::IApplication> application;
 public:
     EngravingFont(const std::string& name, const std::string& family, const muse::io::path_t& filePath,
                   const muse::io::path_t& metadataPath, const muse::modularity::ContextPtr& iocCtx);
@@ -91,12 +97,14 @@ public:
 
     void draw(const SymIdList& ids, muse::draw::Painter* p, double mag, const PointF& pos, const double angle = 0) const override;
     void draw(const SymIdList& ids, muse::draw::Painter* p, const SizeF& mag, const PointF& pos, const double angle = 0) const override;
+    void draw(const SymIdList& ids, muse::draw::Painter* p, const SizeF& mag, const std::vector<PointF>& positions) const override;
 
     void ensureLoad();
 
 private:
 
     friend class SymbolFonts;
+    friend class Engraving_EngravingFontMetricsTableTests;
 
     struct Sym {
         char32_t code;
@@ -124,6 +132,11 @@ private:
     void loadEngravingDefaults(const muse::JsonObject& engravingDefaultsObject);
     void computeMetrics(Sym& sym, const Smufl::Code& code);
 
+    uint64_t metricsSourceStamp() const;
+    muse::io::path_t metricsCachePath() const;
+    bool loadMetricsCache(uint64_t sourceStamp);
+    void saveMetricsCache(uint64_t sourceStamp) const;
+
     void constructShapeWithCutouts(Shape& shape, SymId id);
 
     Sym& sym(SymId id);
@@ -131,6 +144,8 @@ private:
 
     bool useFallbackFont(SymId id) const;
 
+    void setupFont(muse::draw::Painter* p) const;
+
     bool m_loaded = false;
     std::vector<Sym> m_symbols;
     mutable muse::draw::Font m_font;
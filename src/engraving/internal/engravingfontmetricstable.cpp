@@ -0,0 +1,108 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "engravingfontmetricstable.h"
+
+#include <cstring>
+#include <type_traits>
+
+using namespace muse;
+using namespace mu::engraving;
+
+static_assert(std::is_trivially_copyable_v<EngravingFontMetricsTable::Symbol>);
+static_assert(std::is_trivially_copyable_v<EngravingFontMetricsTable::Anchor>);
+static_assert(std::is_trivially_copyable_v<EngravingFontMetricsTable::Default>);
+
+template<typename T>
+static void appendRecords(ByteArray& data, const T* records, size_t count)
+{
+    data.push_back(reinterpret_cast<const uint8_t*>(records), sizeof(T) * count);
+}
+
+template<typename T>
+static bool readRecords(const ByteArray& data, size_t& offset, std::vector<T>& records, size_t count)
+{
+    const size_t size = sizeof(T) * count;
+    if (offset + size > data.size()) {
+        return false;
+    }
+
+    records.resize(count);
+    if (size > 0) {
+        std::memcpy(records.data(), data.constData() + offset, size);
+    }
+
+    offset += size;
+    return true;
+}
+
+ByteArray EngravingFontMetricsTable::toData() const
+{
+    Header header;
+    header.sourceStamp = sourceStamp;
+    header.symbolCount = static_cast<uint32_t>(symbols.size());
+    header.anchorCount = static_cast<uint32_t>(anchors.size());
+    header.defaultCount = static_cast<uint32_t>(defaults.size());
+    header.hasEngravingDefaults = hasEngravingDefaults ? 1 : 0;
+    header.textEnclosureThickness = textEnclosureThickness;
+
+    ByteArray data;
+    data.reserve(sizeof(Header) + sizeof(Symbol) * symbols.size() + sizeof(Anchor) * anchors.size()
+                 + sizeof(Default) * defaults.size());
+
+    appendRecords(data, &header, 1);
+    appendRecords(data, symbols.data(), symbols.size());
+    appendRecords(data, anchors.data(), anchors.size());
+    appendRecords(data, defaults.data(), defaults.size());
+
+    return data;
+}
+
+EngravingFontMetricsTable EngravingFontMetricsTable::fromData(const ByteArray& data)
+{
+    EngravingFontMetricsTable table;
+
+    //! NOTE A table written on a machine with another byte order has a different magic
+    std::vector<Header> header;
+    size_t offset = 0;
+    if (!readRecords(data, offset, header, 1) || header.front().magic != MAGIC || header.front().version != VERSION) {
+        return table;
+    }
+
+    if (!readRecords(data, offset, table.symbols, header.front().symbolCount)
+        || !readRecords(data, offset, table.anchors, header.front().anchorCount)
+        || !readRecords(data, offset, table.defaults, header.front().defaultCount)
+        || offset != data.size()) {
+        return EngravingFontMetricsTable();
+    }
+
+    for (const Symbol& symbol : table.symbols) {
+        if (size_t(symbol.firstAnchor) + symbol.anchorCount > table.anchors.size()) {
+            return EngravingFontMetricsTable();
+        }
+    }
+
+    table.sourceStamp = header.front().sourceStamp;
+    table.hasEngravingDefaults = header.front().hasEngravingDefaults != 0;
+    table.textEnclosureThickness = header.front().textEnclosureThickness;
+
+    return table;
+}
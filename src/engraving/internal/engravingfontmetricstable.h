@@ -0,0 +1,98 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "types/bytearray.h"
+
+namespace mu::engraving {
+//! NOTE The symbol metrics of an engraving font as a flat binary table.
+//! It's kept between the launches, so that the font metadata JSON and the glyph outlines
+//! are not read again until the font changes. The records are stored as they are in memory,
+//! so restoring is a single copy per record array.
+class EngravingFontMetricsTable
+{
+public:
+    struct Symbol {
+        uint32_t code = 0;
+        uint32_t firstAnchor = 0;
+        uint32_t anchorCount = 0;
+        uint32_t reserved = 0;
+        double bboxX = 0.0;
+        double bboxY = 0.0;
+        double bboxWidth = 0.0;
+        double bboxHeight = 0.0;
+        double advance = 0.0;
+    };
+
+    struct Anchor {
+        uint32_t id = 0;
+        uint32_t reserved = 0;
+        double x = 0.0;
+        double y = 0.0;
+    };
+
+    enum class DefaultType : int32_t {
+        Real = 0,
+        Bool
+    };
+
+    struct Default {
+        int32_t sid = 0;
+        DefaultType type = DefaultType::Real;
+        double value = 0.0;
+    };
+
+    //! NOTE Identifies the font and metadata files the metrics were computed from
+    uint64_t sourceStamp = 0;
+
+    bool hasEngravingDefaults = false;
+    double textEnclosureThickness = 0.0;
+
+    std::vector<Symbol> symbols;
+    std::vector<Anchor> anchors;
+    std::vector<Default> defaults;
+
+    muse::ByteArray toData() const;
+
+    //! NOTE Returns an empty table if the data is broken or was written by another version
+    static EngravingFontMetricsTable fromData(const muse::ByteArray& data);
+
+private:
+    //! NOTE Increase if the records or the way the metrics are computed change
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t MAGIC = 0x4d53464d; // "MSFM"
+
+    struct Header {
+        uint32_t magic = MAGIC;
+        uint32_t version = VERSION;
+        uint64_t sourceStamp = 0;
+        uint32_t symbolCount = 0;
+        uint32_t anchorCount = 0;
+        uint32_t defaultCount = 0;
+        uint32_t hasEngravingDefaults = 0;
+        double textEnclosureThickness = 0.0;
+    };
+};
+}
@@ -22,6 +22,8 @@
 
 #include "playbackmodel.h"
 
+#include <limits>
+
 #include "dom/fret.h"
 #include "dom/harmony.h"
 #include "dom/instrument.h"
@@ -32,9 +34,14 @@
 #include "dom/staff.h"
 #include "dom/repeatlist.h"
 #include "dom/segment.h"
+#include "dom/spannermap.h"
 #include "dom/tie.h"
 #include "dom/tremolotwochord.h"
 
+#ifdef MUSE_THREADS_SUPPORT
+#include "concurrency/taskscheduler.h"
+#endif
+
 #include "defer.h"
 #include "log.h"
 
@@ -50,6 +57,89 @@ static const String CHORD_SYMBOLS_INSTRUMENT_ID(u"chord_symbols");
 
 const InstrumentTrackId PlaybackModel::METRONOME_TRACK_ID = { 999, METRONOME_INSTRUMENT_ID };
 
+#ifdef MUSE_THREADS_SUPPORT
+static muse::TaskScheduler* loadTaskScheduler()
+{
+    static muse::TaskScheduler scheduler;
+    return &scheduler;
+}
+#endif
+
+//! NOTE Calls func(tickPositionOffset, measure) for every measure of the repeat list, which intersects [tickFrom, tickTo]
+template<typename Func>
+static void forEachMeasure(const RepeatList& repeats, const int tickFrom, const int tickTo, Func&& func)
+{
+    for (const RepeatSegment* repeatSegment : repeats) {
+        int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
+        int repeatStartTick = repeatSegment->tick;
+        int repeatEndTick = repeatSegment->endTick();
+
+        if (repeatStartTick > tickTo || repeatEndTick <= tickFrom) {
+            continue;
+        }
+
+        for (const Measure* measure : repeatSegment->measureList()) {
+            int measureStartTick = measure->tick().ticks();
+            int measureEndTick = measure->endTick().ticks();
+
+            if (measureStartTick > tickTo || measureEndTick <= tickFrom) {
+                continue;
+            }
+
+            func(tickPositionOffset, measure);
+        }
+    }
+}
+
+static size_t eventCount(const PlaybackEventsMap& events)
+{
+    size_t count = 0;
+    for (const auto& pair : events) {
+        count += pair.second.size();
+    }
+    return count;
+}
+
+static PlaybackEventsMap eventsInRanges(const PlaybackEventsMap& events,
+                                        const std::vector<std::pair<timestamp_t, timestamp_t> >& ranges)
+{
+    PlaybackEventsMap result;
+    for (const auto& range : ranges) {
+        auto last = events.lower_bound(range.second);
+        for (auto it = events.lower_bound(range.first); it != last; ++it) {
+            result.insert(*it);
+        }
+    }
+    return result;
+}
+
+//! NOTE The new events of the added and the changed timestamps, an empty list for the removed ones
+static PlaybackEventsMap changedEvents(const PlaybackEventsMap& oldEvents, const PlaybackEventsMap& newEvents)
+{
+    PlaybackEventsMap result;
+
+    auto oldIt = oldEvents.cbegin();
+    auto newIt = newEvents.cbegin();
+
+    while (oldIt != oldEvents.cend() || newIt != newEvents.cend()) {
+        if (newIt == newEvents.cend() || (oldIt != oldEvents.cend() && oldIt->first < newIt->first)) {
+            result.emplace(oldIt->first, PlaybackEventList());
+            ++oldIt;
+        } else if (oldIt == oldEvents.cend() || newIt->first < oldIt->first) {
+            result.insert(*newIt);
+            ++newIt;
+        } else {
+            if (oldIt->second != newIt->second) {
+                result.insert(*newIt);
+            }
+            ++oldIt;
+            ++newIt;
+        }
+    }
+
+    return result;
+}
+
 static const Harmony* findChordSymbol(const EngravingItem* item)
 {
     if (item->isHarmony()) {
@@ -83,6 +173,17 @@ void PlaybackModel::load(Score* score)
         const TrackBoundaries trackRange = trackBoundaries(changes);
         ChangedTrackIdSet trackChanges;
 
+        m_updateStatistics = UpdateStatistics();
+
+        //! NOTE Only the events, which the update may change, are kept to compare them afterwards
+        TrackEventsSnapshots oldEvents;
+        oldEvents.ranges = changedTimestampRanges(tickRange.tickFrom, tickRange.tickTo);
+        oldEvents.tracks.reserve(m_playbackDataMap.size());
+        for (const auto& pair : m_playbackDataMap) {
+            oldEvents.tracks.emplace(pair.first, TrackEventsSnapshot { eventsInRanges(pair.second.originEvents, oldEvents.ranges),
+                                                                       pair.second.dynamics });
+        }
+
         clearExpiredTracks();
         clearExpiredContexts(trackRange.trackFrom, trackRange.trackTo);
         clearExpiredEvents(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges);
@@ -90,7 +191,7 @@ void PlaybackModel::load(Score* score)
         const InstrumentTrackIdSet oldTracks = existingTrackIdSet();
         update(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges);
 
-        notifyAboutChanges(oldTracks, trackChanges);
+        notifyAboutChanges(oldTracks, trackChanges, &oldEvents);
     });
 
     update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
@@ -142,6 +243,11 @@ void PlaybackModel::reload()
     m_tracksDataChanged.send(trackIdSet);
 }
 
+const PlaybackModel::UpdateStatistics& PlaybackModel::updateStatistics() const
+{
+    return m_updateStatistics;
+}
+
 muse::async::Channel<InstrumentTrackIdSet> PlaybackModel::tracksDataChanged() const
 {
     return m_tracksDataChanged;
@@ -370,7 +476,13 @@ void PlaybackModel::update(const int tickFrom, const int tickTo, const track_idx
 {
     updateSetupData();
     updateContext(trackFrom, trackTo);
-    updateEvents(tickFrom, tickTo, trackFrom, trackTo, trackChanges);
+
+    //! NOTE Only the whole score is rendered in parallel, i.e. on load and reload, the updates after a change are small
+    if (!trackChanges && configuration()->parallelPlaybackLoadingEnabled()) {
+        updateEventsConcurrently(tickFrom, tickTo);
+    } else {
+        updateEvents(tickFrom, tickTo, trackFrom, trackTo, trackChanges);
+    }
 }
 
 void PlaybackModel::updateSetupData()
@@ -452,8 +564,34 @@ void PlaybackModel::updateContext(const InstrumentTrackId& trackId)
     appendEvents(ctx->syllables(m_score));
 }
 
+void PlaybackModel::processMeasure(const int tickPositionOffset, const Measure* measure, const int tickFrom, const int tickTo,
+                                   const std::set<staff_idx_t>& staffIdxSet, ChangedTrackIdSet* trackChanges, TrackRenderJob* job)
+{
+    int chordRestSegmentNum = -1;
+
+    for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
+        if (!segment->isChordRestType() && !segment->isTimeTickType()) {
+            continue;
+        }
+
+        int segmentStartTick = segment->tick().ticks();
+        int segmentEndTick = segmentStartTick + segment->ticks().ticks();
+
+        if (segmentStartTick > tickTo || segmentEndTick <= tickFrom) {
+            continue;
+        }
+
+        if (segment->isChordRestType()) {
+            chordRestSegmentNum++;
+        }
+
+        processSegment(tickPositionOffset, segment, staffIdxSet, chordRestSegmentNum == 0, trackChanges, job);
+    }
+}
+
+//! NOTE With a job, only the items of its track are rendered into its events, without touching the maps of the model
 void PlaybackModel::processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& staffIdxSet,
-                                   bool isFirstChordRestSegmentOfMeasure, ChangedTrackIdSet* trackChanges)
+                                   bool isFirstChordRestSegmentOfMeasure, ChangedTrackIdSet* trackChanges, TrackRenderJob* job)
 {
     for (const EngravingItem* item : segment->annotations()) {
         if (!item || !item->part()) {
@@ -471,17 +609,26 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
         }
 
         InstrumentTrackId trackId = chordSymbolsTrackId(item->part()->id());
+        if (job && job->trackId != trackId) {
+            continue;
+        }
 
-        ArticulationsProfilePtr profile = defaultActiculationProfile(trackId);
+        ArticulationsProfilePtr profile = job ? job->profile : defaultActiculationProfile(trackId);
         if (!profile) {
             LOGE() << "unsupported instrument family: " << item->part()->id();
             continue;
         }
 
         if (chordSymbol->play()) {
-            const PlaybackContextPtr ctx = playbackCtx(trackId);
-            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile, ctx,
-                                         m_playbackDataMap[trackId].originEvents);
+            if (job) {
+                m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile, job->ctx, job->events);
+                ++job->renderedItems;
+            } else {
+                const PlaybackContextPtr ctx = playbackCtx(trackId);
+                m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile, ctx,
+                                             m_playbackDataMap[trackId].originEvents);
+                ++m_updateStatistics.renderedItems;
+            }
         }
 
         collectChangesTracks(trackId, trackChanges);
@@ -512,7 +659,7 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
                 const MeasureRepeat* measureRepeat = toMeasureRepeat(item);
                 const Measure* currentMeasure = measureRepeat->measure();
 
-                processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges);
+                processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges, job);
 
                 continue;
             } else if (item->voice() == 0) {
@@ -521,31 +668,39 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
                 if (currentMeasure->measureRepeatCount(staffIdx) > 0) {
                     const MeasureRepeat* measureRepeat = currentMeasure->measureRepeatElement(staffIdx);
 
-                    processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges);
+                    processMeasureRepeat(tickPositionOffset, measureRepeat, currentMeasure, staffIdx, trackChanges, job);
                     continue;
                 }
             }
         }
 
-        if (item->isRest()) {
+        //! NOTE The repeated measures are processed by the job of every track of the staff, they filter their items themselves
+        if (item->isRest() || (job && job->trackId != trackId)) {
             continue;
         }
 
-        ArticulationsProfilePtr profile = defaultActiculationProfile(trackId);
+        ArticulationsProfilePtr profile = job ? job->profile : defaultActiculationProfile(trackId);
         if (!profile) {
             LOGE() << "unsupported instrument family: " << item->part()->id();
             continue;
         }
 
+        if (job) {
+            m_renderer.render(item, tickPositionOffset, profile, job->ctx, job->events);
+            ++job->renderedItems;
+            continue;
+        }
+
         const PlaybackContextPtr ctx = playbackCtx(trackId);
         m_renderer.render(item, tickPositionOffset, profile, ctx, m_playbackDataMap[trackId].originEvents);
+        ++m_updateStatistics.renderedItems;
 
         collectChangesTracks(trackId, trackChanges);
     }
 }
 
 void PlaybackModel::processMeasureRepeat(const int tickPositionOffset, const MeasureRepeat* measureRepeat, const Measure* currentMeasure,
-                                         const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges)
+                                         const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges, TrackRenderJob* job)
 {
     if (!measureRepeat || !currentMeasure) {
         return;
@@ -577,7 +732,7 @@ void PlaybackModel::processMeasureRepeat(const int tickPositionOffset, const Mea
             chordRestSegmentNum++;
         }
 
-        processSegment(tickFrom, seg, staffToProcessIdxSet, chordRestSegmentNum == 0, trackChanges);
+        processSegment(tickFrom, seg, staffToProcessIdxSet, chordRestSegmentNum == 0, trackChanges, job);
     }
 }
 
@@ -593,50 +748,109 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
     const ArticulationsProfilePtr metronomeProfile = defaultActiculationProfile(METRONOME_TRACK_ID);
     PlaybackEventsMap& metronomeEvents = m_playbackDataMap[METRONOME_TRACK_ID].originEvents;
 
-    for (const RepeatSegment* repeatSegment : repeatList()) {
-        int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
-        int repeatStartTick = repeatSegment->tick;
-        int repeatEndTick = repeatSegment->endTick();
+    forEachMeasure(repeatList(), tickFrom, tickTo, [&](const int tickPositionOffset, const Measure* measure) {
+        processMeasure(tickPositionOffset, measure, tickFrom, tickTo, staffToProcessIdxSet, trackChanges);
 
-        if (repeatStartTick > tickTo || repeatEndTick <= tickFrom) {
-            continue;
+        if (m_metronomeEnabled) {
+            m_renderer.renderMetronome(m_score, measure, tickPositionOffset, metronomeProfile, metronomeEvents);
+            ++m_updateStatistics.renderedItems;
+            collectChangesTracks(METRONOME_TRACK_ID, trackChanges);
         }
+    });
+}
 
-        for (const Measure* measure : repeatSegment->measureList()) {
-            int measureStartTick = measure->tick().ticks();
-            int measureEndTick = measure->endTick().ticks();
+void PlaybackModel::updateEventsConcurrently(const int tickFrom, const int tickTo)
+{
+#ifdef MUSE_THREADS_SUPPORT
+    TRACEFUNC;
 
-            if (measureStartTick > tickTo || measureEndTick <= tickFrom) {
-                continue;
-            }
+    //! NOTE The tasks only read the score: the lazily computed data, which the renderers use (the repeat list,
+    //! the spanner intervals, the contexts and the articulation profiles), is prepared on this thread.
+    //! The tempo map has no caches, the hints of the repeat list are atomic
+    const RepeatList& repeats = repeatList();
 
-            int chordRestSegmentNum = -1;
+    const SpannerMap& spannerMap = m_score->spannerMap();
+    if (spannerMap.isDirty()) {
+        spannerMap.update();
+    }
 
-            for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
-                if (!segment->isChordRestType() && !segment->isTimeTickType()) {
-                    continue;
-                }
+    std::vector<TrackRenderJob> jobs;
 
-                int segmentStartTick = segment->tick().ticks();
-                int segmentEndTick = segmentStartTick + segment->ticks().ticks();
+    for (const Part* part : m_score->parts()) {
+        std::set<staff_idx_t> staffIdxSet;
+        for (const Staff* staff : part->staves()) {
+            if (staff->isPrimaryStaff()) { // skip linked staves
+                staffIdxSet.insert(staff->idx());
+            }
+        }
 
-                if (segmentStartTick > tickTo || segmentEndTick <= tickFrom) {
-                    continue;
+        auto addJob = [this, &jobs, &staffIdxSet](const InstrumentTrackId& trackId) {
+            for (const TrackRenderJob& job : jobs) {
+                if (job.trackId == trackId) {
+                    return;
                 }
+            }
 
-                if (segment->isChordRestType()) {
-                    chordRestSegmentNum++;
-                }
+            TrackRenderJob job;
+            job.trackId = trackId;
+            job.staffIdxSet = staffIdxSet;
+            job.profile = defaultActiculationProfile(trackId);
+            job.ctx = playbackCtx(trackId);
+            jobs.push_back(std::move(job));
+        };
 
-                processSegment(tickPositionOffset, segment, staffToProcessIdxSet, chordRestSegmentNum == 0, trackChanges);
+        for (const auto& pair : part->instruments()) {
+            InstrumentTrackId trackId = idKey(part->id(), pair.second->id());
+            if (trackId.isValid()) {
+                addJob(trackId);
             }
+        }
 
-            if (m_metronomeEnabled) {
-                m_renderer.renderMetronome(m_score, measure, tickPositionOffset, metronomeProfile, metronomeEvents);
-                collectChangesTracks(METRONOME_TRACK_ID, trackChanges);
-            }
+        if (part->hasChordSymbol()) {
+            addJob(chordSymbolsTrackId(part->id()));
+        }
+    }
+
+    std::vector<std::future<void> > tasks;
+    tasks.reserve(jobs.size());
+
+    for (TrackRenderJob& job : jobs) {
+        tasks.push_back(loadTaskScheduler()->submit([this, &repeats, &job, tickFrom, tickTo]() {
+            forEachMeasure(repeats, tickFrom, tickTo, [&](const int tickPositionOffset, const Measure* measure) {
+                processMeasure(tickPositionOffset, measure, tickFrom, tickTo, job.staffIdxSet, nullptr, &job);
+            });
+        }));
+    }
+
+    if (m_metronomeEnabled) {
+        const ArticulationsProfilePtr metronomeProfile = defaultActiculationProfile(METRONOME_TRACK_ID);
+        PlaybackEventsMap& metronomeEvents = m_playbackDataMap[METRONOME_TRACK_ID].originEvents;
+
+        forEachMeasure(repeats, tickFrom, tickTo, [&](const int tickPositionOffset, const Measure* measure) {
+            m_renderer.renderMetronome(m_score, measure, tickPositionOffset, metronomeProfile, metronomeEvents);
+            ++m_updateStatistics.renderedItems;
+        });
+    }
+
+    for (std::future<void>& task : tasks) {
+        task.get();
+    }
+
+    //! NOTE Merged in the order of the parts and their instruments, the events of every timestamp
+    //! are appended to the ones of the context, in the same order as the serial update produces them
+    for (TrackRenderJob& job : jobs) {
+        PlaybackEventsMap& originEvents = m_playbackDataMap[job.trackId].originEvents;
+
+        for (auto& pair : job.events) {
+            PlaybackEventList& list = originEvents[pair.first];
+            list.insert(list.end(), std::make_move_iterator(pair.second.begin()), std::make_move_iterator(pair.second.end()));
         }
+
+        m_updateStatistics.renderedItems += job.renderedItems;
     }
+#else
+    updateEvents(tickFrom, tickTo, 0, m_score->ntracks());
+#endif
 }
 
 void PlaybackModel::reloadMetronomeEvents()
@@ -866,6 +1080,44 @@ void PlaybackModel::clearExpiredEvents(const int tickFrom, const int tickTo, con
     }
 }
 
+PlaybackModel::TimestampRanges PlaybackModel::changedTimestampRanges(const int tickFrom, const int tickTo) const
+{
+    TimestampRanges result;
+
+    //! NOTE The same measures as in updateEvents(), they are rendered entirely
+    for (const RepeatSegment* repeatSegment : repeatList()) {
+        int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
+        int repeatStartTick = repeatSegment->tick;
+        int repeatEndTick = repeatSegment->endTick();
+
+        if (repeatStartTick > tickTo || repeatEndTick <= tickFrom) {
+            continue;
+        }
+
+        int rangeFromTick = std::numeric_limits<int>::max();
+        int rangeToTick = std::numeric_limits<int>::min();
+
+        for (const Measure* measure : repeatSegment->measureList()) {
+            int measureStartTick = measure->tick().ticks();
+            int measureEndTick = measure->endTick().ticks();
+
+            if (measureStartTick > tickTo || measureEndTick <= tickFrom) {
+                continue;
+            }
+
+            rangeFromTick = std::min(rangeFromTick, measureStartTick);
+            rangeToTick = std::max(rangeToTick, measureEndTick);
+        }
+
+        if (rangeFromTick < rangeToTick) {
+            result.emplace_back(timestampFromTicks(m_score, rangeFromTick + tickPositionOffset),
+                                timestampFromTicks(m_score, rangeToTick + tickPositionOffset));
+        }
+    }
+
+    return result;
+}
+
 void PlaybackModel::collectChangesTracks(const InstrumentTrackId& trackId, ChangedTrackIdSet* result)
 {
     if (!result) {
@@ -875,7 +1127,8 @@ void PlaybackModel::collectChangesTracks(const InstrumentTrackId& trackId, Chang
     result->insert(trackId);
 }
 
-void PlaybackModel::notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks)
+void PlaybackModel::notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks,
+                                       const TrackEventsSnapshots* oldEvents)
 {
     for (const InstrumentTrackId& trackId : changedTracks) {
         auto search = m_playbackDataMap.find(trackId);
@@ -884,7 +1137,37 @@ void PlaybackModel::notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, co
             continue;
         }
 
-        search->second.mainStream.send(search->second.originEvents, search->second.dynamics);
+        PlaybackData& data = search->second;
+
+        ++m_updateStatistics.changedTracks;
+        m_updateStatistics.trackEvents += eventCount(data.originEvents);
+
+        const TrackEventsSnapshot* old = nullptr;
+        if (oldEvents && muse::contains(oldTracks, trackId)) {
+            auto it = oldEvents->tracks.find(trackId);
+            old = it != oldEvents->tracks.cend() ? &it->second : nullptr;
+        }
+
+        if (old && old->dynamics == data.dynamics) {
+            PlaybackEventsMap delta = changedEvents(old->events, eventsInRanges(data.originEvents, oldEvents->ranges));
+
+            //! NOTE When most of the track has changed, the full update is cheaper for the receivers
+            if (delta.size() * 2 <= data.originEvents.size()) {
+                m_updateStatistics.changedTimestamps += delta.size();
+                m_updateStatistics.changedEvents += eventCount(delta);
+                ++m_updateStatistics.deltaTracks;
+
+                if (!delta.empty()) {
+                    data.mainStreamDelta.send(delta, data.dynamics);
+                }
+                continue;
+            }
+        }
+
+        m_updateStatistics.changedTimestamps += data.originEvents.size();
+        m_updateStatistics.changedEvents += eventCount(data.originEvents);
+
+        data.mainStream.send(data.originEvents, data.dynamics);
     }
 
     for (auto it = m_playbackDataMap.cbegin(); it != m_playbackDataMap.cend(); ++it) {
@@ -34,6 +34,7 @@
 #include "mpe/events.h"
 #include "mpe/iarticulationprofilesrepository.h"
 
+#include "../iengravingconfiguration.h"
 #include "../types/types.h"
 #include "playbackeventsrenderer.h"
 #include "playbacksetupdataresolver.h"
@@ -51,6 +52,7 @@ class PlaybackModel : public muse::Injectable, public muse::async::Asyncable
 {
 public:
     muse::Inject<muse::mpe::IArticulationProfilesRepository> profilesRepository = { this };
+    muse::Inject<IEngravingConfiguration> configuration = { this };
 
 public:
     PlaybackModel(const muse::modularity::ContextPtr& iocCtx)
@@ -90,12 +92,37 @@ public:
     muse::async::Channel<InstrumentTrackId> trackAdded() const;
     muse::async::Channel<InstrumentTrackId> trackRemoved() const;
 
+    struct UpdateStatistics {
+        size_t renderedItems = 0;       // chords, chord symbols and measures of the metronome
+        size_t changedTracks = 0;
+        size_t deltaTracks = 0;         // tracks, which got only their changed timestamps
+        size_t changedTimestamps = 0;
+        size_t changedEvents = 0;
+        size_t trackEvents = 0;         // events of the changed tracks, i.e. what the full update would send
+    };
+
+    //! NOTE Statistics of the last update after a score change
+    const UpdateStatistics& updateStatistics() const;
+
 private:
     static const InstrumentTrackId METRONOME_TRACK_ID;
     static const InstrumentTrackId CHORD_SYMBOLS_TRACK_ID;
 
     using ChangedTrackIdSet = InstrumentTrackIdSet;
 
+    //! [from, to) of the timestamps, which an update of a tick range may change
+    using TimestampRanges = std::vector<std::pair<muse::mpe::timestamp_t, muse::mpe::timestamp_t> >;
+
+    struct TrackEventsSnapshot {
+        muse::mpe::PlaybackEventsMap events; // only the events in the changed ranges
+        muse::mpe::DynamicLevelLayers dynamics;
+    };
+
+    struct TrackEventsSnapshots {
+        TimestampRanges ranges;
+        std::unordered_map<InstrumentTrackId, TrackEventsSnapshot> tracks;
+    };
+
     struct TickBoundaries
     {
         int tickFrom = -1;
@@ -108,6 +135,18 @@ private:
         track_idx_t trackTo = muse::nidx;
     };
 
+    //! NOTE The events of one track, which a task of the parallel loading renders,
+    //! they are merged into the playback data afterwards
+    struct TrackRenderJob
+    {
+        InstrumentTrackId trackId;
+        std::set<staff_idx_t> staffIdxSet;
+        muse::mpe::ArticulationsProfilePtr profile;
+        PlaybackContextPtr ctx;
+        muse::mpe::PlaybackEventsMap events;
+        size_t renderedItems = 0;
+    };
+
     InstrumentTrackId idKey(const EngravingItem* item) const;
     InstrumentTrackId idKey(const std::vector<const EngravingItem*>& items) const;
     InstrumentTrackId idKey(const ID& partId, const String& instrumentId) const;
@@ -119,13 +158,16 @@ private:
     void updateContext(const InstrumentTrackId& trackId);
     void updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                       ChangedTrackIdSet* trackChanges = nullptr);
+    void updateEventsConcurrently(const int tickFrom, const int tickTo);
 
     void reloadMetronomeEvents();
 
+    void processMeasure(const int tickPositionOffset, const Measure* measure, const int tickFrom, const int tickTo,
+                        const std::set<staff_idx_t>& staffIdxSet, ChangedTrackIdSet* trackChanges, TrackRenderJob* job = nullptr);
     void processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& staffIdxSet,
-                        bool isFirstChordRestSegmentOfMeasure, ChangedTrackIdSet* trackChanges);
+                        bool isFirstChordRestSegmentOfMeasure, ChangedTrackIdSet* trackChanges, TrackRenderJob* job = nullptr);
     void processMeasureRepeat(const int tickPositionOffset, const MeasureRepeat* measureRepeat, const Measure* currentMeasure,
-                              const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges);
+                              const staff_idx_t staffIdx, ChangedTrackIdSet* trackChanges, TrackRenderJob* job = nullptr);
 
     bool hasToReloadTracks(const ScoreChanges& changes) const;
     bool hasToReloadScore(const ScoreChanges& changes) const;
@@ -134,8 +176,10 @@ private:
     void clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo);
     void clearExpiredEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                             ChangedTrackIdSet* trackChanges = nullptr);
+    TimestampRanges changedTimestampRanges(const int tickFrom, const int tickTo) const;
     void collectChangesTracks(const InstrumentTrackId& trackId, ChangedTrackIdSet* result);
-    void notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks);
+    void notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks,
+                            const TrackEventsSnapshots* oldEvents = nullptr);
 
     void removeEventsFromRange(const track_idx_t trackFrom, const track_idx_t trackTo, const muse::mpe::timestamp_t timestampFrom = -1,
                                const muse::mpe::timestamp_t timestampTo = -1, ChangedTrackIdSet* trackChanges = nullptr);
@@ -171,5 +215,7 @@ private:
     muse::async::Channel<InstrumentTrackIdSet> m_tracksDataChanged;
     muse::async::Channel<InstrumentTrackId> m_trackAdded;
     muse::async::Channel<InstrumentTrackId> m_trackRemoved;
+
+    UpdateStatistics m_updateStatistics;
 };
 }
@@ -37,20 +37,20 @@ using namespace muse::mpe;
 
 const mpe::ArticulationTypeSet& ChordArticulationsRenderer::supportedTypes()
 {
-    static mpe::ArticulationTypeSet SUPPORTED_TYPES;
+    static const mpe::ArticulationTypeSet types = []() {
+        mpe::ArticulationTypeSet result = GRACE_NOTE_ARTICULATION_TYPES;
 
-    if (SUPPORTED_TYPES.empty()) {
-        SUPPORTED_TYPES = GRACE_NOTE_ARTICULATION_TYPES;
+        result.insert(OrnamentsRenderer::supportedTypes().cbegin(),
+                      OrnamentsRenderer::supportedTypes().cend());
+        result.insert(TremoloRenderer::supportedTypes().cbegin(),
+                      TremoloRenderer::supportedTypes().cend());
+        result.insert(ArpeggioRenderer::supportedTypes().cbegin(),
+                      ArpeggioRenderer::supportedTypes().cend());
 
-        SUPPORTED_TYPES.insert(OrnamentsRenderer::supportedTypes().cbegin(),
-                               OrnamentsRenderer::supportedTypes().cend());
-        SUPPORTED_TYPES.insert(TremoloRenderer::supportedTypes().cbegin(),
-                               TremoloRenderer::supportedTypes().cend());
-        SUPPORTED_TYPES.insert(ArpeggioRenderer::supportedTypes().cbegin(),
-                               ArpeggioRenderer::supportedTypes().cend());
-    }
+        return result;
+    }();
 
-    return SUPPORTED_TYPES;
+    return types;
 }
 
 void ChordArticulationsRenderer::doRender(const EngravingItem* item, const mpe::ArticulationType /*type*/, const RenderingContext& ctx,
@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_LAYOUTOPTIONS_H
 #define MU_ENGRAVING_LAYOUTOPTIONS_H
 
+#include <map>
+
 namespace mu::engraving {
 //---------------------------------------------------------
 //   LayoutMode
@@ -42,6 +44,14 @@ struct LayoutOptions
     bool isShowVBox = true;
     double noteHeadWidth = 0.0;
 
+    //! NOTE Build the skylines of the staves of each system on worker threads.
+    //! The shapes the skylines are made of are filled in beforehand, so the result is the same as in the serial mode.
+    bool isParallelLayout = false;
+
+    //! NOTE System breaks of the layout saved with the file (start tick -> end tick of each system).
+    //! Used only by the first page layout after opening, to skip fitting the measures one by one.
+    std::map<int, int> systemBreakHints;
+
     bool isMode(LayoutMode m) const { return mode == m; }
     bool isLinearMode() const { return mode == LayoutMode::LINE || mode == LayoutMode::HORIZONTAL_FIXED; }
 };
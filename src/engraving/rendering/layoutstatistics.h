@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cstddef>
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   LayoutPassTimes
+//    Wall time of the layout passes, in milliseconds
+//---------------------------------------------------------
+
+struct LayoutPassTimes
+{
+    double resetLayoutData = 0.0;
+    double independentItems = 0.0;
+    double horizontalSpacing = 0.0;
+    double systemLayout = 0.0;      // collecting systems, without horizontal spacing
+    double pageLayout = 0.0;        // collecting pages, without system layout
+    double total = 0.0;
+};
+
+//---------------------------------------------------------
+//   LayoutStatistics
+//    Summary of the last layout run, used to check how much
+//    of the previous layout could be kept after an edit.
+//    Systems are only kept by the existing stop condition of the
+//    page layout (a system after the range ends on the same measure
+//    as before), a layout of the whole score collects all of them
+//---------------------------------------------------------
+
+struct LayoutStatistics
+{
+    bool isLayoutAll = false;
+
+    size_t recomputedSystems = 0;   // systems collected and laid out again
+    size_t reusedSystems = 0;       // systems kept from the previous layout as they were
+
+    size_t totalSystems() const { return recomputedSystems + reusedSystems; }
+
+    LayoutPassTimes passTimes;
+};
+}
@@ -83,13 +83,15 @@ void Autoplace::autoplaceSegmentElement(const EngravingItem* item, EngravingItem
 
         SkylineLine& staffSkyline = above ? ss->skyline().north() : ss->skyline().south();
 
+        // Only the skyline elements horizontally close to the shape can affect the distance
+        const RectF shapeBbox = shape.bbox();
         SkylineLine filteredSkyline = staffSkyline.getFilteredCopy([item](const ShapeElement& shapeEl) {
             const EngravingItem* skylineItem = shapeEl.item();
             if (!skylineItem) {
                 return false;
             }
             return itemsShouldIgnoreEachOther(item, skylineItem);
-        });
+        }, shapeBbox.left() - minSkylineHorizontalClearance, shapeBbox.right() + minSkylineHorizontalClearance);
 
         if (filteredSkyline.elements().empty()) {
             if (add && item->addToSkyline()) {
@@ -159,13 +161,14 @@ void Autoplace::autoplaceMeasureElement(const EngravingItem* item, EngravingItem
         SkylineLine sk(!above);
         SkylineLine& staffSkyline = above ? ss->skyline().north() : ss->skyline().south();
 
+        const RectF shapeBbox = sh.bbox();
         SkylineLine filteredSkyline = staffSkyline.getFilteredCopy([item](const ShapeElement& shapeEl) {
             const EngravingItem* skylineItem = shapeEl.item();
             if (!skylineItem) {
                 return false;
             }
             return itemsShouldIgnoreEachOther(item, skylineItem);
-        });
+        }, shapeBbox.left(), shapeBbox.right());
 
         double d;
         if (above) {
@@ -238,13 +241,14 @@ void Autoplace::autoplaceSpannerSegment(const SpannerSegment* item, EngravingIte
         }
         const Skyline& staffSkyline = system->staff(stfIdx)->skyline();
         const SkylineLine& skyline = above ? staffSkyline.north() : staffSkyline.south();
+        const RectF shapeBbox = sh.bbox();
         SkylineLine filteredSkyline = skyline.getFilteredCopy([item](const ShapeElement& shapeEl){
             const EngravingItem* skylineItem = shapeEl.item();
             if (!skylineItem) {
                 return false;
             }
             return itemsShouldIgnoreEachOther(item, skylineItem);
-        });
+        }, shapeBbox.left(), shapeBbox.right());
 
         if (above) {
             double d = sl.minDistance(filteredSkyline);
@@ -1208,59 +1208,48 @@ double HorizontalSpacing::minHorizontalDistance(const Shape& f, const Shape& s,
 {
     double dist = -DBL_MAX;        // min real
     double absoluteMinPadding = 0.1 * spatium * squeezeFactor;
+    const std::vector<ShapeElement>& elements1 = f.elements();
     for (const ShapeElement& r2 : s.elements()) {
         if (r2.isNull()) {
             continue;
         }
 
         const EngravingItem* item2 = r2.item();
-        double by1 = r2.top();
-        double by2 = r2.bottom();
-        for (const ShapeElement& r1 : f.elements()) {
-            if (r1.isNull()) {
-                continue;
-            }
-
-            const EngravingItem* item1 = r1.item();
 
-            double ay1 = r1.top();
-            double ay2 = r1.bottom();
-            double verticalClearance = computeVerticalClearance(item1, item2, spatium) * squeezeFactor;
-            bool intersection = mu::engraving::intersects(ay1, ay2, by1, by2, verticalClearance);
-            double padding = 0;
-            KerningType kerningType = KerningType::NON_KERNING;
-            if (item1 && item2) {
-                padding = computePadding(item1, item2);
-                padding *= squeezeFactor;
-                padding = std::max(padding, absoluteMinPadding);
-                kerningType = computeKerning(item1, item2);
+        // The rects of an item follow each other in the shape, so the rule is
+        // computed once for each run of them and the shape applies it to the whole run
+        size_t begin = 0;
+        while (begin < elements1.size()) {
+            const EngravingItem* item1 = elements1[begin].item();
+            bool allNull = true;
+            size_t end = begin;
+            for (; end < elements1.size() && elements1[end].item() == item1; ++end) {
+                allNull = allNull && elements1[end].isNull();
             }
 
-            if (kerningType == KerningType::ALLOW_COLLISION) {
+            if (allNull) {
+                begin = end;
                 continue;
             }
 
-            if (kerningType == KerningType::NON_KERNING
-                || intersection
-                || (r1.width() == 0 || r2.width() == 0)  // Temporary hack: shapes of zero-width are assumed to collide with everyghin
-                || (!item1 && item2 && item2->isLyrics())) {
-                dist = std::max(dist, r1.right() - r2.left() + padding);
-                continue;
+            Shape::HorizontalDistanceRule rule;
+            rule.verticalClearance = computeVerticalClearance(item1, item2, spatium) * squeezeFactor;
+            rule.kerning = KerningType::NON_KERNING;
+            if (item1 && item2) {
+                rule.padding = computePadding(item1, item2);
+                rule.padding *= squeezeFactor;
+                rule.padding = std::max(rule.padding, absoluteMinPadding);
+                rule.kerning = computeKerning(item1, item2);
             }
 
-            switch (kerningType) {
-            case KerningType::KERN_UNTIL_LEFT_EDGE:
-                dist = std::max(dist, r1.left() - r2.left());
-                break;
-            case KerningType::KERN_UNTIL_CENTER:
-                dist = std::max(dist, r1.left() + 0.5 * r1.width() - r2.left());
-                break;
-            case KerningType::KERN_UNTIL_RIGHT_EDGE:
-                dist = std::max(dist, r1.right() - r2.left());
-                break;
-            default:
-                break;
+            if (rule.kerning != KerningType::ALLOW_COLLISION) {
+                rule.alwaysCollide = rule.kerning == KerningType::NON_KERNING
+                                     || r2.width() == 0 // Temporary hack: shapes of zero-width are assumed to collide with everyghin
+                                     || (!item1 && item2 && item2->isLyrics());
+                dist = f.minHorizontalDistance(begin, end, r2, rule, dist);
             }
+
+            begin = end;
         }
     }
     return dist;
@@ -74,6 +74,13 @@ bool LayoutConfiguration::isPrintingMode() const
     return score()->printing();
 }
 
+int LayoutConfiguration::systemBreakHint(int startTick) const
+{
+    const std::map<int, int>& hints = options().systemBreakHints;
+    auto it = hints.find(startTick);
+    return it != hints.end() ? it->second : -1;
+}
+
 std::shared_ptr<const IEngravingFont> LayoutConfiguration::engravingFont() const
 {
     IF_ASSERT_FAILED(score()) {
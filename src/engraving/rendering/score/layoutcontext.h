@@ -24,6 +24,7 @@
 
 #include <vector>
 #include <set>
+#include <chrono>
 
 #include "../../types/fraction.h"
 #include "../../types/types.h"
@@ -33,6 +34,7 @@
 #include "../../dom/mscore.h"
 
 #include "../layoutoptions.h"
+#include "../layoutstatistics.h"
 
 #ifdef MUE_ENABLE_ENGRAVING_RENDER_DEBUG
 #include "log.h"
@@ -104,6 +106,8 @@ public:
 
     bool isShowVBox() const { return options().isShowVBox; }
     double noteHeadWidth() const { return options().noteHeadWidth; }
+    bool isParallelLayout() const { return options().isParallelLayout; }
+    int systemBreakHint(int startTick) const;
     bool isShowInvisible() const;
     int pageNumberOffset() const;
     bool isVerticalSpreadEnabled() const;
@@ -210,6 +214,27 @@ private:
     IGetScoreInternal* m_getScore = nullptr;
 };
 
+//---------------------------------------------------------
+//   LayoutPassTimer
+//    Adds the time spent in its scope to the given counter (ms)
+//---------------------------------------------------------
+
+class LayoutPassTimer
+{
+public:
+    explicit LayoutPassTimer(double& counter)
+        : m_counter(counter), m_start(std::chrono::steady_clock::now()) {}
+
+    ~LayoutPassTimer()
+    {
+        m_counter += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+    }
+
+private:
+    double& m_counter;
+    std::chrono::steady_clock::time_point m_start;
+};
+
 class LayoutState
 {
 public:
@@ -242,6 +267,9 @@ public:
 
     double totalBracketsWidth() const { return m_totalBracketsWidth; }
 
+    size_t collectedSystemCount() const { return m_collectedSystemCount; }
+    const LayoutPassTimes& passTimes() const { return m_passTimes; }
+
     // Mutable
     void setFirstSystem(bool val) { m_firstSystem = val; }
     void setFirstSystemIndent(bool val) { m_firstSystemIndent = val; }
@@ -279,6 +307,9 @@ public:
 
     void setTotalBracketsWidth(double val) { m_totalBracketsWidth = val; }
 
+    void incrementCollectedSystemCount() { ++m_collectedSystemCount; }
+    LayoutPassTimes& mutPassTimes() { return m_passTimes; }
+
 private:
 
     bool m_firstSystem = true;
@@ -310,6 +341,10 @@ private:
 
     // cache
     double m_totalBracketsWidth = -1.0;
+
+    // statistics
+    size_t m_collectedSystemCount = 0;
+    LayoutPassTimes m_passTimes;            // systemLayout and pageLayout are inclusive here
 };
 
 class LayoutDebug
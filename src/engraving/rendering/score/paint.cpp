@@ -22,6 +22,8 @@
 #include "paint.h"
 
 #include "draw/painter.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
 #include "dom/score.h"
 #include "dom/page.h"
 #include "dom/engravingitem.h"
@@ -73,6 +75,9 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Sco
     const bool wasPrinting = score->printing();
     score->setPrinting(opt.isPrinting);
 
+    //! NOTE The pages recorded here are replayed for the other copies, and for the other paints of an outer job
+    score->beginPaintJob();
+
     // Setup page counts
     int fromPage = opt.fromPage >= 0 ? opt.fromPage : 0;
     int toPage = (opt.toPage >= 0 && opt.toPage < int(pages.size())) ? opt.toPage : (int(pages.size()) - 1);
@@ -146,8 +151,14 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Sco
                 disableClipping = true;
             }
 
-            std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            paintItems(*painter, elements, opt);
+            //! NOTE The display list covers the whole page, so it only pays off when the whole page is painted
+            std::vector<EngravingItem*> elements;
+            if (opt.isPrinting && !opt.frameRect.isValid()) {
+                paintPageDisplayList(*painter, page, opt);
+            } else {
+                elements = page->items(drawRect.translated(-pagePos));
+                paintItems(*painter, elements, opt);
+            }
 
             if (disableClipping) {
                 painter->setClipping(false);
@@ -175,9 +186,71 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Sco
         }
     }
 
+    score->endPaintJob();
     score->setPrinting(wasPrinting);
 }
 
+void Paint::paintPageDisplayList(Painter& painter, Page* page, const PaintOptions& opt)
+{
+    TRACEFUNC;
+
+    std::shared_ptr<Page::DisplayList> list = page->displayList();
+
+    if (!list || list->pixelRatio != MScore::pixelRatio || list->invertColors != opt.invertColors) {
+        list = std::make_shared<Page::DisplayList>();
+        list->pixelRatio = MScore::pixelRatio;
+        list->invertColors = opt.invertColors;
+
+        std::vector<EngravingItem*> items = page->items(page->ldata()->bbox());
+        std::sort(items.begin(), items.end(), mu::engraving::elementLessThan);
+
+        std::shared_ptr<BufferedPaintProvider> recorder;
+        std::unique_ptr<Painter> recorderPainter;
+
+        auto finishRecording = [&]() {
+            if (recorderPainter) {
+                recorderPainter->endDraw();
+                list->entries.push_back({ recorder->drawData(), nullptr });
+                recorderPainter.reset();
+            }
+        };
+
+        for (const EngravingItem* item : items) {
+            if (!item->isInteractionAvailable()) {
+                continue;
+            }
+
+            //! NOTE Images are drawn straight on the paint device, so they can't be recorded
+            if (item->isImage()) {
+                finishRecording();
+                list->entries.push_back({ nullptr, item });
+                continue;
+            }
+
+            if (!recorderPainter) {
+                recorder = std::make_shared<BufferedPaintProvider>();
+                recorderPainter = std::make_unique<Painter>(recorder, "page_display_list");
+                //! NOTE Recorded as allowed, the replay follows the hint of the target painter
+                recorderPainter->setAntialiasing(true);
+            }
+
+            paintItem(*recorderPainter, item, opt);
+        }
+
+        finishRecording();
+
+        page->setDisplayList(list);
+    }
+
+    for (const Page::DisplayList::Entry& entry : list->entries) {
+        if (entry.data) {
+            DrawDataPaint::paint(&painter, entry.data);
+        } else {
+            paintItem(painter, entry.item, opt);
+        }
+    }
+}
+
 SizeF Paint::pageSizeInch(const Score* score)
 {
     if (!score) {
@@ -41,6 +41,8 @@ public:
     static void paintItem(muse::draw::Painter& painter, const EngravingItem* item, const PaintOptions& opt);
     static void paintItems(muse::draw::Painter& painter, const std::vector<EngravingItem*>& items, const PaintOptions& opt);
 
+    static void paintPageDisplayList(muse::draw::Painter& painter, Page* page, const PaintOptions& opt);
+
     static SizeF pageSizeInch(const Score* score);
     static SizeF pageSizeInch(const Score* score, const IScoreRenderer::ScorePaintOptions& opt);
 };
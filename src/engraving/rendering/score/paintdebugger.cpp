@@ -90,6 +90,11 @@ void PaintDebugger::setAntialiasing(bool arg)
     m_real->setAntialiasing(arg);
 }
 
+bool PaintDebugger::isAntialiasing() const
+{
+    return m_real->isAntialiasing();
+}
+
 void PaintDebugger::setCompositionMode(CompositionMode mode)
 {
     m_real->setCompositionMode(mode);
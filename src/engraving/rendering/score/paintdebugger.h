@@ -43,6 +43,7 @@ public:
     void endObject() override;
 
     void setAntialiasing(bool arg) override;
+    bool isAntialiasing() const override;
     void setCompositionMode(muse::draw::CompositionMode mode) override;
     void setWindow(const muse::RectF& window) override;
     void setViewport(const muse::RectF& viewport) override;
@@ -94,9 +94,14 @@ void ScoreHorizontalViewLayout::layoutHorizontalView(Score* score, LayoutContext
     ctx.mutState().setNextMeasure(m);             //_showVBox ? first() : firstMeasure();
     ctx.mutState().setStartTick(m->tick());
 
-    PassResetLayoutData resetPass;
-    resetPass.run(score, ctx);
+    {
+        LayoutPassTimer timer(ctx.mutState().mutPassTimes().resetLayoutData);
+        PassResetLayoutData resetPass;
+        resetPass.run(score, ctx);
+    }
 
+    // in linear mode the single page is the single system
+    LayoutPassTimer timer(ctx.mutState().mutPassTimes().pageLayout);
     layoutLinear(ctx, ctx.state().isLayoutAll());
 }
 
@@ -104,7 +109,10 @@ void ScoreHorizontalViewLayout::layoutLinear(LayoutContext& ctx, bool layoutAll)
 {
     resetSystems(ctx, layoutAll);
 
-    collectLinearSystem(ctx);
+    {
+        LayoutPassTimer timer(ctx.mutState().mutPassTimes().systemLayout);
+        collectLinearSystem(ctx);
+    }
 
     layoutLinear(ctx);
 }
@@ -278,6 +286,7 @@ void ScoreHorizontalViewLayout::collectLinearSystem(LayoutContext& ctx)
     }
 
     System* system = ctx.mutDom().systems().front();
+    ctx.mutState().incrementCollectedSystemCount();
     SystemLayout::setInstrumentNames(system, ctx, /* longNames */ true);
 
     double targetSystemWidth = ctx.dom().nmeasures() * ctx.conf().styleMM(Sid::minMeasureWidth).val();
@@ -343,7 +352,10 @@ void ScoreHorizontalViewLayout::collectLinearSystem(LayoutContext& ctx)
                     MeasureLayout::createEndBarLines(m, false, ctx);
                     MeasureLayout::setRepeatCourtesiesAndParens(m, ctx);
                     MeasureLayout::updateGraceNotes(m, ctx);
-                    curSystemWidth = HorizontalSpacing::updateSpacingForLastAddedMeasure(system, firstMeasureInLayout);
+                    {
+                        LayoutPassTimer spacingTimer(ctx.mutState().mutPassTimes().horizontalSpacing);
+                        curSystemWidth = HorizontalSpacing::updateSpacingForLastAddedMeasure(system, firstMeasureInLayout);
+                    }
                     measuresToLayout.insert(m);
                     if (firstMeasureInLayout) {
                         firstMeasureInLayout = false;
@@ -377,6 +389,7 @@ void ScoreHorizontalViewLayout::collectLinearSystem(LayoutContext& ctx)
                 curSystemWidth += measureWidth;
             }
         } else if (ctx.state().curMeasure()->isHBox()) {
+            LayoutPassTimer spacingTimer(ctx.mutState().mutPassTimes().horizontalSpacing);
             curSystemWidth = HorizontalSpacing::updateSpacingForLastAddedMeasure(system);
         }
 
@@ -47,6 +47,26 @@ public:
     ~CmdStateLocker() { m_score->cmdState().unlock(); }
 };
 
+static void updateLayoutStatistics(Score* score, const LayoutContext& ctx, double totalTime)
+{
+    const size_t totalSystems = score->systems().size();
+    const size_t recomputedSystems = std::min(ctx.state().collectedSystemCount(), totalSystems);
+
+    LayoutStatistics stats;
+    stats.isLayoutAll = ctx.state().isLayoutAll();
+    stats.recomputedSystems = recomputedSystems;
+    stats.reusedSystems = totalSystems - recomputedSystems;
+
+    // the layout state accumulates nested times, report each pass on its own
+    const LayoutPassTimes& times = ctx.state().passTimes();
+    stats.passTimes = times;
+    stats.passTimes.systemLayout = std::max(0.0, times.systemLayout - times.horizontalSpacing);
+    stats.passTimes.pageLayout = std::max(0.0, times.pageLayout - times.systemLayout);
+    stats.passTimes.total = totalTime;
+
+    score->setLayoutStatistics(stats);
+}
+
 void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction& et)
 {
     TRACEFUNC;
@@ -66,6 +86,7 @@ void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction&
         muse::DeleteAll(score->pages());
         score->pages().clear();
         PageLayout::getNextPage(ctx);
+        score->setLayoutStatistics(LayoutStatistics());
         return;
     }
 
@@ -81,19 +102,26 @@ void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction&
     ctx.mutState().setIsLayoutAll(isLayoutAll);
 
     // Init context and layout
-    switch (ctx.conf().viewMode()) {
-    case LayoutMode::PAGE:
-    case LayoutMode::FLOAT:
-        ScorePageViewLayout::layoutPageView(score, ctx, stick, etick);
-        break;
-    case LayoutMode::LINE:
-    case LayoutMode::HORIZONTAL_FIXED:
-        ScoreHorizontalViewLayout::layoutHorizontalView(score, ctx, stick, etick);
-        break;
-    case LayoutMode::SYSTEM:
-        ScoreVerticalViewLayout::layoutVerticalView(score, ctx, stick, etick);
-        break;
+    double totalTime = 0.0;
+    {
+        LayoutPassTimer timer(totalTime);
+
+        switch (ctx.conf().viewMode()) {
+        case LayoutMode::PAGE:
+        case LayoutMode::FLOAT:
+            ScorePageViewLayout::layoutPageView(score, ctx, stick, etick);
+            break;
+        case LayoutMode::LINE:
+        case LayoutMode::HORIZONTAL_FIXED:
+            ScoreHorizontalViewLayout::layoutHorizontalView(score, ctx, stick, etick);
+            break;
+        case LayoutMode::SYSTEM:
+            ScoreVerticalViewLayout::layoutVerticalView(score, ctx, stick, etick);
+            break;
+        }
     }
 
+    updateLayoutStatistics(score, ctx, totalTime);
+
     //LOGDA() << DumpLayoutData::dump(score);
 }
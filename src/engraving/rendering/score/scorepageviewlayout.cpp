@@ -177,18 +177,25 @@ void ScorePageViewLayout::layoutPageView(Score* score, LayoutContext& ctx, const
 
     //! NOTE Reset pass need anyway
 //#ifdef MUE_ENABLE_ENGRAVING_LD_PASSES
-    PassResetLayoutData resetPass;
-    resetPass.run(score, ctx);
+    {
+        LayoutPassTimer timer(ctx.mutState().mutPassTimes().resetLayoutData);
+        PassResetLayoutData resetPass;
+        resetPass.run(score, ctx);
+    }
 //#endif
 
 #ifdef MUE_ENABLE_ENGRAVING_LD_PASSES
     if (ctx.state().isLayoutAll()) {
+        LayoutPassTimer timer(ctx.mutState().mutPassTimes().independentItems);
         PassLayoutIndependentItems independentPass;
         independentPass.run(score, ctx);
     }
 #endif
 
-    doLayout(ctx);
+    {
+        LayoutPassTimer timer(ctx.mutState().mutPassTimes().pageLayout);
+        doLayout(ctx);
+    }
 
     layoutFinished(score, ctx);
 
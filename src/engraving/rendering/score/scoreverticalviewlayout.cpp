@@ -141,18 +141,30 @@ void ScoreVerticalViewLayout::layoutVerticalView(Score* score, LayoutContext& ct
 
     ctx.mutState().setPrevMeasure(nullptr);
 
-    PassResetLayoutData resetPass;
-    resetPass.run(score, ctx);
+    {
+        LayoutPassTimer timer(ctx.mutState().mutPassTimes().resetLayoutData);
+        PassResetLayoutData resetPass;
+        resetPass.run(score, ctx);
+    }
+
+    LayoutPassTimes& passTimes = ctx.mutState().mutPassTimes();
 
-    MeasureLayout::getNextMeasure(ctx);
-    ctx.mutState().setCurSystem(SystemLayout::collectSystem(ctx));
+    {
+        LayoutPassTimer timer(passTimes.pageLayout);
+        MeasureLayout::getNextMeasure(ctx);
+        ctx.mutState().setCurSystem(SystemLayout::collectSystem(ctx));
+    }
 
     if (ctx.state().isLayoutAll()) {
+        LayoutPassTimer timer(passTimes.independentItems);
         PassLayoutIndependentItems independentPass;
         independentPass.run(score, ctx);
     }
 
-    doLayout(ctx);
+    {
+        LayoutPassTimer timer(passTimes.pageLayout);
+        doLayout(ctx);
+    }
 }
 
 void ScoreVerticalViewLayout::doLayout(LayoutContext& ctx)
@@ -81,9 +81,25 @@
 #include "defer.h"
 #include "log.h"
 
+#include "muse_framework_config.h"
+
+#ifdef MUSE_THREADS_SUPPORT
+#include "concurrency/taskscheduler.h"
+#endif
+
 using namespace mu::engraving;
 using namespace mu::engraving::rendering::score;
 
+#ifdef MUSE_THREADS_SUPPORT
+static constexpr size_t MIN_STAVES_FOR_PARALLEL_SKYLINES = 2;
+
+static muse::TaskScheduler* layoutTaskScheduler()
+{
+    static muse::TaskScheduler scheduler;
+    return &scheduler;
+}
+#endif
+
 //---------------------------------------------------------
 //   collectSystem
 //---------------------------------------------------------
@@ -92,6 +108,9 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
 {
     TRACEFUNC;
 
+    LayoutPassTimes& passTimes = ctx.mutState().mutPassTimes();
+    LayoutPassTimer timer(passTimes.systemLayout);
+
     if (!ctx.state().curMeasure()) {
         return nullptr;
     }
@@ -132,6 +151,16 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
     double targetSystemWidth = ctx.conf().styleD(Sid::pagePrintableWidth) * DPI;
     system->setWidth(targetSystemWidth);
 
+    auto updateSpacingForLastAddedMeasure = [system, &passTimes]() {
+        LayoutPassTimer spacingTimer(passTimes.horizontalSpacing);
+        return HorizontalSpacing::updateSpacingForLastAddedMeasure(system);
+    };
+
+    auto computeSpacingForFullSystem = [system, &passTimes]() {
+        LayoutPassTimer spacingTimer(passTimes.horizontalSpacing);
+        return HorizontalSpacing::computeSpacingForFullSystem(system);
+    };
+
     // save state of measure
     MeasureBase* breakMeasure = nullptr;
 
@@ -144,6 +173,13 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
     const SystemLock* systemLock = ctx.conf().viewMode() == LayoutMode::PAGE || ctx.conf().viewMode() == LayoutMode::SYSTEM
                                    ? ctx.dom().systemLocks()->lockStartingAt(ctx.state().curMeasure()) : nullptr;
 
+    // the end of this system is known from the layout saved with the file
+    int breakHintEndTick = -1;
+    if (!systemLock && ctx.conf().viewMode() == LayoutMode::PAGE) {
+        breakHintEndTick = ctx.conf().systemBreakHint(ctx.state().curMeasure()->tick().ticks());
+    }
+    const bool skipFitting = systemLock || breakHintEndTick >= 0;
+
     while (ctx.state().curMeasure()) {      // collect measure for system
         oldSystem = ctx.mutState().curMeasure()->system();
         system->appendMeasure(ctx.mutState().curMeasure());
@@ -173,7 +209,7 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
 
             MeasureLayout::createEndBarLines(m, true, ctx);
 
-            if (m->noBreak() || systemLock) {
+            if (m->noBreak() || skipFitting) {
                 MeasureLayout::removeSystemTrailer(m);
             } else {
                 MeasureLayout::addSystemTrailer(m, m->nextMeasure(), ctx);
@@ -183,12 +219,12 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
 
             MeasureLayout::updateGraceNotes(m, ctx);
 
-            if (!systemLock) {
-                curSysWidth = HorizontalSpacing::updateSpacingForLastAddedMeasure(system);
+            if (!skipFitting) {
+                curSysWidth = updateSpacingForLastAddedMeasure();
             }
         } else if (ctx.state().curMeasure()->isHBox()) {
-            if (!systemLock) {
-                curSysWidth = HorizontalSpacing::updateSpacingForLastAddedMeasure(system);
+            if (!skipFitting) {
+                curSysWidth = updateSpacingForLastAddedMeasure();
             }
         } else {
             // vbox:
@@ -197,13 +233,27 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
             return system;
         }
 
-        bool doBreak = !systemLock && system->measures().size() > 1 && curSysWidth > targetSystemWidth
-                       && !ctx.state().prevMeasure()->noBreak();
+        // the hint is only trusted if the system still fits, otherwise (e.g. other fonts)
+        // the measures that don't fit are removed, as if the system was fitted normally
+        bool hintOverflow = false;
+        if (breakHintEndTick >= 0 && system->measures().size() > 1) {
+            const MeasureBase* mb = ctx.state().curMeasure();
+            const MeasureBase* next = mb->nextMM();
+            bool hintedSystemEnds = mb->endTick().ticks() >= breakHintEndTick || !next || next->isVBoxBase()
+                                    || mb->pageBreak() || mb->lineBreak() || mb->sectionBreak();
+            if (hintedSystemEnds) {
+                hintOverflow = computeSpacingForFullSystem() > targetSystemWidth;
+            }
+        }
+
+        bool doBreak = (hintOverflow || (!skipFitting && curSysWidth > targetSystemWidth && !ctx.state().prevMeasure()->noBreak()))
+                       && system->measures().size() > 1;
         if (doBreak) {
             breakMeasure = ctx.mutState().curMeasure();
             system->removeLastMeasure();
             ctx.mutState().curMeasure()->setParent(oldSystem);
-            while (ctx.state().prevMeasure() && ctx.state().prevMeasure()->noBreak() && system->measures().size() > 1) {
+            while (system->measures().size() > 1 && ctx.state().prevMeasure()
+                   && (ctx.state().prevMeasure()->noBreak() || (hintOverflow && computeSpacingForFullSystem() > targetSystemWidth))) {
                 ctx.mutState().setTick(ctx.state().tick() - ctx.state().curMeasure()->ticks());
                 ctx.mutState().setMeasureNo(ctx.state().curMeasure()->no());
 
@@ -235,8 +285,8 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
 
             MeasureLayout::updateGraceNotes(m, ctx);
 
-            if (!systemLock) {
-                curSysWidth = HorizontalSpacing::updateSpacingForLastAddedMeasure(system);
+            if (!skipFitting) {
+                curSysWidth = updateSpacingForLastAddedMeasure();
             }
         }
 
@@ -247,7 +297,8 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
         case LayoutMode::PAGE:
         case LayoutMode::SYSTEM:
             lineBreak = mb->pageBreak() || mb->lineBreak() || mb->sectionBreak() || mb->isEndOfSystemLock()
-                        || (next && next->isStartOfSystemLock());
+                        || (next && next->isStartOfSystemLock())
+                        || (breakHintEndTick >= 0 && mb->endTick().ticks() >= breakHintEndTick);
             break;
         case LayoutMode::FLOAT:
         case LayoutMode::LINE:
@@ -394,15 +445,19 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
 
     updateBigTimeSigIfNeeded(system, ctx);
 
-    // Recompute spacing to account for the last changes (barlines, hidden staves, etc)
-    curSysWidth = HorizontalSpacing::computeSpacingForFullSystem(system);
+    {
+        LayoutPassTimer spacingTimer(passTimes.horizontalSpacing);
 
-    if (curSysWidth > targetSystemWidth) {
-        HorizontalSpacing::squeezeSystemToFit(system, curSysWidth, targetSystemWidth);
-    }
+        // Recompute spacing to account for the last changes (barlines, hidden staves, etc)
+        curSysWidth = HorizontalSpacing::computeSpacingForFullSystem(system);
+
+        if (curSysWidth > targetSystemWidth) {
+            HorizontalSpacing::squeezeSystemToFit(system, curSysWidth, targetSystemWidth);
+        }
 
-    if (shouldBeJustified(system, curSysWidth, targetSystemWidth, ctx)) {
-        HorizontalSpacing::justifySystem(system, curSysWidth, targetSystemWidth);
+        if (shouldBeJustified(system, curSysWidth, targetSystemWidth, ctx)) {
+            HorizontalSpacing::justifySystem(system, curSysWidth, targetSystemWidth);
+        }
     }
 
     // LAYOUT MEASURES
@@ -509,6 +564,7 @@ System* SystemLayout::getNextSystem(LayoutContext& ctx)
         system->clear();       // remove measures from system
     }
     ctx.mutDom().systems().push_back(system);
+    ctx.mutState().incrementCollectedSystemCount();
     if (!isVBox) {
         size_t nstaves = ctx.dom().nstaves();
         system->adjustStavesNumber(nstaves);
@@ -1538,112 +1594,168 @@ void SystemLayout::collectSpannersToLayout(ElementsToLayout& elements, const Lay
 
 void SystemLayout::createSkylines(const ElementsToLayout& elementsToLayout, LayoutContext& ctx)
 {
-    System* system = elementsToLayout.system;
-    for (size_t staffIdx = 0; staffIdx < ctx.dom().nstaves(); ++staffIdx) {
-        SysStaff* ss = system->staff(staffIdx);
-        Skyline& skyline = ss->skyline();
-        skyline.clear();
-        for (Measure* m : elementsToLayout.measures) {
-            if (m->staffLines(staffIdx)->addToSkyline()) {
-                ss->skyline().add(m->staffLines(staffIdx)->ldata()->bbox().translated(m->pos()), m->staffLines(staffIdx));
-            }
-            for (Segment& s : m->segments()) {
-                if (!s.enabled()) {
+    const size_t nstaves = ctx.dom().nstaves();
+
+#ifdef MUSE_THREADS_SUPPORT
+    if (ctx.conf().isParallelLayout() && nstaves >= MIN_STAVES_FOR_PARALLEL_SKYLINES) {
+        //! NOTE The shapes of chords and rests are filled in when they are requested,
+        //! so they are filled here, and the tasks only read them.
+        //! Each task writes only to the skyline of its own staff, so the result doesn't depend on the order of the tasks
+        fillSkylineShapes(elementsToLayout);
+
+        std::vector<std::future<void> > futures;
+        futures.reserve(nstaves);
+
+        for (staff_idx_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
+            futures.push_back(layoutTaskScheduler()->submit(&SystemLayout::createSkyline, std::cref(elementsToLayout), staffIdx,
+                                                            LD_ACCESS::PASS));
+        }
+
+        for (std::future<void>& future : futures) {
+            future.get();
+        }
+
+        return;
+    }
+#endif
+
+    for (staff_idx_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
+        createSkyline(elementsToLayout, staffIdx);
+    }
+}
+
+void SystemLayout::fillSkylineShapes(const ElementsToLayout& elementsToLayout)
+{
+    // Requests the same shapes as createSkyline does, in the same order
+    for (Measure* m : elementsToLayout.measures) {
+        for (Segment& s : m->segments()) {
+            if (!s.enabled() || s.isType(SegmentType::BarLineType) || s.isType(SegmentType::TimeSigType)) {
+                continue;
+            }
+            for (EngravingItem* e : s.elist()) {
+                if (!e || !e->addToSkyline()) {
                     continue;
                 }
-                PointF p(s.pos() + m->pos());
-                if (s.isType(SegmentType::BarLineType)) {
-                    BarLine* bl = toBarLine(s.element(staffIdx * VOICES));
-                    if (bl && bl->addToSkyline()) {
-                        skyline.add(bl->shape().translated(bl->pos() + p + bl->staffOffset()));
+                e->shape();
+
+                if (e->isChord()) {
+                    Ornament* ornament = toChord(e)->findOrnament();
+                    Chord* cue = ornament ? ornament->cueNoteChord() : nullptr;
+                    if (cue && cue->upNote()->visible()) {
+                        cue->shape();
                     }
-                } else if (s.isType(SegmentType::TimeSigType)) {
-                    TimeSig* ts = toTimeSig(s.element(staffIdx * VOICES));
-                    if (ts && ts->addToSkyline() && ts->showOnThisStaff()) {
-                        TimeSigPlacement timeSigPlacement = ts->style().styleV(Sid::timeSigPlacement).value<TimeSigPlacement>();
-                        if (timeSigPlacement != TimeSigPlacement::ACROSS_STAVES) {
-                            skyline.add(ts->shape().translate(ts->pos() + p + ts->staffOffset()));
-                        }
+                }
+            }
+        }
+    }
+}
+
+void SystemLayout::createSkyline(const ElementsToLayout& elementsToLayout, staff_idx_t staffIdx, LD_ACCESS shapeAccess)
+{
+    System* system = elementsToLayout.system;
+    SysStaff* ss = system->staff(staffIdx);
+    Skyline& skyline = ss->skyline();
+    skyline.clear();
+    for (Measure* m : elementsToLayout.measures) {
+        if (m->staffLines(staffIdx)->addToSkyline()) {
+            ss->skyline().add(m->staffLines(staffIdx)->ldata()->bbox().translated(m->pos()), m->staffLines(staffIdx));
+        }
+        for (Segment& s : m->segments()) {
+            if (!s.enabled()) {
+                continue;
+            }
+            PointF p(s.pos() + m->pos());
+            if (s.isType(SegmentType::BarLineType)) {
+                BarLine* bl = toBarLine(s.element(staffIdx * VOICES));
+                if (bl && bl->addToSkyline()) {
+                    skyline.add(bl->shape().translated(bl->pos() + p + bl->staffOffset()));
+                }
+            } else if (s.isType(SegmentType::TimeSigType)) {
+                TimeSig* ts = toTimeSig(s.element(staffIdx * VOICES));
+                if (ts && ts->addToSkyline() && ts->showOnThisStaff()) {
+                    TimeSigPlacement timeSigPlacement = ts->style().styleV(Sid::timeSigPlacement).value<TimeSigPlacement>();
+                    if (timeSigPlacement != TimeSigPlacement::ACROSS_STAVES) {
+                        skyline.add(ts->shape().translate(ts->pos() + p + ts->staffOffset()));
+                    }
+                }
+            } else {
+                track_idx_t strack = staffIdx * VOICES;
+                track_idx_t etrack = strack + VOICES;
+                for (EngravingItem* e : s.elist()) {
+                    if (!e) {
+                        continue;
+                    }
+                    track_idx_t effectiveTrack = e->vStaffIdx() * VOICES + e->voice();
+                    if (effectiveTrack < strack || effectiveTrack >= etrack) {
+                        continue;
                     }
-                } else {
-                    track_idx_t strack = staffIdx * VOICES;
-                    track_idx_t etrack = strack + VOICES;
-                    for (EngravingItem* e : s.elist()) {
-                        if (!e) {
-                            continue;
-                        }
-                        track_idx_t effectiveTrack = e->vStaffIdx() * VOICES + e->voice();
-                        if (effectiveTrack < strack || effectiveTrack >= etrack) {
-                            continue;
-                        }
 
-                        // add element to skyline
-                        if (e->addToSkyline()) {
-                            const PointF offset = e->staffOffset();
-                            Shape shape = e->shape();
-                            // add grace notes to skyline
-                            if (e->isChord()) {
-                                Chord* chord = toChord(e);
-                                GraceNotesGroup& graceBefore = chord->graceNotesBefore();
-                                GraceNotesGroup& graceAfter = chord->graceNotesAfter();
-                                if (!graceBefore.empty()) {
-                                    skyline.add(graceBefore.shape().translate(graceBefore.pos() + p + offset));
-                                }
-                                if (!graceAfter.empty()) {
-                                    skyline.add(graceAfter.shape().translate(graceAfter.pos() + p + offset));
-                                }
+                    // add element to skyline
+                    if (e->addToSkyline()) {
+                        const PointF offset = e->staffOffset();
+                        Shape shape = e->shape(shapeAccess);
+                        // add grace notes to skyline
+                        if (e->isChord()) {
+                            Chord* chord = toChord(e);
+                            GraceNotesGroup& graceBefore = chord->graceNotesBefore();
+                            GraceNotesGroup& graceAfter = chord->graceNotesAfter();
+                            if (!graceBefore.empty()) {
+                                skyline.add(graceBefore.shape().translate(graceBefore.pos() + p + offset));
+                            }
+                            if (!graceAfter.empty()) {
+                                skyline.add(graceAfter.shape().translate(graceAfter.pos() + p + offset));
+                            }
 
-                                // If present, add ornament cue note to skyline
-                                Ornament* ornament = chord->findOrnament();
-                                if (ornament) {
-                                    Chord* cue = ornament->cueNoteChord();
-                                    if (cue && cue->upNote()->visible()) {
-                                        skyline.add(cue->shape().translate(cue->pos() + p + cue->staffOffset()));
-                                    }
+                            // If present, add ornament cue note to skyline
+                            Ornament* ornament = chord->findOrnament();
+                            if (ornament) {
+                                Chord* cue = ornament->cueNoteChord();
+                                if (cue && cue->upNote()->visible()) {
+                                    skyline.add(cue->shape(shapeAccess).translate(cue->pos() + p + cue->staffOffset()));
                                 }
+                            }
 
-                                // Don't include cross-staff arpeggios
-                                shape.remove_if([chord](ShapeElement& s) {
-                                    return s.item()->isArpeggio() && toArpeggio(s.item()) == chord->spanArpeggio();
-                                });
-                                Arpeggio* arp = chord->spanArpeggio();
-                                if (arp) {
-                                    RectF staffBbox = ss->bbox();
-                                    RectF arpBbox = arp->ldata()->bbox().translated(e->pos() + p + offset);
-                                    if (chord->track() == arp->track()) {
-                                        staffBbox.setTop(arpBbox.top());
-                                    } else if (chord->track() == arp->endTrack()) {
-                                        staffBbox.setBottom(arpBbox.bottom());
-                                    }
-                                    shape.add(arpBbox & staffBbox, arp);
+                            // Don't include cross-staff arpeggios
+                            shape.remove_if([chord](ShapeElement& s) {
+                                return s.item()->isArpeggio() && toArpeggio(s.item()) == chord->spanArpeggio();
+                            });
+                            Arpeggio* arp = chord->spanArpeggio();
+                            if (arp) {
+                                RectF staffBbox = ss->bbox();
+                                RectF arpBbox = arp->ldata()->bbox().translated(e->pos() + p + offset);
+                                if (chord->track() == arp->track()) {
+                                    staffBbox.setTop(arpBbox.top());
+                                } else if (chord->track() == arp->endTrack()) {
+                                    staffBbox.setBottom(arpBbox.bottom());
                                 }
+                                shape.add(arpBbox & staffBbox, arp);
                             }
-                            skyline.add(shape.translate(e->pos() + p + offset));
                         }
+                        skyline.add(shape.translate(e->pos() + p + offset));
+                    }
 
-                        // add tremolo to skyline
-                        if (e->isChord()) {
-                            Chord* ch = item_cast<Chord*>(e);
-                            // tremoloSingleChord is added directly to chord shape
-                            if (ch->tremoloTwoChord()) {
-                                TremoloTwoChord* t = ch->tremoloTwoChord();
-                                Chord* c1 = t->chord1();
-                                Chord* c2 = t->chord2();
-                                if (c1 && !c1->staffMove() && c2 && !c2->staffMove()) {
-                                    if (t->chord() == e && t->addToSkyline()) {
-                                        skyline.add(t->shape().translate(t->pos() + e->pos() + p));
-                                    }
+                    // add tremolo to skyline
+                    if (e->isChord()) {
+                        Chord* ch = item_cast<Chord*>(e);
+                        // tremoloSingleChord is added directly to chord shape
+                        if (ch->tremoloTwoChord()) {
+                            TremoloTwoChord* t = ch->tremoloTwoChord();
+                            Chord* c1 = t->chord1();
+                            Chord* c2 = t->chord2();
+                            if (c1 && !c1->staffMove() && c2 && !c2->staffMove()) {
+                                if (t->chord() == e && t->addToSkyline()) {
+                                    skyline.add(t->shape().translate(t->pos() + e->pos() + p));
                                 }
                             }
                         }
+                    }
 
-                        // add beams to skline
-                        if (e->isChordRest()) {
-                            ChordRest* cr = toChordRest(e);
-                            if (BeamLayout::isStartOfNonCrossBeam(cr)) {
-                                Beam* b = cr->beam();
-                                b->addSkyline(skyline);
-                            }
+                    // add beams to skline
+                    if (e->isChordRest()) {
+                        ChordRest* cr = toChordRest(e);
+                        if (BeamLayout::isStartOfNonCrossBeam(cr)) {
+                            Beam* b = cr->beam();
+                            b->addSkyline(skyline);
                         }
                     }
                 }
@@ -172,6 +172,8 @@ private:
 
     static System* getNextSystem(LayoutContext& lc);
     static void createSkylines(const ElementsToLayout& elementsToLayout, LayoutContext& ctx);
+    static void fillSkylineShapes(const ElementsToLayout& elementsToLayout);
+    static void createSkyline(const ElementsToLayout& elementsToLayout, staff_idx_t staffIdx, LD_ACCESS shapeAccess = LD_ACCESS::CHECK);
     static void processLines(System* system, LayoutContext& ctx, const std::vector<Spanner*>& lines, bool align = false);
     static void layoutTies(Chord* ch, System* system, const Fraction& stick, LayoutContext& ctx);
     static void doLayoutTies(System* system, const std::vector<Segment*>& sl, const Fraction& stick, const Fraction& etick,
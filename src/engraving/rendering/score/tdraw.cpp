@@ -431,9 +431,15 @@ void TDraw::draw(const Accidental* item, Painter* painter, const PaintOptions& o
     }
 
     painter->setPen(item->curColor(opt));
+
+    SymIdList syms;
+    std::vector<PointF> positions;
     for (const Accidental::LayoutData::Sym& e : item->ldata()->syms) {
-        item->drawSymbol(e.sym, painter, PointF(e.x, e.y));
+        syms.push_back(e.sym);
+        positions.emplace_back(e.x, e.y);
     }
+
+    item->drawSymbols(syms, painter, positions);
 }
 
 void TDraw::draw(const ActionIcon* item, Painter* painter, const PaintOptions&)
@@ -1968,10 +1974,25 @@ void TDraw::draw(const KeySig* item, Painter* painter, const PaintOptions& opt)
     int lines = item->staff() ? item->staff()->staffTypeForElement(item)->lines() : 5;
     double ledgerLineWidth = item->style().styleMM(Sid::ledgerLineWidth) * item->mag();
     double ledgerExtraLen = item->style().styleS(Sid::ledgerLineLength).val() * _spatium;
+
+    //! NOTE Symbols are drawn as runs, the ledger lines of a symbol are drawn right after it, before the next symbols
+    SymIdList syms;
+    std::vector<PointF> positions;
     for (const KeySym& ks : ldata->keySymbols) {
         double x = ks.xPos * _spatium;
         double y = ks.line * step;
-        item->drawSymbol(ks.sym, painter, PointF(x, y));
+        syms.push_back(ks.sym);
+        positions.emplace_back(x, y);
+
+        bool hasLedgerLines = ks.line <= -2 || ks.line >= lines * 2;
+        if (!hasLedgerLines) {
+            continue;
+        }
+
+        item->drawSymbols(syms, painter, positions);
+        syms.clear();
+        positions.clear();
+
         // ledger lines
         double _symWidth = item->symWidth(ks.sym);
         double x1 = x - ledgerExtraLen;
@@ -1986,6 +2007,8 @@ void TDraw::draw(const KeySig* item, Painter* painter, const PaintOptions& opt)
             painter->drawLine(LineF(x1, y, x2, y));
         }
     }
+
+    item->drawSymbols(syms, painter, positions);
 }
 
 void TDraw::draw(const LaissezVibSegment* item, muse::draw::Painter* painter, const PaintOptions& opt)
@@ -2505,11 +2528,14 @@ void TDraw::draw(const ShadowNote* item, Painter* painter, const PaintOptions&)
             posDot.rx() = std::max(posDot.x(), noteheadWidth + item->symBbox(item->flagSym()).right());
         }
 
+        SymIdList dots;
+        std::vector<PointF> positions;
         for (int i = 0; i < item->duration().dots(); i++) {
-            posDot.rx() += dd * i;
-            item->drawSymbol(SymId::augmentationDot, painter, posDot);
-            posDot.rx() -= dd * i;
+            dots.push_back(SymId::augmentationDot);
+            positions.emplace_back(posDot.x() + dd * i, posDot.y());
         }
+
+        item->drawSymbols(dots, painter, positions);
     }
 
     // Draw stem and flag
@@ -2770,9 +2796,14 @@ void TDraw::draw(const Stem* item, Painter* painter, const PaintOptions& opt)
         double x     = item->chord()->dotPosX();
         double y     = ((StemLayout::STAFFTYPE_TAB_DEFAULTSTEMLEN_DN * 0.2) * sp) * (isUp ? -1.0 : 1.0);
         double step  = item->style().styleS(Sid::dotDotDistance).val() * sp;
+        SymIdList dots;
+        std::vector<PointF> positions;
         for (int dot = 0; dot < nDots; dot++, x += step) {
-            item->drawSymbol(SymId::augmentationDot, painter, PointF(x, y));
+            dots.push_back(SymId::augmentationDot);
+            positions.emplace_back(x, y);
         }
+
+        item->drawSymbols(dots, painter, positions);
     }
 }
 
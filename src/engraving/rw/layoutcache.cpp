@@ -0,0 +1,202 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "layoutcache.h"
+
+#include <cstring>
+
+#include <set>
+
+#include "draw/fontmetrics.h"
+
+#include "../dom/masterscore.h"
+#include "../dom/system.h"
+#include "../style/textstyle.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace mu::engraving;
+using namespace mu::engraving::rw;
+
+static constexpr char MAGIC[] = { 'M', 'S', 'L', 'C' };
+static constexpr uint32_t FORMAT_VERSION = 2;
+
+static void writeUInt32(ByteArray& data, uint32_t v)
+{
+    for (int i = 0; i < 4; ++i) {
+        data.push_back(static_cast<uint8_t>(v >> (i * 8)));
+    }
+}
+
+static bool readUInt32(const ByteArray& data, size_t& pos, uint32_t& v)
+{
+    if (pos + 4 > data.size()) {
+        return false;
+    }
+
+    v = 0;
+    for (int i = 0; i < 4; ++i) {
+        v |= static_cast<uint32_t>(data.at(pos + i)) << (i * 8);
+    }
+    pos += 4;
+    return true;
+}
+
+LayoutCache::SystemBreaks LayoutCache::systemBreaks(const MasterScore* score)
+{
+    SystemBreaks breaks;
+    if (!score->isLayoutMode(LayoutMode::PAGE)) {
+        return breaks;
+    }
+
+    for (const System* system : score->systems()) {
+        if (system->measures().empty() || system->measures().front()->isVBoxBase()) {
+            continue;
+        }
+
+        breaks.emplace(system->measures().front()->tick().ticks(), system->measures().back()->endTick().ticks());
+    }
+
+    return breaks;
+}
+
+ByteArray LayoutCache::fontIdentity(const MasterScore* score)
+{
+    //! NOTE The font names are in the style data already, but a font of the same name
+    //! may be another version or be substituted, so the metrics the layout depends on are added
+    static const String PROBE_TEXT = u"Hxgf 1234";
+    static const std::vector<SymId> PROBE_SYMBOLS = {
+        SymId::noteheadBlack, SymId::gClef, SymId::accidentalSharp, SymId::stem, SymId::flag8thUp
+    };
+
+    String identity;
+
+    if (const std::shared_ptr<IEngravingFont> font = score->engravingFont()) {
+        identity += String::fromStdString(font->name()) + u'|' + String::fromStdString(font->family());
+        for (SymId id : PROBE_SYMBOLS) {
+            const RectF bbox = font->bbox(id, 1.0);
+            identity += u'|' + String::number(bbox.x()) + u',' + String::number(bbox.y())
+                        + u',' + String::number(bbox.width()) + u',' + String::number(bbox.height())
+                        + u',' + String::number(font->advance(id, 1.0));
+        }
+    }
+
+    std::set<String> families;
+    for (TextStyleType type : allTextStyles()) {
+        for (const TextStyleProperty& property : *textStyle(type)) {
+            if (property.pid == Pid::FONT_FACE) {
+                families.insert(score->style().styleSt(property.sid));
+            }
+        }
+    }
+
+    for (const String& family : families) {
+        const muse::draw::FontMetrics metrics(muse::draw::Font(family, muse::draw::Font::Type::Text));
+        identity += u'|' + family + u',' + String::number(metrics.lineSpacing()) + u',' + String::number(metrics.xHeight())
+                    + u',' + String::number(metrics.horizontalAdvance(PROBE_TEXT));
+    }
+
+    return identity.toUtf8();
+}
+
+ByteArray LayoutCache::sourceHash(const MasterScore* score, const ByteArray& scoreData, const ByteArray& styleData) const
+{
+    ByteArray source;
+    source.push_back(reinterpret_cast<const uint8_t*>(MAGIC), sizeof(MAGIC));
+    writeUInt32(source, FORMAT_VERSION);
+
+    //! NOTE Another build may lay out the same score differently
+    if (application()) {
+        source.push_back(application()->version().toString().toUtf8());
+        source.push_back(application()->revision().toUtf8());
+    }
+
+    source.push_back(fontIdentity(score));
+    source.push_back(cryptographicHash()->hash(scoreData, ICryptographicHash::Algorithm::Md4));
+    source.push_back(cryptographicHash()->hash(styleData, ICryptographicHash::Algorithm::Md4));
+
+    return cryptographicHash()->hash(source, ICryptographicHash::Algorithm::Md4);
+}
+
+ByteArray LayoutCache::write(const SystemBreaks& breaks, const MasterScore* score, const ByteArray& scoreData,
+                             const ByteArray& styleData) const
+{
+    ByteArray hash = sourceHash(score, scoreData, styleData);
+
+    ByteArray data;
+    data.reserve(sizeof(MAGIC) + 4 + 4 + hash.size() + 4 + breaks.size() * 8);
+    data.push_back(reinterpret_cast<const uint8_t*>(MAGIC), sizeof(MAGIC));
+    writeUInt32(data, FORMAT_VERSION);
+    writeUInt32(data, static_cast<uint32_t>(hash.size()));
+    data.push_back(hash);
+    writeUInt32(data, static_cast<uint32_t>(breaks.size()));
+    for (const auto& p : breaks) {
+        writeUInt32(data, static_cast<uint32_t>(p.first));
+        writeUInt32(data, static_cast<uint32_t>(p.second));
+    }
+
+    return data;
+}
+
+LayoutCache::SystemBreaks LayoutCache::read(const ByteArray& data, const MasterScore* score, const ByteArray& scoreData,
+                                            const ByteArray& styleData) const
+{
+    if (data.size() < sizeof(MAGIC) || std::memcmp(data.constData(), MAGIC, sizeof(MAGIC)) != 0) {
+        return SystemBreaks();
+    }
+
+    size_t pos = sizeof(MAGIC);
+    uint32_t version = 0;
+    uint32_t hashSize = 0;
+    if (!readUInt32(data, pos, version) || version != FORMAT_VERSION
+        || !readUInt32(data, pos, hashSize) || pos + hashSize > data.size()) {
+        return SystemBreaks();
+    }
+
+    ByteArray hash = ByteArray::fromRawData(data.constData() + pos, hashSize);
+    pos += hashSize;
+    if (hash != sourceHash(score, scoreData, styleData)) {
+        LOGD() << "layout cache is outdated, ignored";
+        return SystemBreaks();
+    }
+
+    uint32_t count = 0;
+    if (!readUInt32(data, pos, count) || pos + static_cast<size_t>(count) * 8 != data.size()) {
+        return SystemBreaks();
+    }
+
+    SystemBreaks breaks;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t startTick = 0;
+        uint32_t endTick = 0;
+        readUInt32(data, pos, startTick);
+        readUInt32(data, pos, endTick);
+
+        if (static_cast<int>(endTick) <= static_cast<int>(startTick)) {
+            return SystemBreaks();
+        }
+
+        breaks.emplace(static_cast<int>(startTick), static_cast<int>(endTick));
+    }
+
+    return breaks;
+}
@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <map>
+
+#include "global/types/bytearray.h"
+#include "global/modularity/ioc.h"
+#include "global/icryptographichash.h"
+#include "global/iapplication.h"
+
+namespace mu::engraving {
+class MasterScore;
+}
+
+namespace mu::engraving::rw {
+//! NOTE Binary sidecar of the .mscz with the system breaks of the page layout at the time of saving.
+//! It is only valid for exactly the score and style data it was written with, by the same build of the app
+//! and with the same fonts (the check is a hash of them), otherwise it is ignored and the score is laid out as usual.
+class LayoutCache
+{
+    muse::GlobalInject<muse::ICryptographicHash> cryptographicHash;
+    muse::GlobalInject<muse::IApplication> application;
+
+public:
+    //! start tick -> end tick of each system
+    using SystemBreaks = std::map<int, int>;
+
+    static SystemBreaks systemBreaks(const MasterScore* score);
+
+    muse::ByteArray write(const SystemBreaks& breaks, const MasterScore* score, const muse::ByteArray& scoreData,
+                          const muse::ByteArray& styleData) const;
+    SystemBreaks read(const muse::ByteArray& data, const MasterScore* score, const muse::ByteArray& scoreData,
+                      const muse::ByteArray& styleData) const;
+
+private:
+    muse::ByteArray sourceHash(const MasterScore* score, const muse::ByteArray& scoreData, const muse::ByteArray& styleData) const;
+    static muse::ByteArray fontIdentity(const MasterScore* score);
+};
+}
@@ -21,6 +21,8 @@
  */
 #include "mscloader.h"
 
+#include <chrono>
+#include <future>
 #include <memory>
 
 #include "global/io/buffer.h"
@@ -41,6 +43,13 @@
 #include "rwregister.h"
 #include "xmlreader.h"
 #include "inoutdata.h"
+#include "layoutcache.h"
+
+#include "muse_framework_config.h"
+
+#ifdef MUSE_THREADS_SUPPORT
+#include "concurrency/taskscheduler.h"
+#endif
 
 #include "log.h"
 
@@ -69,6 +78,48 @@ static RetVal<IReaderPtr> makeReader(int version, bool ignoreVersionError)
     return RetVal<IReaderPtr>::make_ok(RWRegister::reader(version));
 }
 
+using Clock = std::chrono::steady_clock;
+
+static double msecsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+using XmlReaderPtr = std::unique_ptr<XmlReader>;
+
+struct ParsedExcerpt {
+    XmlReaderPtr xml;
+    size_t bytes = 0;
+    double parseTimeMs = 0.0;
+};
+
+//! NOTE Creating the reader parses the whole document
+static ParsedExcerpt parseExcerpt(ByteArray&& data, const String& docName)
+{
+    Clock::time_point start = Clock::now();
+
+    ParsedExcerpt excerpt;
+    excerpt.bytes = data.size();
+    excerpt.xml = std::make_unique<XmlReader>(std::move(data));
+    excerpt.xml->setDocName(docName);
+    excerpt.parseTimeMs = msecsSince(start);
+
+    return excerpt;
+}
+
+#ifdef MUSE_THREADS_SUPPORT
+static muse::TaskScheduler* readTaskScheduler()
+{
+    static muse::TaskScheduler scheduler;
+    return &scheduler;
+}
+#endif
+
+const std::vector<MscLoader::ComponentStatistics>& MscLoader::statistics() const
+{
+    return m_statistics;
+}
+
 Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, SettingsCompat& settingsCompat,
                         bool ignoreVersionError, rw::ReadInOutData* inOut)
 {
@@ -82,10 +133,15 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
 
     ScoreLoad sl;
 
+    m_statistics.clear();
+
+    ByteArray styleData;
+
     if (mscReader.isContainer()) {
         // Read style
         {
-            ByteArray styleData = mscReader.readStyleFile();
+            Clock::time_point start = Clock::now();
+            styleData = mscReader.readStyleFile();
             if (!styleData.empty()) {
                 Buffer buf(&styleData);
                 buf.open(IODevice::ReadOnly);
@@ -94,10 +150,13 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
                     inOut->originalSpatium = masterScore->style().spatium();
                 }
             }
+
+            m_statistics.push_back({ u"style", styleData.size(), msecsSince(start) });
         }
 
         // Read ChordList
         {
+            Clock::time_point start = Clock::now();
             bool chordListOk = false;
             ByteArray chordListData = mscReader.readChordListFile();
             if (!chordListData.empty()) {
@@ -120,15 +179,24 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
                 // Ensure that `checkChordList` loads the default chord list
                 chordList->unload();
             }
+
+            m_statistics.push_back({ u"chordlist", chordListData.size(), msecsSince(start) });
         }
 
         // Read images
         {
             if (!MScore::noImages) {
+                Clock::time_point start = Clock::now();
+                size_t bytes = 0;
+
                 std::vector<String> images = mscReader.imageFileNames();
                 for (const String& name : images) {
-                    imageStore.add(name, mscReader.readImageFile(name));
+                    ByteArray imageData = mscReader.readImageFile(name);
+                    bytes += imageData.size();
+                    imageStore.add(name, imageData);
                 }
+
+                m_statistics.push_back({ u"images", bytes, msecsSince(start) });
             }
         }
     }
@@ -142,6 +210,7 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
 
     // Read score
     {
+        Clock::time_point start = Clock::now();
         ByteArray scoreData = mscReader.readScoreFile();
         String docName = masterScore->fileInfo()->fileName().toString();
 
@@ -151,12 +220,50 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
         xml.setDocName(docName);
 
         ret = readMasterScore(masterScore, xml, ignoreVersionError, inOut, &styleHook);
+
+        m_statistics.push_back({ u"score", scoreData.size(), msecsSince(start) });
+
+        // Read layout cache
+        if (ret && mscReader.isContainer() && configuration()->layoutCacheEnabled()) {
+            ByteArray layoutCacheData = mscReader.readLayoutCacheFile();
+            if (!layoutCacheData.empty()) {
+                masterScore->setSystemBreakHints(LayoutCache().read(layoutCacheData, masterScore, scoreData, styleData));
+            }
+        }
     }
 
     // Read excerpts
     if (ret && masterScore->mscVersion() >= 400 && mscReader.isContainer()) {
         std::vector<String> excerptFileNames = mscReader.excerptFileNames();
-        for (const String& excerptFileName : excerptFileNames) {
+
+        //! NOTE In the parallel mode the xml of the excerpts is parsed on the scheduler threads.
+        //! Parsing touches nothing but the data of the excerpt, which is read from the container
+        //! on this thread, as the container is not thread safe. Creating the elements and linking
+        //! them to the master score is still done on this thread, in the order of the excerpt files
+        std::vector<std::future<ParsedExcerpt> > parsedExcerpts;
+#ifdef MUSE_THREADS_SUPPORT
+        if (configuration()->parallelReadingEnabled() && excerptFileNames.size() > 1) {
+            parsedExcerpts.reserve(excerptFileNames.size());
+            for (const String& excerptFileName : excerptFileNames) {
+                ByteArray excerptData = mscReader.readExcerptFile(excerptFileName);
+                parsedExcerpts.push_back(readTaskScheduler()->submit([excerptData = std::move(excerptData), excerptFileName]() mutable {
+                    return parseExcerpt(std::move(excerptData), excerptFileName);
+                }));
+            }
+        }
+#endif
+
+        for (size_t i = 0; i < excerptFileNames.size(); ++i) {
+            const String& excerptFileName = excerptFileNames.at(i);
+
+            ParsedExcerpt parsed;
+            if (i < parsedExcerpts.size()) {
+                parsed = parsedExcerpts.at(i).get();
+            } else {
+                parsed = parseExcerpt(mscReader.readExcerptFile(excerptFileName), excerptFileName);
+            }
+
+            Clock::time_point start = Clock::now();
             Score* partScore = masterScore->createScore();
 
             compat::ReadStyleHook::setupDefaultStyle(partScore);
@@ -170,11 +277,6 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
             excerptStyleBuf.open(IODevice::ReadOnly);
             partScore->style().read(&excerptStyleBuf);
 
-            ByteArray excerptData = mscReader.readExcerptFile(excerptFileName);
-
-            XmlReader xml(excerptData);
-            xml.setDocName(excerptFileName);
-
             ReadInOutData partReadInData;
             partReadInData.links = inOut->links;
 
@@ -184,7 +286,7 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
                 break;
             }
 
-            ret = reader.val->readScoreFile(partScore, xml, &partReadInData);
+            ret = reader.val->readScoreFile(partScore, *parsed.xml, &partReadInData);
             if (!ret) {
                 break;
             }
@@ -204,6 +306,9 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
             }
 
             masterScore->addExcerpt(ex);
+
+            size_t bytes = excerptStyleData.size() + parsed.bytes;
+            m_statistics.push_back({ u"Excerpts/" + excerptFileName, bytes, parsed.parseTimeMs + msecsSince(start) });
         }
     }
 
@@ -214,11 +319,21 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, Se
     //  Read audio
     {
         if (masterScore->audio()) {
+            Clock::time_point start = Clock::now();
             ByteArray dbuf1 = mscReader.readAudioFile();
             masterScore->audio()->setData(dbuf1);
+
+            m_statistics.push_back({ u"audio", dbuf1.size(), msecsSince(start) });
         }
     }
 
+    const MscReader::ReadStatistics& readStats = mscReader.readStatistics();
+    LOGD() << "files read: " << readStats.filesRead << ", bytes: " << readStats.bytesRead
+           << ", read time: " << readStats.readTimeMs << " ms";
+    for (const ComponentStatistics& stats : m_statistics) {
+        LOGD() << stats.name << ": " << stats.bytes << " bytes, " << stats.parseTimeMs << " ms";
+    }
+
     settingsCompat = std::move(inOut->settingsCompat);
 
     return ret;
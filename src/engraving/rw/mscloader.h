@@ -22,8 +22,12 @@
 #ifndef MU_ENGRAVING_MSCLOADER_H
 #define MU_ENGRAVING_MSCLOADER_H
 
+#include <vector>
+
 #include "global/types/ret.h"
+#include "global/modularity/ioc.h"
 
+#include "../iengravingconfiguration.h"
 #include "../infrastructure/mscreader.h"
 #include "../types/types.h"
 
@@ -40,16 +44,32 @@ class MasterScore;
 class XmlReader;
 class MscLoader
 {
+    muse::GlobalInject<IEngravingConfiguration> configuration;
+
 public:
     MscLoader() = default;
 
+    struct ComponentStatistics
+    {
+        muse::String name;
+        size_t bytes = 0;
+        double parseTimeMs = 0.0;
+    };
+
     muse::Ret loadMscz(MasterScore* score, const MscReader& mscReader, SettingsCompat& settingsCompat, bool ignoreVersionError,
                        rw::ReadInOutData* out = nullptr);
 
+    //! NOTE Sizes and parse times of the parts of the last loaded file,
+    //! the time includes reading the data from the container, except for the excerpts:
+    //! their xml may be parsed in parallel, so only the time spent on each one is counted
+    const std::vector<ComponentStatistics>& statistics() const;
+
 private:
     friend class MasterScore;
     muse::Ret readMasterScore(MasterScore* score, XmlReader&, bool ignoreVersionError, rw::ReadInOutData* out = nullptr,
                               compat::ReadStyleHook* styleHook = nullptr);
+
+    std::vector<ComponentStatistics> m_statistics;
 };
 }
 
@@ -30,6 +30,7 @@
 
 #include "rwregister.h"
 #include "inoutdata.h"
+#include "layoutcache.h"
 
 #include "log.h"
 
@@ -48,11 +49,13 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool createTh
         return false;
     }
 
+    ByteArray styleData;
+    ByteArray scoreData;
+
     // Write style of MasterScore
     {
         //! NOTE The style is writing to a separate file only for the master score.
         //! At the moment, the style for the parts is still writing to the score file.
-        ByteArray styleData;
         Buffer styleBuf(&styleData);
         styleBuf.open(IODevice::WriteOnly);
         score->style().write(&styleBuf);
@@ -67,7 +70,6 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool createTh
 
     // Write MasterScore
     {
-        ByteArray scoreData;
         Buffer scoreBuf(&scoreData);
         scoreBuf.open(IODevice::ReadWrite);
 
@@ -76,6 +78,17 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool createTh
         mscWriter.writeScoreFile(scoreData);
     }
 
+    // Write layout cache
+    {
+        //! NOTE A single .mscx has no room for other files
+        if (!range && configuration()->layoutCacheEnabled() && mscWriter.params().mode != MscIoMode::XmlFile) {
+            LayoutCache::SystemBreaks breaks = LayoutCache::systemBreaks(score);
+            if (!breaks.empty()) {
+                mscWriter.writeLayoutCacheFile(LayoutCache().write(breaks, score, scoreData, styleData));
+            }
+        }
+    }
+
     // Write Excerpts
     {
         if (!range) {
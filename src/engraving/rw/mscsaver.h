@@ -25,6 +25,7 @@
 #include "global/modularity/ioc.h"
 #include "draw/iimageprovider.h"
 
+#include "../iengravingconfiguration.h"
 #include "../infrastructure/mscwriter.h"
 
 namespace mu::engraving::write {
@@ -37,6 +38,7 @@ class Score;
 class MscSaver : public muse::Injectable
 {
     muse::Inject<muse::draw::IImageProvider> imageProvider = { this };
+    muse::Inject<IEngravingConfiguration> configuration = { this };
 public:
     MscSaver(const muse::modularity::ContextPtr& iocCtx)
         : muse::Injectable(iocCtx) {}
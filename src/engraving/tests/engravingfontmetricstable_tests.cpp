@@ -0,0 +1,264 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "global/tests/mocks/applicationmock.h"
+#include "global/tests/mocks/globalconfigurationmock.h"
+#include "io/file.h"
+
+#include "engraving/internal/engravingfont.h"
+#include "engraving/internal/engravingfontmetricstable.h"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using namespace muse;
+using namespace mu::engraving;
+
+static const io::path_t FONT_PATH(":/fonts/leland/Leland.otf");
+static const io::path_t FONT_METADATA_PATH(":/fonts/leland/metadata.json");
+static const io::path_t APP_DATA_PATH("engravingfontmetricstable_data");
+static const io::path_t TABLE_PATH = APP_DATA_PATH + "/engraving_fonts/Leland.metrics";
+
+namespace mu::engraving {
+class Engraving_EngravingFontMetricsTableTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        io::File::remove(TABLE_PATH);
+
+        m_globalConfiguration = std::make_shared<NiceMock<GlobalConfigurationMock> >();
+        ON_CALL(*m_globalConfiguration, userAppDataPath())
+        .WillByDefault(Return(APP_DATA_PATH));
+    }
+
+    void TearDown() override
+    {
+        io::File::remove(TABLE_PATH);
+    }
+
+    std::shared_ptr<EngravingFont> makeFont(const String& revision) const
+    {
+        std::shared_ptr<EngravingFont> font = std::make_shared<EngravingFont>("Leland", "Leland", FONT_PATH, FONT_METADATA_PATH,
+                                                                              modularity::globalCtx());
+        font->globalConfiguration.set(m_globalConfiguration);
+
+        std::shared_ptr<ApplicationMock> application = std::make_shared<NiceMock<ApplicationMock> >();
+        ON_CALL(*application, version())
+        .WillByDefault(Return(Version(4, 6, 0)));
+        ON_CALL(*application, revision())
+        .WillByDefault(Return(revision));
+        font->application.set(application);
+
+        return font;
+    }
+
+    static EngravingFontMetricsTable readTable()
+    {
+        ByteArray data;
+        EXPECT_TRUE(io::File::readFile(TABLE_PATH, data));
+        return EngravingFontMetricsTable::fromData(data);
+    }
+
+    static void expectSameMetrics(EngravingFont& expected, EngravingFont& actual)
+    {
+        for (size_t i = 0; i <= static_cast<size_t>(SymId::lastSym); ++i) {
+            const SymId id = static_cast<SymId>(i);
+            EXPECT_EQ(actual.symCode(id), expected.symCode(id)) << "symbol: " << i;
+            EXPECT_EQ(actual.bbox(id, 1.0), expected.bbox(id, 1.0)) << "symbol: " << i;
+            EXPECT_EQ(actual.advance(id, 1.0), expected.advance(id, 1.0)) << "symbol: " << i;
+
+            for (int anchor = 0; anchor <= static_cast<int>(SmuflAnchorId::opticalCenter); ++anchor) {
+                const SmuflAnchorId anchorId = static_cast<SmuflAnchorId>(anchor);
+                EXPECT_EQ(actual.smuflAnchor(id, anchorId, 1.0), expected.smuflAnchor(id, anchorId, 1.0))
+                    << "symbol: " << i << ", anchor: " << anchor;
+            }
+        }
+
+        const std::unordered_map<Sid, PropertyValue> expectedDefaults = expected.engravingDefaults();
+        const std::unordered_map<Sid, PropertyValue> actualDefaults = actual.engravingDefaults();
+        EXPECT_FALSE(expectedDefaults.empty());
+        EXPECT_EQ(actualDefaults.size(), expectedDefaults.size());
+
+        for (const auto& [sid, value] : expectedDefaults) {
+            auto it = actualDefaults.find(sid);
+            ASSERT_TRUE(it != actualDefaults.end()) << "style: " << static_cast<int>(sid);
+            EXPECT_TRUE(it->second == value) << "style: " << static_cast<int>(sid);
+        }
+
+        EXPECT_EQ(actual.textEnclosureThickness(), expected.textEnclosureThickness());
+    }
+
+    std::shared_ptr<GlobalConfigurationMock> m_globalConfiguration;
+
+    static EngravingFontMetricsTable makeTable()
+    {
+        EngravingFontMetricsTable table;
+        table.sourceStamp = 0x1234567890abcdefull;
+        table.hasEngravingDefaults = true;
+        table.textEnclosureThickness = 0.16;
+
+        for (uint32_t i = 0; i < 100; ++i) {
+            EngravingFontMetricsTable::Symbol symbol;
+            symbol.code = 0xE000 + i;
+            symbol.firstAnchor = static_cast<uint32_t>(table.anchors.size());
+            symbol.anchorCount = i % 3;
+            symbol.bboxX = -0.5 * i;
+            symbol.bboxY = -1.25 * i;
+            symbol.bboxWidth = 2.0 + i;
+            symbol.bboxHeight = 3.5 + i;
+            symbol.advance = 2.25 + i;
+            table.symbols.push_back(symbol);
+
+            for (uint32_t a = 0; a < symbol.anchorCount; ++a) {
+                EngravingFontMetricsTable::Anchor anchor;
+                anchor.id = a;
+                anchor.x = 0.1 * i;
+                anchor.y = -0.2 * a;
+                table.anchors.push_back(anchor);
+            }
+        }
+
+        table.defaults.push_back({ 1, EngravingFontMetricsTable::DefaultType::Real, 0.13 });
+        table.defaults.push_back({ 2, EngravingFontMetricsTable::DefaultType::Bool, 1.0 });
+
+        return table;
+    }
+};
+}
+
+/**
+ * @brief Engraving_EngravingFontMetricsTableTests_RestoreFromData
+ * @details Store a table and check that restoring it gives back the same records
+ */
+TEST_F(Engraving_EngravingFontMetricsTableTests, RestoreFromData)
+{
+    EngravingFontMetricsTable table = makeTable();
+
+    EngravingFontMetricsTable restored = EngravingFontMetricsTable::fromData(table.toData());
+
+    EXPECT_EQ(restored.sourceStamp, table.sourceStamp);
+    EXPECT_EQ(restored.hasEngravingDefaults, table.hasEngravingDefaults);
+    EXPECT_DOUBLE_EQ(restored.textEnclosureThickness, table.textEnclosureThickness);
+
+    ASSERT_EQ(restored.symbols.size(), table.symbols.size());
+    for (size_t i = 0; i < table.symbols.size(); ++i) {
+        EXPECT_EQ(restored.symbols.at(i).code, table.symbols.at(i).code);
+        EXPECT_EQ(restored.symbols.at(i).firstAnchor, table.symbols.at(i).firstAnchor);
+        EXPECT_EQ(restored.symbols.at(i).anchorCount, table.symbols.at(i).anchorCount);
+        EXPECT_DOUBLE_EQ(restored.symbols.at(i).bboxX, table.symbols.at(i).bboxX);
+        EXPECT_DOUBLE_EQ(restored.symbols.at(i).bboxY, table.symbols.at(i).bboxY);
+        EXPECT_DOUBLE_EQ(restored.symbols.at(i).bboxWidth, table.symbols.at(i).bboxWidth);
+        EXPECT_DOUBLE_EQ(restored.symbols.at(i).bboxHeight, table.symbols.at(i).bboxHeight);
+        EXPECT_DOUBLE_EQ(restored.symbols.at(i).advance, table.symbols.at(i).advance);
+    }
+
+    ASSERT_EQ(restored.anchors.size(), table.anchors.size());
+    for (size_t i = 0; i < table.anchors.size(); ++i) {
+        EXPECT_EQ(restored.anchors.at(i).id, table.anchors.at(i).id);
+        EXPECT_DOUBLE_EQ(restored.anchors.at(i).x, table.anchors.at(i).x);
+        EXPECT_DOUBLE_EQ(restored.anchors.at(i).y, table.anchors.at(i).y);
+    }
+
+    ASSERT_EQ(restored.defaults.size(), table.defaults.size());
+    for (size_t i = 0; i < table.defaults.size(); ++i) {
+        EXPECT_EQ(restored.defaults.at(i).sid, table.defaults.at(i).sid);
+        EXPECT_EQ(restored.defaults.at(i).type, table.defaults.at(i).type);
+        EXPECT_DOUBLE_EQ(restored.defaults.at(i).value, table.defaults.at(i).value);
+    }
+}
+
+/**
+ * @brief Engraving_EngravingFontMetricsTableTests_BrokenData
+ * @details Check that truncated or damaged data gives an empty table, so the font is loaded from its files
+ */
+TEST_F(Engraving_EngravingFontMetricsTableTests, BrokenData)
+{
+    ByteArray data = makeTable().toData();
+
+    //! truncated
+    ByteArray truncated(data.constData(), data.size() - 1);
+    EXPECT_TRUE(EngravingFontMetricsTable::fromData(truncated).symbols.empty());
+
+    //! another version or byte order
+    ByteArray damaged = data;
+    damaged.data()[0] ^= 0xff;
+    EXPECT_TRUE(EngravingFontMetricsTable::fromData(damaged).symbols.empty());
+
+    //! empty
+    EXPECT_TRUE(EngravingFontMetricsTable::fromData(ByteArray()).symbols.empty());
+}
+
+/**
+ * @brief Engraving_EngravingFontMetricsTableTests_EnsureLoadFromTable
+ * @details Load a font from its files, then from the table written by that load, and check that the metrics are the same
+ */
+TEST_F(Engraving_EngravingFontMetricsTableTests, EnsureLoadFromTable)
+{
+    //! GIVEN Font loaded from its files
+    std::shared_ptr<EngravingFont> loaded = makeFont(u"revision");
+    loaded->ensureLoad();
+
+    //! CHECK The table is written
+    ASSERT_TRUE(io::File::exists(TABLE_PATH));
+    EXPECT_EQ(readTable().symbols.size(), static_cast<size_t>(SymId::lastSym) + 1);
+
+    //! DO Load the font again
+    std::shared_ptr<EngravingFont> cached = makeFont(u"revision");
+    cached->ensureLoad();
+
+    //! CHECK The metrics are the same
+    expectSameMetrics(*loaded, *cached);
+}
+
+/**
+ * @brief Engraving_EngravingFontMetricsTableTests_EnsureLoadChecksRevision
+ * @details Check that the table is used by the same build only
+ */
+TEST_F(Engraving_EngravingFontMetricsTableTests, EnsureLoadChecksRevision)
+{
+    //! GIVEN Table written by a build, with a changed value
+    std::shared_ptr<EngravingFont> loaded = makeFont(u"revision");
+    loaded->ensureLoad();
+
+    EngravingFontMetricsTable table = readTable();
+    const uint64_t sourceStamp = table.sourceStamp;
+    table.textEnclosureThickness += 1.0;
+    ASSERT_TRUE(io::File::writeFile(TABLE_PATH, table.toData()));
+
+    //! DO Load the font in the same build
+    std::shared_ptr<EngravingFont> sameBuild = makeFont(u"revision");
+    sameBuild->ensureLoad();
+
+    //! CHECK The metrics come from the table
+    EXPECT_EQ(sameBuild->textEnclosureThickness(), loaded->textEnclosureThickness() + 1.0);
+
+    //! DO Load the font in another build
+    std::shared_ptr<EngravingFont> otherBuild = makeFont(u"other revision");
+    otherBuild->ensureLoad();
+
+    //! CHECK The metrics come from the font files, and the table is written again
+    expectSameMetrics(*loaded, *otherBuild);
+    EXPECT_NE(readTable().sourceStamp, sourceStamp);
+}
@@ -0,0 +1,145 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "io/dir.h"
+#include "io/file.h"
+#include "serialization/json.h"
+
+#include "dom/masterscore.h"
+
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace mu::engraving;
+
+//! Layout benchmark over a directory of scores.
+//! Disabled unless MUE_LAYOUT_BENCHMARK_DIR is set, e.g.
+//!   MUE_LAYOUT_BENCHMARK_DIR=~/scores MUE_LAYOUT_BENCHMARK_RUNS=10 \
+//!   MUE_LAYOUT_BENCHMARK_OUTPUT=layout.json ./engraving_tests --gtest_filter=Engraving_LayoutBenchmark*
+
+class Engraving_LayoutBenchmarkTests : public ::testing::Test
+{
+public:
+    static int runCount()
+    {
+        const char* runs = std::getenv("MUE_LAYOUT_BENCHMARK_RUNS");
+        int count = runs ? std::atoi(runs) : 0;
+        return count > 0 ? count : 5;
+    }
+
+    static double peakRssKb()
+    {
+#ifndef _WIN32
+        rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+            return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#else
+            return static_cast<double>(usage.ru_maxrss);
+#endif
+        }
+#endif
+        return 0.0;
+    }
+
+    static JsonObject passTimesToJson(const LayoutPassTimes& times)
+    {
+        JsonObject obj;
+        obj["resetLayoutData"] = times.resetLayoutData;
+        obj["independentItems"] = times.independentItems;
+        obj["horizontalSpacing"] = times.horizontalSpacing;
+        obj["systemLayout"] = times.systemLayout;
+        obj["pageLayout"] = times.pageLayout;
+        obj["total"] = times.total;
+        return obj;
+    }
+};
+
+TEST_F(Engraving_LayoutBenchmarkTests, LayoutCorpus)
+{
+    const char* corpusDir = std::getenv("MUE_LAYOUT_BENCHMARK_DIR");
+    if (!corpusDir) {
+        GTEST_SKIP() << "MUE_LAYOUT_BENCHMARK_DIR is not set";
+    }
+
+    RetVal<io::paths_t> files = io::Dir::scanFiles(corpusDir, { "*.mscz", "*.mscx" });
+    ASSERT_TRUE(files.ret);
+
+    const int runs = runCount();
+
+    JsonArray scores;
+    for (const io::path_t& path : files.val) {
+        MasterScore* score = ScoreRW::readScore(path.toString(), true);
+        if (!score) {
+            continue;
+        }
+
+        JsonArray runResults;
+        for (int i = 0; i < runs; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            score->doLayout();
+            double wallTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            const LayoutStatistics& stats = score->layoutStatistics();
+
+            JsonObject run;
+            run["wallTime"] = wallTime;
+            run["passes"] = passTimesToJson(stats.passTimes);
+            run["systems"] = static_cast<int>(stats.totalSystems());
+            run["peakRssKb"] = peakRssKb();
+            runResults << run;
+        }
+
+        JsonObject result;
+        result["file"] = path.toStdString();
+        result["measures"] = static_cast<int>(score->nmeasures());
+        result["runs"] = runResults;
+        scores << result;
+
+        delete score;
+    }
+
+    JsonObject report;
+    report["runs"] = runs;
+    report["scores"] = scores;
+
+    ByteArray json = JsonDocument(report).toJson();
+
+    const char* output = std::getenv("MUE_LAYOUT_BENCHMARK_OUTPUT");
+    if (output) {
+        EXPECT_TRUE(io::File::writeFile(output, json));
+    } else {
+        std::cout << json.constChar() << std::endl;
+    }
+}
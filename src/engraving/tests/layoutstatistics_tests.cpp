@@ -0,0 +1,72 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/measure.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu::engraving;
+
+class Engraving_LayoutStatisticsTests : public ::testing::Test
+{
+};
+
+TEST_F(Engraving_LayoutStatisticsTests, RelayoutAfterEdit)
+{
+    //! GIVEN A score of several systems
+    MasterScore* score = ScoreRW::readScore(u"test.mscx");
+    ASSERT_TRUE(score);
+
+    score->startCmd(TranslatableString::untranslatable("Engraving layout statistics tests"));
+    score->appendMeasures(40);
+    score->endCmd();
+
+    //! DO Lay out the whole score
+    score->doLayout();
+
+    //! CHECK All systems are laid out again
+    const size_t systemCount = score->systems().size();
+    ASSERT_GT(systemCount, 2);
+
+    LayoutStatistics stats = score->layoutStatistics();
+    EXPECT_TRUE(stats.isLayoutAll);
+    EXPECT_EQ(stats.recomputedSystems, systemCount);
+    EXPECT_EQ(stats.reusedSystems, 0);
+
+    //! DO Change the last measure
+    score->startCmd(TranslatableString::untranslatable("Engraving layout statistics tests"));
+    score->lastMeasure()->undoChangeProperty(Pid::USER_STRETCH, 1.5);
+    score->endCmd();
+
+    //! CHECK Only the systems from the edited one on are laid out again, the ones before are kept
+    stats = score->layoutStatistics();
+    EXPECT_FALSE(stats.isLayoutAll);
+    EXPECT_EQ(stats.totalSystems(), score->systems().size());
+    EXPECT_GE(stats.recomputedSystems, 1);
+    EXPECT_GT(stats.reusedSystems, 0);
+    EXPECT_LT(stats.recomputedSystems, stats.totalSystems());
+
+    delete score;
+}
@@ -101,6 +101,15 @@ public:
     MOCK_METHOD(bool, doNotSaveEIDsForBackCompat, (), (const, override));
     MOCK_METHOD(void, setDoNotSaveEIDsForBackCompat, (bool), (override));
 
+    MOCK_METHOD(bool, parallelLayoutEnabled, (), (const, override));
+    MOCK_METHOD(void, setParallelLayoutEnabled, (bool), (override));
+    MOCK_METHOD(bool, parallelReadingEnabled, (), (const, override));
+    MOCK_METHOD(void, setParallelReadingEnabled, (bool), (override));
+    MOCK_METHOD(bool, layoutCacheEnabled, (), (const, override));
+    MOCK_METHOD(void, setLayoutCacheEnabled, (bool), (override));
+    MOCK_METHOD(bool, parallelPlaybackLoadingEnabled, (), (const, override));
+    MOCK_METHOD(void, setParallelPlaybackLoadingEnabled, (bool), (override));
+
     MOCK_METHOD(bool, guitarProImportExperimental, (), (const, override));
     MOCK_METHOD(bool, shouldAddParenthesisOnStandardStaff, (), (const, override));
     MOCK_METHOD(bool, negativeFretsAllowed, (), (const, override));
@@ -27,11 +27,20 @@
 
 #include "engraving/infrastructure/mscreader.h"
 #include "engraving/infrastructure/mscwriter.h"
+#include "engraving/rw/layoutcache.h"
+#include "engraving/rw/mscsaver.h"
+#include "engraving/dom/masterscore.h"
+
+#include "mocks/engravingconfigurationmock.h"
+
+#include "utils/scorerw.h"
 
 using namespace muse;
 using namespace muse::io;
 using namespace mu::engraving;
 
+using ::testing::Return;
+
 class Engraving_MsczFileTests : public ::testing::Test
 {
 public:
@@ -88,3 +97,149 @@ TEST_F(Engraving_MsczFileTests, MsczFile_WriteRead)
         EXPECT_EQ(imageData, originImageData);
     }
 }
+
+TEST_F(Engraving_MsczFileTests, MsczFile_ReadLargeFile)
+{
+    //! CASE Reading a file that is much bigger than its compressed data
+
+    //! GIVEN Well compressible data
+    std::string text;
+    for (int i = 0; i < 100000; ++i) {
+        text += "<Chord><durationType>quarter</durationType></Chord>\n";
+    }
+    const ByteArray originScoreData(text.c_str());
+
+    //! DO Write and read
+    ByteArray msczData;
+    {
+        Buffer buf(&msczData);
+        MscWriter::Params params;
+        params.device = &buf;
+        params.filePath = "large.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscWriter writer(params);
+        writer.open();
+        writer.writeScoreFile(originScoreData);
+    }
+
+    EXPECT_LT(msczData.size(), originScoreData.size() / 10);
+
+    Buffer buf(&msczData);
+    MscReader::Params params;
+    params.device = &buf;
+    params.filePath = "large.mscz";
+    params.mode = MscIoMode::Zip;
+
+    MscReader reader(params);
+    reader.open();
+
+    ByteArray scoreData = reader.readScoreFile();
+
+    //! CHECK The data and the statistics
+    EXPECT_EQ(scoreData, originScoreData);
+    EXPECT_EQ(reader.readStatistics().filesRead, 1);
+    EXPECT_EQ(reader.readStatistics().bytesRead, originScoreData.size());
+}
+
+TEST_F(Engraving_MsczFileTests, MsczFile_LayoutCache)
+{
+    //! CASE The system breaks saved with the file are used for the first layout after opening
+
+    //! GIVEN A score of several systems
+    MasterScore* score = ScoreRW::readScore(u"test.mscx");
+    ASSERT_TRUE(score);
+
+    score->startCmd(TranslatableString::untranslatable("Engraving mscz file tests"));
+    score->appendMeasures(40);
+    score->endCmd();
+
+    const rw::LayoutCache::SystemBreaks breaks = rw::LayoutCache::systemBreaks(score);
+    EXPECT_GT(breaks.size(), 1);
+
+    //! DO Write and read the cache
+    const ByteArray scoreData("<museScore/>");
+    const ByteArray styleData("<Style/>");
+
+    rw::LayoutCache cache;
+    ByteArray cacheData = cache.write(breaks, score, scoreData, styleData);
+
+    //! CHECK The cache is only valid for the data it was written with
+    EXPECT_EQ(cache.read(cacheData, score, scoreData, styleData), breaks);
+    EXPECT_TRUE(cache.read(cacheData, score, ByteArray("<museScore></museScore>"), styleData).empty());
+    EXPECT_TRUE(cache.read(cacheData.left(cacheData.size() - 1), score, scoreData, styleData).empty());
+
+    //! CHECK The cache is not valid with other text fonts, even if the style data is the same
+    const String fontFace = score->style().styleSt(Sid::defaultFontFace);
+    score->style().set(Sid::defaultFontFace, String(u"Some Font That Is Not Installed"));
+    EXPECT_TRUE(cache.read(cacheData, score, scoreData, styleData).empty());
+    score->style().set(Sid::defaultFontFace, fontFace);
+    EXPECT_EQ(cache.read(cacheData, score, scoreData, styleData), breaks);
+
+    //! CHECK The layout with the hints has the same systems and the hints are dropped after it
+    score->setSystemBreakHints(breaks);
+    score->doLayout();
+
+    EXPECT_EQ(rw::LayoutCache::systemBreaks(score), breaks);
+    EXPECT_TRUE(score->layoutOptions().systemBreakHints.empty());
+
+    //! CHECK A hinted system that doesn't fit the page is not used, the measures are fitted normally
+    score->setSystemBreakHints({ { breaks.begin()->first, breaks.rbegin()->second } });
+    score->doLayout();
+
+    EXPECT_EQ(rw::LayoutCache::systemBreaks(score), breaks);
+
+    delete score;
+}
+
+TEST_F(Engraving_MsczFileTests, MsczFile_LayoutCacheSetting)
+{
+    //! CASE The layout cache is only saved when it is enabled in the configuration
+
+    //! GIVEN A score of several systems
+    MasterScore* score = ScoreRW::readScore(u"test.mscx");
+    ASSERT_TRUE(score);
+
+    score->startCmd(TranslatableString::untranslatable("Engraving mscz file tests"));
+    score->appendMeasures(40);
+    score->endCmd();
+
+    auto configuration = std::dynamic_pointer_cast<EngravingConfigurationMock>(
+        muse::modularity::globalIoc()->resolve<IEngravingConfiguration>("utests"));
+    ASSERT_TRUE(configuration);
+
+    auto saveAndReadCache = [score]() {
+        ByteArray msczData;
+        {
+            Buffer buf(&msczData);
+            MscWriter::Params params;
+            params.device = &buf;
+            params.filePath = "layoutcache.mscz";
+            params.mode = MscIoMode::Zip;
+
+            MscWriter writer(params);
+            writer.open();
+            EXPECT_TRUE(MscSaver(muse::modularity::globalCtx()).writeMscz(score, writer, false));
+        }
+
+        Buffer buf(&msczData);
+        MscReader::Params params;
+        params.device = &buf;
+        params.filePath = "layoutcache.mscz";
+        params.mode = MscIoMode::Zip;
+
+        MscReader reader(params);
+        reader.open();
+        return reader.readLayoutCacheFile();
+    };
+
+    //! CHECK By default there is no cache in the file
+    EXPECT_TRUE(saveAndReadCache().empty());
+
+    //! CHECK When enabled, the cache is saved
+    ON_CALL(*configuration, layoutCacheEnabled()).WillByDefault(Return(true));
+    EXPECT_FALSE(saveAndReadCache().empty());
+    ON_CALL(*configuration, layoutCacheEnabled()).WillByDefault(Return(false));
+
+    delete score;
+}
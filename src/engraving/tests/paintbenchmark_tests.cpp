@@ -0,0 +1,132 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+#include <QImage>
+#include <QPainter>
+
+#include "draw/painter.h"
+
+#include "dom/masterscore.h"
+#include "dom/page.h"
+#include "rendering/iscorerenderer.h"
+
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace mu::engraving;
+
+//! Painting benchmark of the pages of a score, with the engraving font of the score.
+//! Disabled unless MUE_PAINT_BENCHMARK_SCORE is set, e.g.
+//!   MUE_PAINT_BENCHMARK_SCORE=~/scores/score.mscz MUE_PAINT_BENCHMARK_DPI=300 \
+//!   ./engraving_tests --gtest_filter=Engraving_PaintBenchmarkTests*
+
+class Engraving_PaintBenchmarkTests : public ::testing::Test
+{
+public:
+    static int dpi()
+    {
+        const char* dpi = std::getenv("MUE_PAINT_BENCHMARK_DPI");
+        int value = dpi ? std::atoi(dpi) : 0;
+        return value > 0 ? value : 150;
+    }
+
+    //! NOTE Paints the page like the image export does. If direct is set, the items are painted
+    //! straight on the image, otherwise through the display list of the page
+    static double paintPage(Score* score, int pageIdx, QImage& image, bool direct)
+    {
+        const Page* page = score->pages().at(pageIdx);
+
+        IScoreRenderer::ScorePaintOptions opt;
+        opt.isSetViewport = true;
+        opt.isMultiPage = false;
+        opt.isPrinting = true;
+        opt.fromPage = pageIdx;
+        opt.toPage = pageIdx;
+        opt.deviceDpi = image.logicalDpiX();
+        if (direct) {
+            opt.frameRect = page->ldata()->bbox().translated(page->pos());
+        }
+
+        image.fill(Qt::white);
+
+        auto start = std::chrono::steady_clock::now();
+        {
+            QPainter qp(&image);
+            draw::Painter painter(&qp, "paint_benchmark");
+            score->renderer()->paintScore(&painter, score, opt);
+            painter.endDraw();
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+
+TEST_F(Engraving_PaintBenchmarkTests, PagePainting)
+{
+    const char* path = std::getenv("MUE_PAINT_BENCHMARK_SCORE");
+    if (!path) {
+        GTEST_SKIP() << "MUE_PAINT_BENCHMARK_SCORE is not set";
+    }
+
+    MasterScore* score = ScoreRW::readScore(String::fromUtf8(path), true);
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->pages().empty());
+
+    const SizeF pageSize = score->renderer()->pageSizeInch(score);
+    const int resolution = dpi();
+    QImage image(std::lrint(pageSize.width() * resolution), std::lrint(pageSize.height() * resolution), QImage::Format_ARGB32_Premultiplied);
+    image.setDotsPerMeterX(std::lrint(resolution * 1000 / 25.4));
+    image.setDotsPerMeterY(std::lrint(resolution * 1000 / 25.4));
+
+    double directTotal = 0.0;
+    double recordTotal = 0.0;
+    double replayTotal = 0.0;
+
+    const int pageCount = static_cast<int>(score->pages().size());
+    for (int pi = 0; pi < pageCount; ++pi) {
+        const double direct = paintPage(score, pi, image, true);
+
+        //! NOTE Within one paint job the first paint records the display list of the page, the next one replays it
+        score->beginPaintJob();
+        const double record = paintPage(score, pi, image, false);
+        const double replay = paintPage(score, pi, image, false);
+        score->endPaintJob();
+
+        LOGI() << "page " << (pi + 1) << ": direct " << direct << " ms, recorded " << record << " ms, replayed " << replay << " ms";
+
+        directTotal += direct;
+        recordTotal += record;
+        replayTotal += replay;
+    }
+
+    LOGI() << pageCount << " pages at " << resolution << " dpi, per page: direct " << directTotal / pageCount
+           << " ms, recorded " << recordTotal / pageCount << " ms, replayed " << replayTotal / pageCount << " ms";
+
+    delete score;
+}
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "draw/types/drawdata.h"
+#include "draw/utils/drawdatacomp.h"
+
+#include "engraving/devtools/drawdata/drawdatagenerator.h"
+
+#include "mocks/engravingconfigurationmock.h"
+#include "utils/scorerw.h"
+
+using namespace muse;
+using namespace muse::draw;
+using namespace mu::engraving;
+
+using ::testing::Return;
+
+class Engraving_ParallelLayoutTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_configuration = std::dynamic_pointer_cast<EngravingConfigurationMock>(
+            muse::modularity::globalIoc()->resolve<IEngravingConfiguration>("utests"));
+        ASSERT_TRUE(m_configuration);
+    }
+
+    void TearDown() override
+    {
+        ON_CALL(*m_configuration, parallelLayoutEnabled()).WillByDefault(Return(false));
+    }
+
+    DrawDataPtr drawScore(const String& path, bool parallel) const
+    {
+        ON_CALL(*m_configuration, parallelLayoutEnabled()).WillByDefault(Return(parallel));
+
+        DrawDataGenerator g(muse::modularity::globalCtx());
+        return g.genDrawData(ScoreRW::rootPath() + u"/" + path);
+    }
+
+    //! NOTE Compares the pages the same way vtest does
+    void checkParallelLayoutEqualsSerial(const String& path) const
+    {
+        DrawDataPtr serial = drawScore(path, false);
+        DrawDataPtr parallel = drawScore(path, true);
+
+        ASSERT_TRUE(serial);
+        ASSERT_TRUE(parallel);
+        EXPECT_FALSE(serial->empty());
+
+        Diff diff = DrawDataComp::compare(parallel, serial);
+        EXPECT_TRUE(diff.empty()) << path.toStdString();
+    }
+
+    std::shared_ptr<EngravingConfigurationMock> m_configuration;
+};
+
+/**
+ * @brief Engraving_ParallelLayoutTests_CrossStaffBeams
+ * @details Lays out a piano score with cross-staff beams serially and in parallel, the pages must be drawn the same
+ */
+TEST_F(Engraving_ParallelLayoutTests, CrossStaffBeams)
+{
+    checkParallelLayoutEqualsSerial(u"beam_data/Beam-CrossM1.mscx");
+    checkParallelLayoutEqualsSerial(u"beam_data/Beam-CrossM2.mscx");
+}
+
+/**
+ * @brief Engraving_ParallelLayoutTests_Parts
+ * @details Lays out a score of several instruments serially and in parallel, the pages must be drawn the same
+ */
+TEST_F(Engraving_ParallelLayoutTests, Parts)
+{
+    checkParallelLayoutEqualsSerial(u"parts_data/input-from-parts.mscz");
+}
+
+/**
+ * @brief Engraving_ParallelLayoutTests_SingleStaff
+ * @details A score of one staff is laid out serially in both modes
+ */
+TEST_F(Engraving_ParallelLayoutTests, SingleStaff)
+{
+    checkParallelLayoutEqualsSerial(u"test.mscx");
+}
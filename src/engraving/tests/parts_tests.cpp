@@ -39,6 +39,9 @@
 #include "engraving/dom/segment.h"
 #include "engraving/dom/spanner.h"
 #include "engraving/dom/staff.h"
+#include "engraving/infrastructure/mscreader.h"
+
+#include "mocks/engravingconfigurationmock.h"
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
@@ -46,6 +49,8 @@
 
 using namespace mu::engraving;
 
+using ::testing::Return;
+
 static const String PARTS_DATA_DIR("parts_data/");
 
 class Engraving_PartsTests : public ::testing::Test
@@ -1320,6 +1325,54 @@ TEST_F(Engraving_PartsTests, inputFromParts) {
     EXPECT_TRUE(chord);
 }
 
+//---------------------------------------------------------
+//   parallelReading
+//    the parts read with the xml parsed concurrently must be
+//    the same as the parts read serially, in the order of the excerpt files
+//---------------------------------------------------------
+
+TEST_F(Engraving_PartsTests, parallelReading)
+{
+    MscReader::Params params;
+    params.filePath = ScoreRW::rootPath() + u"/" + PARTS_DATA_DIR + u"input-from-parts.mscz";
+    MscReader reader(params);
+    ASSERT_TRUE(reader.open());
+
+    const std::vector<String> excerptFileNames = reader.excerptFileNames();
+    EXPECT_GT(excerptFileNames.size(), 1);
+
+    auto configuration = std::dynamic_pointer_cast<EngravingConfigurationMock>(
+        muse::modularity::globalIoc()->resolve<IEngravingConfiguration>("utests"));
+    ASSERT_TRUE(configuration);
+
+    MasterScore* serialScore = ScoreRW::readScore(PARTS_DATA_DIR + u"input-from-parts.mscz");
+    ASSERT_TRUE(serialScore);
+
+    ON_CALL(*configuration, parallelReadingEnabled()).WillByDefault(Return(true));
+    MasterScore* parallelScore = ScoreRW::readScore(PARTS_DATA_DIR + u"input-from-parts.mscz");
+    ON_CALL(*configuration, parallelReadingEnabled()).WillByDefault(Return(false));
+    ASSERT_TRUE(parallelScore);
+
+    ASSERT_EQ(serialScore->excerpts().size(), excerptFileNames.size());
+    ASSERT_EQ(parallelScore->excerpts().size(), excerptFileNames.size());
+
+    for (size_t i = 0; i < excerptFileNames.size(); ++i) {
+        const Excerpt* excerpt = parallelScore->excerpts().at(i);
+        EXPECT_EQ(excerpt->fileName(), excerptFileNames.at(i));
+        ASSERT_TRUE(excerpt->excerptScore());
+
+        const String serialName = u"parallel-reading-serial-" + String::number(i) + u".mscx";
+        const String parallelName = u"parallel-reading-parallel-" + String::number(i) + u".mscx";
+
+        EXPECT_TRUE(ScoreRW::saveScore(serialScore->excerpts().at(i)->excerptScore(), serialName));
+        EXPECT_TRUE(ScoreRW::saveScore(excerpt->excerptScore(), parallelName));
+        EXPECT_TRUE(ScoreComp::compareFiles(serialName, parallelName));
+    }
+
+    delete serialScore;
+    delete parallelScore;
+}
+
 //---------------------------------------------------------
 //   staffStyles
 //---------------------------------------------------------
@@ -22,21 +22,28 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <chrono>
+#include <cstdlib>
 #include <memory>
 
 #include "async/asyncable.h"
 #include "async/channel.h"
+#include "io/dir.h"
 #include "mpe/tests/utils/articulationutils.h"
 #include "mpe/tests/mocks/articulationprofilesrepositorymock.h"
 
 #include "engraving/dom/part.h"
 #include "engraving/dom/measure.h"
 #include "engraving/dom/chord.h"
+#include "engraving/dom/note.h"
 
 #include "engraving/playback/playbackmodel.h"
 
+#include "mocks/engravingconfigurationmock.h"
 #include "utils/scorerw.h"
 
+#include "log.h"
+
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::_;
@@ -64,6 +71,16 @@ protected:
         m_defaultProfile = std::make_shared<ArticulationsProfile>();
 
         m_repositoryMock = std::make_shared<NiceMock<ArticulationProfilesRepositoryMock> >();
+
+        m_configuration = std::dynamic_pointer_cast<EngravingConfigurationMock>(
+            modularity::globalIoc()->resolve<IEngravingConfiguration>("utests"));
+    }
+
+    void TearDown() override
+    {
+        if (m_configuration) {
+            ON_CALL(*m_configuration, parallelPlaybackLoadingEnabled()).WillByDefault(Return(false));
+        }
     }
 
     ArticulationPattern buildTestArticulationPattern() const
@@ -78,12 +95,58 @@ protected:
         return pattern;
     }
 
+    //! Loads the score serially and in parallel, the events of every track must be the same
+    void expectSameParallelLoading(Score* score, double* serialMsecs = nullptr, double* parallelMsecs = nullptr)
+    {
+        ASSERT_TRUE(m_configuration);
+
+        auto loadModel = [this, score](PlaybackModel& model, bool parallel) {
+            ON_CALL(*m_configuration, parallelPlaybackLoadingEnabled()).WillByDefault(Return(parallel));
+            model.profilesRepository.set(m_repositoryMock);
+
+            auto start = std::chrono::steady_clock::now();
+            model.load(score);
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        };
+
+        PlaybackModel serialModel(modularity::globalCtx());
+        double serialTime = loadModel(serialModel, false);
+
+        PlaybackModel parallelModel(modularity::globalCtx());
+        double parallelTime = loadModel(parallelModel, true);
+
+        ON_CALL(*m_configuration, parallelPlaybackLoadingEnabled()).WillByDefault(Return(false));
+
+        const InstrumentTrackIdSet trackIdSet = serialModel.existingTrackIdSet();
+        ASSERT_EQ(trackIdSet, parallelModel.existingTrackIdSet());
+
+        for (const InstrumentTrackId& trackId : trackIdSet) {
+            const PlaybackData& expected = serialModel.resolveTrackPlaybackData(trackId);
+            const PlaybackData& actual = parallelModel.resolveTrackPlaybackData(trackId);
+
+            EXPECT_EQ(actual.originEvents, expected.originEvents);
+            EXPECT_EQ(actual.dynamics, expected.dynamics);
+            EXPECT_EQ(actual.setupData, expected.setupData);
+        }
+
+        EXPECT_EQ(parallelModel.updateStatistics().renderedItems, serialModel.updateStatistics().renderedItems);
+
+        if (serialMsecs) {
+            *serialMsecs = serialTime;
+        }
+
+        if (parallelMsecs) {
+            *parallelMsecs = parallelTime;
+        }
+    }
+
     ArticulationsProfilePtr m_defaultProfile = nullptr;
 
     ArticulationPattern m_dummyPattern;
     ArticulationPatternSegment m_dummyPatternSegment;
 
     std::shared_ptr<NiceMock<ArticulationProfilesRepositoryMock> > m_repositoryMock = nullptr;
+    std::shared_ptr<EngravingConfigurationMock> m_configuration;
 };
 
 /**
@@ -872,8 +935,8 @@ TEST_F(Engraving_PlaybackModelTests, MeasureRepeat_TiedNotes)
  * @details In this case we're building up a playback model of a simple score - Violin, 4/4, 120bpm, Treble Cleff, 4 measures
  *          Additionally, there is a simple repeat from measure 2 up to measure 3. In total, we'll be playing 6 measures overall
  *
- *          When the model will be loaded we'll emulate a change notification on the 2-nd measure, so that there will be updated events
- *          on the main stream channel
+ *          When the model will be loaded we'll change notes outside and inside the repeat and emulate the change notifications,
+ *          so that only the timestamps of the changed notes will be sent on the delta channel
  */
 TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
 {
@@ -890,25 +953,41 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
     // [GIVEN] The articulation profiles repository will be returning profiles for StringsArticulation family
     ON_CALL(*m_repositoryMock, defaultProfile(_)).WillByDefault(Return(m_defaultProfile));
 
-    // [GIVEN] Expected amount of changed events
-    int expectedChangedEventsCount = 24;
-
     // [GIVEN] The playback model requested to be loaded
     PlaybackModel model(modularity::globalCtx());
     model.profilesRepository.set(m_repositoryMock);
     model.load(score);
 
     PlaybackData result = model.resolveTrackPlaybackData(part->id(), part->instrumentId());
-    EXPECT_EQ(result.originEvents.size(), expectedChangedEventsCount);
+    const PlaybackEventsMap oldEvents = result.originEvents;
+    ASSERT_EQ(oldEvents.size(), 24);
 
-    // [THEN] Updated events map will match our expectations
-    result.mainStream.onReceive(this, [expectedChangedEventsCount](const PlaybackEventsMap& updatedEvents, const DynamicLevelLayers&) {
-        EXPECT_EQ(updatedEvents.size(), expectedChangedEventsCount);
+    // [GIVEN] Every notification is counted
+    int mainStreamCount = 0;
+    result.mainStream.onReceive(this, [&mainStreamCount](const PlaybackEventsMap&, const DynamicLevelLayers&) {
+        ++mainStreamCount;
     });
 
-    // [WHEN] Score has been changed: the range starts ouside the repeat and ends inside it
+    int deltaCount = 0;
+    PlaybackEventsMap delta;
+    result.mainStreamDelta.onReceive(this, [&deltaCount, &delta](const PlaybackEventsMap& changes, const DynamicLevelLayers&) {
+        ++deltaCount;
+        delta = changes;
+    });
+
+    auto changeVelocity = [score](int tick) {
+        const Fraction fraction = Fraction::fromTicks(tick);
+        Chord* chord = score->tick2measure(fraction)->findChord(fraction, 0);
+        ASSERT_TRUE(chord);
+        chord->notes().front()->setUserVelocity(40);
+    };
+
+    // [WHEN] The 2nd note of the 1st measure (outside the repeat) has been changed,
+    //        the range starts ouside the repeat and ends inside it
+    changeVelocity(480);
+
     ScoreChanges changes;
-    changes.tickFrom = 480; // 2nd note of the 1st measure (outside the repeat)
+    changes.tickFrom = 480;
     changes.tickTo = 3840; // 1st note of the 3rd measure (inside the repeat)
     changes.staffIdxFrom = 0;
     changes.staffIdxTo = 0;
@@ -916,15 +995,117 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
 
     score->changesChannel().send(changes);
 
-    // [WHEN] Score has been changed: the range is inside the repeat and tickTo == the end tick of the repeat
+    // [THEN] Only the timestamp of the changed note is sent
+    EXPECT_EQ(mainStreamCount, 0);
+    EXPECT_EQ(deltaCount, 1);
+    ASSERT_EQ(delta.size(), 1);
+    EXPECT_EQ(delta.begin()->first, QUARTER_NOTE_DURATION);
+    EXPECT_FALSE(delta.begin()->second.empty());
+    EXPECT_NE(delta.begin()->second, oldEvents.at(QUARTER_NOTE_DURATION));
+
+    // [WHEN] The 3rd note of the 3rd measure (inside the repeat) has been changed,
+    //        the range is inside the repeat and tickTo == the end tick of the repeat
     // See: https://github.com/musescore/MuseScore/issues/25899
-    changes.tickFrom = 4800; // 3rd note of the 3rd measure (inside the repeat)
+    changeVelocity(4800);
+
+    changes.tickFrom = 4800;
     changes.tickTo = 5760; // end tick of the repeat
+    changes.changedTypes = { ElementType::NOTE };
+
+    score->changesChannel().send(changes);
+
+    // [THEN] The timestamps of the changed note in both passes of the repeat are sent
+    const timestamp_t firstPass = WHOLE_NOTE_DURATION * 2 + HALF_NOTE_DURATION;
+    const timestamp_t secondPass = WHOLE_NOTE_DURATION * 4 + HALF_NOTE_DURATION;
+
+    EXPECT_EQ(mainStreamCount, 0);
+    EXPECT_EQ(deltaCount, 2);
+    ASSERT_EQ(delta.size(), 2);
+    EXPECT_TRUE(delta.contains(firstPass));
+    EXPECT_TRUE(delta.contains(secondPass));
+    EXPECT_NE(delta.at(firstPass), oldEvents.at(firstPass));
+    EXPECT_NE(delta.at(secondPass), oldEvents.at(secondPass));
+
+    // [WHEN] Nothing has been changed in the range
+    changes.changedTypes = { ElementType::PEDAL };
+
+    score->changesChannel().send(changes);
+
+    // [THEN] Nothing is sent
+    EXPECT_EQ(mainStreamCount, 0);
+    EXPECT_EQ(deltaCount, 2);
+}
+
+/**
+ * @brief PlaybackModelTests_SimpleRepeat_Changes_Delta
+ * @details The same score as above. The velocity of the 1st note is changed, so that only its timestamp
+ *          has to be sent on the delta channel, instead of the whole track on the main stream channel
+ */
+TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Delta)
+{
+    // [GIVEN] Simple piece of score (Violin, 4/4, 120 bpm, Treble Cleff)
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "repeat_range/repeat_range.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 1);
+
+    const Part* part = score->parts().at(0);
+    ASSERT_TRUE(part);
+
+    // [GIVEN] The articulation profiles repository will be returning profiles for StringsArticulation family
+    ON_CALL(*m_repositoryMock, defaultProfile(_)).WillByDefault(Return(m_defaultProfile));
+
+    // [GIVEN] The playback model requested to be loaded
+    PlaybackModel model(modularity::globalCtx());
+    model.profilesRepository.set(m_repositoryMock);
+    model.load(score);
+
+    PlaybackData result = model.resolveTrackPlaybackData(part->id(), part->instrumentId());
+    const PlaybackEventsMap oldEvents = result.originEvents;
+    ASSERT_EQ(oldEvents.size(), 24);
+
+    // [GIVEN] The 1st note of the score
+    Chord* chord = score->firstMeasure()->findChord(Fraction(0, 1), 0);
+    ASSERT_TRUE(chord);
+    ASSERT_FALSE(chord->notes().empty());
+
+    // [THEN] Only the changed timestamp will be sent
+    bool mainStreamReceived = false;
+    result.mainStream.onReceive(this, [&mainStreamReceived](const PlaybackEventsMap&, const DynamicLevelLayers&) {
+        mainStreamReceived = true;
+    });
+
+    PlaybackEventsMap delta;
+    result.mainStreamDelta.onReceive(this, [&delta](const PlaybackEventsMap& changes, const DynamicLevelLayers&) {
+        delta = changes;
+    });
+
+    // [WHEN] The velocity of the 1st note has been changed
+    chord->notes().front()->setUserVelocity(40);
+
+    ScoreChanges changes;
+    changes.tickFrom = 0;
+    changes.tickTo = 480;
     changes.staffIdxFrom = 0;
     changes.staffIdxTo = 0;
-    changes.changedTypes = { ElementType::PEDAL };
+    changes.changedTypes = { ElementType::NOTE };
 
     score->changesChannel().send(changes);
+
+    EXPECT_FALSE(mainStreamReceived);
+    ASSERT_EQ(delta.size(), 1);
+    EXPECT_EQ(delta.begin()->first, oldEvents.begin()->first);
+    EXPECT_FALSE(delta.begin()->second.empty());
+    EXPECT_NE(delta.begin()->second, oldEvents.begin()->second);
+
+    // [THEN] The statistics describe the update
+    const PlaybackModel::UpdateStatistics& statistics = model.updateStatistics();
+    EXPECT_EQ(statistics.changedTracks, 1);
+    EXPECT_EQ(statistics.deltaTracks, 1);
+    EXPECT_EQ(statistics.changedTimestamps, 1);
+    EXPECT_EQ(statistics.changedEvents, delta.begin()->second.size());
+    EXPECT_GT(statistics.renderedItems, 0);
+    EXPECT_GT(statistics.trackEvents, statistics.changedEvents);
 }
 
 /**
@@ -1353,3 +1534,77 @@ TEST_F(Engraving_PlaybackModelTests, Playback_Setup_Data_MultiInstrument)
         }
     }
 }
+
+/**
+ * @brief PlaybackModelTests_ParallelLoading
+ * @details Every track is rendered on the task scheduler, the merged result must match the serial loading
+ */
+TEST_F(Engraving_PlaybackModelTests, ParallelLoading)
+{
+    // [GIVEN] The articulation profiles repository will be returning profiles
+    m_defaultProfile->setPattern(ArticulationType::Standard, buildTestArticulationPattern());
+    m_defaultProfile->setPattern(ArticulationType::Pedal, buildTestArticulationPattern());
+
+    ON_CALL(*m_repositoryMock, defaultProfile(_)).WillByDefault(Return(m_defaultProfile));
+
+    // [GIVEN] Scores with several parts, repeats, measure repeats, dynamics and spanners
+    const std::vector<String> fileNames {
+        u"playback_setup_instruments/playback_setup_instruments.mscx",
+        u"wrong_articulations/wrong_articulations.mscx",
+        u"dal_segno_al_coda/dal_segno_al_coda.mscx",
+        u"multi_measure_repeat/multi_measure_repeat.mscx",
+        u"dynamics/dynamics.mscx",
+        u"spanners/spanners.mscx",
+    };
+
+    for (const String& fileName : fileNames) {
+        Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + fileName);
+        ASSERT_TRUE(score);
+
+        // [THEN] Both models have the same events
+        expectSameParallelLoading(score);
+
+        delete score;
+    }
+}
+
+//! Playback model loading benchmark over a directory of scores, serial and parallel.
+//! Disabled unless MUE_PLAYBACK_BENCHMARK_DIR is set, e.g.
+//!   MUE_PLAYBACK_BENCHMARK_DIR=~/scores ./engraving_tests --gtest_filter=*PlaybackModelTests.LoadingBenchmark
+TEST_F(Engraving_PlaybackModelTests, LoadingBenchmark)
+{
+    const char* corpusDir = std::getenv("MUE_PLAYBACK_BENCHMARK_DIR");
+    if (!corpusDir) {
+        GTEST_SKIP() << "MUE_PLAYBACK_BENCHMARK_DIR is not set";
+    }
+
+    RetVal<io::paths_t> files = io::Dir::scanFiles(corpusDir, { "*.mscz", "*.mscx" });
+    ASSERT_TRUE(files.ret);
+
+    m_defaultProfile->setPattern(ArticulationType::Standard, buildTestArticulationPattern());
+    ON_CALL(*m_repositoryMock, defaultProfile(_)).WillByDefault(Return(m_defaultProfile));
+
+    double serialTotal = 0.0;
+    double parallelTotal = 0.0;
+
+    for (const io::path_t& path : files.val) {
+        Score* score = ScoreRW::readScore(path.toString(), true);
+        if (!score) {
+            continue;
+        }
+
+        double serialMsecs = 0.0;
+        double parallelMsecs = 0.0;
+        expectSameParallelLoading(score, &serialMsecs, &parallelMsecs);
+
+        LOGI() << path.toStdString() << ": parts: " << score->parts().size() << ", serial: " << serialMsecs << " ms, parallel: "
+               << parallelMsecs << " ms";
+
+        serialTotal += serialMsecs;
+        parallelTotal += parallelMsecs;
+
+        delete score;
+    }
+
+    LOGI() << "total serial: " << serialTotal << " ms, parallel: " << parallelTotal << " ms";
+}
@@ -0,0 +1,164 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cfloat>
+#include <random>
+#include <utility>
+
+#include "engraving/dom/engravingitem.h"
+#include "engraving/infrastructure/shape.h"
+
+using namespace mu::engraving;
+
+class Engraving_ShapeTests : public ::testing::Test
+{
+public:
+    static Shape randomShape(std::mt19937& gen, size_t size)
+    {
+        std::uniform_real_distribution<double> pos(-50.0, 50.0);
+        std::uniform_real_distribution<double> extent(0.0, 10.0);
+
+        Shape shape;
+        for (size_t i = 0; i < size; ++i) {
+            // include some zero-width and zero-height rects, they have special meaning for collisions
+            double width = i % 5 == 0 ? 0.0 : extent(gen);
+            double height = i % 7 == 0 ? 0.0 : extent(gen);
+            shape.add(RectF(pos(gen), pos(gen), width, height));
+        }
+
+        return shape;
+    }
+};
+
+/**
+ * @brief Engraving_ShapeTests_PackedVerticalDistance
+ * @details Check that the vectorized path for large shapes gives exactly the same
+ *          minVerticalDistance and verticalClearance as testing one rect at a time
+ */
+TEST_F(Engraving_ShapeTests, PackedVerticalDistance)
+{
+    std::mt19937 gen(42);
+
+    for (int i = 0; i < 200; ++i) {
+        // [GIVEN] A large shape above and another shape below
+        Shape above = randomShape(gen, 20 + i % 30);
+        Shape below = randomShape(gen, 2 + i % 10);
+        double clearance = i % 2 ? 0.0 : 1.5;
+
+        // [WHEN] Computing the expected values using single-rect shapes (scalar path)
+        double expectedDistance = -DBL_MAX;
+        double expectedClearance = DBL_MAX;
+        for (const ShapeElement& el : std::as_const(above).elements()) {
+            Shape single(el);
+            expectedDistance = std::max(expectedDistance, single.minVerticalDistance(below, clearance));
+            expectedClearance = std::min(expectedClearance, single.verticalClearance(below, clearance));
+        }
+
+        // [THEN] The results for the whole shape are identical
+        EXPECT_EQ(above.minVerticalDistance(below, clearance), expectedDistance);
+        EXPECT_EQ(above.verticalClearance(below, clearance), expectedClearance);
+    }
+}
+
+/**
+ * @brief Engraving_ShapeTests_PackedHorizontalDistance
+ * @details Check that the vectorized path for large shapes gives exactly the same
+ *          minHorizontalDistance as testing one rect at a time, for every kind of kerning
+ */
+TEST_F(Engraving_ShapeTests, PackedHorizontalDistance)
+{
+    std::mt19937 gen(7);
+
+    const KerningType kernings[] = {
+        KerningType::KERNING,
+        KerningType::NON_KERNING,
+        KerningType::KERN_UNTIL_LEFT_EDGE,
+        KerningType::KERN_UNTIL_CENTER,
+        KerningType::KERN_UNTIL_RIGHT_EDGE,
+    };
+
+    for (int i = 0; i < 200; ++i) {
+        // [GIVEN] A large shape on the left and another shape on the right
+        const Shape left = randomShape(gen, 20 + i % 30);
+        const Shape right = randomShape(gen, 2 + i % 10);
+
+        Shape::HorizontalDistanceRule rule;
+        rule.verticalClearance = i % 3 ? 0.0 : 1.5;
+        rule.padding = i % 2 ? 0.0 : 0.25;
+        rule.kerning = kernings[i % std::size(kernings)];
+        rule.alwaysCollide = i % 11 == 0;
+
+        for (const ShapeElement& r2 : right.elements()) {
+            // [WHEN] Computing the expected value using single-rect shapes (scalar path)
+            double expected = -DBL_MAX;
+            for (const ShapeElement& el : left.elements()) {
+                Shape single(el);
+                expected = single.minHorizontalDistance(0, 1, r2, rule, expected);
+            }
+
+            // [THEN] The result for the whole shape is identical
+            EXPECT_EQ(left.minHorizontalDistance(0, left.size(), r2, rule, -DBL_MAX), expected);
+        }
+    }
+}
+
+/**
+ * @brief Engraving_ShapeTests_PackedEdgesFollowModifications
+ * @details Check that the packed edges are updated when a large shape is modified,
+ *          and aren't used after its elements were accessed for writing
+ */
+TEST_F(Engraving_ShapeTests, PackedEdgesFollowModifications)
+{
+    std::mt19937 gen(13);
+
+    auto scalarDistance = [](const Shape& above, const Shape& below) {
+        double dist = -DBL_MAX;
+        for (const ShapeElement& el : above.elements()) {
+            dist = std::max(dist, Shape(el).minVerticalDistance(below));
+        }
+        return dist;
+    };
+
+    // [GIVEN] A large shape and another one below
+    Shape above = randomShape(gen, 30);
+    const Shape below = randomShape(gen, 5);
+
+    // [WHEN] It is translated, extended and padded
+    above.translate(PointF(3.0, -2.0));
+    above.add(randomShape(gen, 10));
+    above.translateX(1.25);
+    above.pad(0.5);
+    above.remove(std::as_const(above).elements().front());
+
+    // [THEN] The distance is still the same as testing one rect at a time
+    EXPECT_EQ(above.minVerticalDistance(below), scalarDistance(above, below));
+
+    // [WHEN] Its elements are modified directly
+    for (ShapeElement& el : above.elements()) {
+        el.translate(PointF(0.0, 5.0));
+    }
+
+    // [THEN] The distance takes the modification into account
+    EXPECT_EQ(above.minVerticalDistance(below), scalarDistance(above, below));
+}
@@ -0,0 +1,128 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cfloat>
+#include <random>
+
+#include "engraving/infrastructure/skyline.h"
+
+using namespace mu::engraving;
+
+class Engraving_SkylineTests : public ::testing::Test
+{
+public:
+    static RectF randomRect(std::mt19937& gen)
+    {
+        std::uniform_real_distribution<double> pos(-100.0, 100.0);
+        std::uniform_real_distribution<double> extent(0.0, 20.0);
+        return RectF(pos(gen), pos(gen), extent(gen), extent(gen));
+    }
+
+    static double bruteForceTop(const SkylineLine& line, double startX, double endX)
+    {
+        double top = DBL_MAX;
+        for (const ShapeElement& el : line.elements()) {
+            if (el.right() > startX && el.left() < endX) {
+                top = std::min(top, el.top());
+            }
+        }
+        return top == DBL_MAX ? 0.0 : top;
+    }
+
+    static double bruteForceBottom(const SkylineLine& line, double startX, double endX)
+    {
+        double bottom = -DBL_MAX;
+        for (const ShapeElement& el : line.elements()) {
+            if (el.right() > startX && el.left() < endX) {
+                bottom = std::max(bottom, el.bottom());
+            }
+        }
+        return bottom == -DBL_MAX ? 0.0 : bottom;
+    }
+};
+
+/**
+ * @brief Engraving_SkylineTests_RangeQueries
+ * @details Check that top() and bottom() over an x range give the same result as scanning all elements,
+ *          while elements are being added and removed
+ */
+TEST_F(Engraving_SkylineTests, RangeQueries)
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> pos(-120.0, 120.0);
+
+    SkylineLine line(true);
+
+    for (int i = 0; i < 300; ++i) {
+        // [GIVEN] A skyline line which is modified between queries
+        line.add(randomRect(gen), nullptr);
+        if (i % 50 == 49) {
+            line.remove_if([](const ShapeElement& el) { return el.width() < 2.0; });
+        }
+
+        // [WHEN] Querying a random range
+        double startX = pos(gen);
+        double endX = startX + std::abs(pos(gen));
+
+        // [THEN] The result is the same as the brute force one
+        EXPECT_EQ(line.top(startX, endX), bruteForceTop(line, startX, endX));
+        EXPECT_EQ(line.bottom(startX, endX), bruteForceBottom(line, startX, endX));
+    }
+
+    EXPECT_EQ(line.top(), bruteForceTop(line, -DBL_MAX, DBL_MAX));
+    EXPECT_EQ(line.bottom(), bruteForceBottom(line, -DBL_MAX, DBL_MAX));
+}
+
+/**
+ * @brief Engraving_SkylineTests_FilteredCopyInRange
+ * @details Check that restricting a skyline to the x range of a shape doesn't change its distance to that shape
+ */
+TEST_F(Engraving_SkylineTests, FilteredCopyInRange)
+{
+    std::mt19937 gen(11);
+
+    SkylineLine line(false);
+    for (int i = 0; i < 200; ++i) {
+        line.add(randomRect(gen), nullptr);
+    }
+
+    auto keepAll = [](const ShapeElement&) { return false; };
+
+    for (int i = 0; i < 100; ++i) {
+        // [GIVEN] A shape below the skyline
+        Shape shape;
+        for (int j = 0; j < 3; ++j) {
+            shape.add(randomRect(gen).translated(PointF(0.0, 50.0)));
+        }
+        const double clearance = i % 2 ? 0.0 : 2.0;
+
+        // [WHEN] Copying only the part of the skyline around the shape
+        const RectF bbox = shape.bbox();
+        SkylineLine inRange = line.getFilteredCopy(keepAll, bbox.left() - clearance, bbox.right() + clearance);
+
+        // [THEN] The distance to the shape stays the same
+        EXPECT_LE(inRange.elements().size(), line.elements().size());
+        EXPECT_EQ(inRange.minDistanceToShapeBelow(shape, clearance), line.minDistanceToShapeBelow(shape, clearance));
+    }
+}
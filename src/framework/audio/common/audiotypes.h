@@ -126,6 +126,13 @@ struct AudioEngineConfig {
     bool autoProcessOnlineSoundsInBackground = false;
 };
 
+struct AudioCallbackStats {
+    uint64_t callbackCount = 0;
+    uint64_t underrunCount = 0;         // callbacks that didn't get all the requested samples
+    samples_t missingSamples = 0;       // samples per channel replaced by silence
+    msecs_t maxCallbackDuration = 0;    // microseconds
+};
+
 using AudioSourceName = std::string;
 using AudioResourceId = std::string;
 using AudioResourceIdList = std::vector<AudioResourceId>;
@@ -21,7 +21,10 @@
  */
 #pragma once
 
+#include <any>
 #include <functional>
+#include <memory>
+#include <tuple>
 
 #include "global/modularity/imoduleinterface.h"
 
@@ -223,11 +226,28 @@ inline std::string to_string(MsgType t)
     return std::to_string(static_cast<int>(t));
 }
 
+//! NOTE Immutable values handed over as they are, without packing,
+//! when both sides of the channel run in the same address space
+using Values = std::shared_ptr<const std::any>;
+
+template<typename ... Types>
+inline Values make_values(Types&&... args)
+{
+    return std::make_shared<const std::any>(std::in_place_type<std::tuple<std::decay_t<Types>...> >, std::forward<Types>(args)...);
+}
+
+template<typename ... Types>
+inline const std::tuple<Types...>* values_cast(const Values& values)
+{
+    return values ? std::any_cast<std::tuple<Types...> >(values.get()) : nullptr;
+}
+
 struct Msg {
     CallId callId = 0;
     Method method = Method::Undefined;
     MsgType type = MsgType::Undefined;
     ByteArray data;
+    Values values;
 };
 
 using Handler = std::function<void (const Msg& msg)>;
@@ -237,6 +257,7 @@ enum class StreamName {
     Undefined = -1,
 
     PlaybackDataMainStream,
+    PlaybackDataMainStreamDelta,
     PlaybackDataOffStream,
 
     AudioSignalStream,
@@ -254,6 +275,7 @@ inline std::string to_string(StreamName n)
     switch (n) {
     case StreamName::Undefined: return "Undefined";
     case StreamName::PlaybackDataMainStream: return "PlaybackDataMainStream";
+    case StreamName::PlaybackDataMainStreamDelta: return "PlaybackDataMainStreamDelta";
     case StreamName::PlaybackDataOffStream: return "PlaybackDataOffStream";
     case StreamName::AudioSignalStream: return "AudioSignalStream";
     case StreamName::AudioMasterSignalStream: return "AudioMasterSignalStream";
@@ -290,6 +312,7 @@ struct StreamMsg {
     StreamName name = StreamName::Undefined;
     StreamId streamId = 0;
     ByteArray data;
+    Values values;
 };
 
 using StreamHandler = std::function<void (const StreamMsg& msg)>;
@@ -355,6 +378,9 @@ public:
 
     virtual void process() = 0;
 
+    //! NOTE If true, the values are passed as they are instead of being packed (see Values)
+    virtual bool isSameAddressSpace() const = 0;
+
     virtual void send(const Msg& msg, const Handler& onResponse = nullptr) = 0;
     virtual void onMethod(Method method, Handler h) = 0;
     virtual void listenAll(Handler h) = 0;
@@ -391,14 +417,30 @@ void RpcStream<Types...>::init()
 
     switch (m_type) {
     case StreamType::Send: {
-        m_ch.onReceive(this, [this](const Types... args) {
-                ByteArray data = RpcPacker::pack(args ...);
-                m_rpc->sendStream(StreamMsg { m_name, m_streamId, data });
+        m_ch.onReceive(this, [this](const Types&... args) {
+                if (m_rpc->isSameAddressSpace()) {
+                    m_rpc->sendStream(StreamMsg { m_name, m_streamId, ByteArray(), make_values(args ...) });
+                } else {
+                    ByteArray data = RpcPacker::pack(args ...);
+                    m_rpc->sendStream(StreamMsg { m_name, m_streamId, data, nullptr });
+                }
             });
     } break;
     case StreamType::Receive: {
         m_rpc->onStream(m_streamId, [this](const StreamMsg& msg) {
                 std::function<void()> func = [this, msg]() {
+                    if (msg.values) {
+                        const std::tuple<Types...>* values = values_cast<Types...>(msg.values);
+                        IF_ASSERT_FAILED(values) {
+                            return;
+                        }
+
+                        std::apply([this](const auto&... args) {
+                            m_ch.send(args ...);
+                        }, *values);
+                        return;
+                    }
+
                     std::tuple<Types...> values;
                     bool success = std::apply([msg](auto&... args) {
                         return RpcPacker::unpack(msg.data, args ...);
@@ -482,4 +524,31 @@ inline Msg make_notification(Method m, const ByteArray& data = ByteArray())
     msg.data = data;
     return msg;
 }
+
+//! NOTE For the big payloads, packs the args only if the channel needs it
+template<typename ... Types>
+inline void set_payload(const IRpcChannel* channel, Msg& msg, Types&&... args)
+{
+    if (channel->isSameAddressSpace()) {
+        msg.values = make_values(std::forward<Types>(args)...);
+    } else {
+        msg.data = RpcPacker::pack(args ...);
+    }
+}
+
+template<typename ... Types>
+inline bool get_payload(const Msg& msg, Types&... args)
+{
+    if (!msg.values) {
+        return RpcPacker::unpack(msg.data, args ...);
+    }
+
+    const std::tuple<Types...>* values = values_cast<Types...>(msg.values);
+    if (!values) {
+        return false;
+    }
+
+    std::tie(args ...) = *values;
+    return true;
+}
 }
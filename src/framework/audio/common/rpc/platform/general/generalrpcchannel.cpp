@@ -67,6 +67,11 @@ void GeneralRpcChannel::process()
     }
 }
 
+bool GeneralRpcChannel::isSameAddressSpace() const
+{
+    return true;
+}
+
 void GeneralRpcChannel::receive(RpcData& from, RpcData& to) const
 {
     MsgQueue msgQueue;
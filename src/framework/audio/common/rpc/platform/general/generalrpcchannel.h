@@ -38,6 +38,7 @@ public:
     void setupOnEngine() override;
 
     void process() override;
+    bool isSameAddressSpace() const override;
 
     // IRpcChannel
     // msgs
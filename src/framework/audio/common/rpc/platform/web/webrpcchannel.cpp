@@ -100,6 +100,11 @@ void WebRpcChannel::process()
     //noop
 }
 
+bool WebRpcChannel::isSameAddressSpace() const
+{
+    return false;
+}
+
 void WebRpcChannel::send(const Msg& msg, const Handler& onResponse)
 {
     RPCLOG() << "callId: " << msg.callId
@@ -33,6 +33,7 @@ public:
     void setupOnEngine() override;
 
     void process() override;
+    bool isSameAddressSpace() const override;
 
     void send(const Msg& msg, const Handler& onResponse = nullptr) override;
     void onMethod(Method method, Handler h) override;
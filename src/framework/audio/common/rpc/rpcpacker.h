@@ -25,12 +25,22 @@
 
 #include "global/serialization/msgpack_forward.h"
 #include "audio/common/audiotypes.h"
+#include "audio/common/soundfonttypes.h"
 
 #include "log.h"
 
 void pack_custom(muse::msgpack::Packer& p, const muse::audio::AudioEngineConfig& value);
 void unpack_custom(muse::msgpack::UnPacker& p, muse::audio::AudioEngineConfig& value);
 
+void pack_custom(muse::msgpack::Packer& p, const muse::midi::Program& value);
+void unpack_custom(muse::msgpack::UnPacker& p, muse::midi::Program& value);
+
+void pack_custom(muse::msgpack::Packer& p, const muse::audio::synth::SoundFontPreset& value);
+void unpack_custom(muse::msgpack::UnPacker& p, muse::audio::synth::SoundFontPreset& value);
+
+void pack_custom(muse::msgpack::Packer& p, const muse::audio::synth::SoundFontMeta& value);
+void unpack_custom(muse::msgpack::UnPacker& p, muse::audio::synth::SoundFontMeta& value);
+
 void pack_custom(muse::msgpack::Packer& p, const muse::audio::OutputSpec& value);
 void unpack_custom(muse::msgpack::UnPacker& p, muse::audio::OutputSpec& value);
 
@@ -131,6 +141,36 @@ inline void unpack_custom(muse::msgpack::UnPacker& p, muse::audio::AudioEngineCo
     p.process(value.autoProcessOnlineSoundsInBackground);
 }
 
+inline void pack_custom(muse::msgpack::Packer& p, const muse::midi::Program& value)
+{
+    p.process(value.bank, value.program);
+}
+
+inline void unpack_custom(muse::msgpack::UnPacker& p, muse::midi::Program& value)
+{
+    p.process(value.bank, value.program);
+}
+
+inline void pack_custom(muse::msgpack::Packer& p, const muse::audio::synth::SoundFontPreset& value)
+{
+    p.process(value.program, value.name);
+}
+
+inline void unpack_custom(muse::msgpack::UnPacker& p, muse::audio::synth::SoundFontPreset& value)
+{
+    p.process(value.program, value.name);
+}
+
+inline void pack_custom(muse::msgpack::Packer& p, const muse::audio::synth::SoundFontMeta& value)
+{
+    p.process(value.name, value.path, value.presets);
+}
+
+inline void unpack_custom(muse::msgpack::UnPacker& p, muse::audio::synth::SoundFontMeta& value)
+{
+    p.process(value.name, value.path, value.presets);
+}
+
 inline void pack_custom(muse::msgpack::Packer& p, const muse::audio::OutputSpec& value)
 {
     p.process(value.sampleRate, value.samplesPerChannel, value.audioChannelCount);
@@ -431,6 +471,8 @@ inline void unpack_custom(muse::msgpack::UnPacker& p, muse::mpe::NoteEvent& valu
     muse::mpe::PitchContext pitchCtx;
     muse::mpe::ExpressionContext exprCtx;
     p.process(arrCtx, pitchCtx, exprCtx);
+    muse::mpe::shareEqualCurve(pitchCtx.pitchCurve);
+    muse::mpe::shareEqualCurve(exprCtx.expressionCurve);
     value = muse::mpe::NoteEvent(std::move(arrCtx), std::move(pitchCtx), std::move(exprCtx));
 }
 
@@ -83,6 +83,7 @@ set(AUDIO_ENGINE_SRC
     # ${CMAKE_CURRENT_LIST_DIR}/internal/noisesource.cpp
     # ${CMAKE_CURRENT_LIST_DIR}/internal/noisesource.h
     ${CMAKE_CURRENT_LIST_DIR}/internal/abstracteventsequencer.h
+    ${CMAKE_CURRENT_LIST_DIR}/internal/eventtimeline.h
 
     # DSP
     ${CMAKE_CURRENT_LIST_DIR}/internal/dsp/envelopefilterconfig.h
@@ -91,6 +92,7 @@ set(AUDIO_ENGINE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/internal/dsp/limiter.cpp
     ${CMAKE_CURRENT_LIST_DIR}/internal/dsp/limiter.h
     ${CMAKE_CURRENT_LIST_DIR}/internal/dsp/audiomathutils.h
+    ${CMAKE_CURRENT_LIST_DIR}/internal/dsp/mixkernels.h
 
     # FX
     ${CMAKE_CURRENT_LIST_DIR}/internal/fx/abstractfxresolver.cpp
@@ -124,6 +126,8 @@ set(AUDIO_ENGINE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/internal/synthesizers/abstractsynthesizer.h
     ${CMAKE_CURRENT_LIST_DIR}/internal/synthesizers/soundfontrepository.cpp
     ${CMAKE_CURRENT_LIST_DIR}/internal/synthesizers/soundfontrepository.h
+    ${CMAKE_CURRENT_LIST_DIR}/internal/synthesizers/soundfontindex.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/internal/synthesizers/soundfontindex.h
     ${CMAKE_CURRENT_LIST_DIR}/internal/synthesizers/fluidsynth/soundmapping.h
     ${CMAKE_CURRENT_LIST_DIR}/internal/synthesizers/fluidsynth/sfcachedloader.h
     ${CMAKE_CURRENT_LIST_DIR}/internal/synthesizers/fluidsynth/fluidsynth.cpp
@@ -52,6 +52,6 @@ public:
 
     virtual void processAudioData() = 0;
     virtual samples_t process(float* buffer, samples_t samplesPerChannel) = 0;
-    virtual void popAudioData(float* dest, size_t sampleCount) = 0;
+    virtual samples_t popAudioData(float* dest, size_t sampleCount) = 0;
 };
 }
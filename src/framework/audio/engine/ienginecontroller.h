@@ -33,6 +33,7 @@ public:
     virtual ~IEngineController() = default;
 
     virtual void registerExports() = 0;
+    virtual void onInit() = 0; // on the main thread, before the engine thread is started
     virtual void onStartRunning() = 0;
     virtual void init(const OutputSpec& outputSpec, const AudioEngineConfig& conf) = 0;
     virtual void deinit() = 0;
@@ -23,6 +23,7 @@
 #ifndef MUSE_AUDIO_ABSTRACTEVENTSEQUENCER_H
 #define MUSE_AUDIO_ABSTRACTEVENTSEQUENCER_H
 
+#include <limits>
 #include <map>
 #include <set>
 
@@ -32,6 +33,8 @@
 #include "audio/common/audiosanitizer.h"
 #include "audio/common/audiotypes.h"
 
+#include "eventtimeline.h"
+
 namespace muse::audio::engine {
 template<class ... Types>
 class AbstractEventSequencer : public async::Asyncable
@@ -40,8 +43,8 @@ public:
     using EventType = std::variant<Types...>;
     using EventSequence = std::set<EventType>;
     using EventSequenceMap = std::map<msecs_t, EventSequence>;
+    using Timeline = EventTimeline<EventType>;
 
-    typedef typename EventSequenceMap::const_iterator SequenceIterator;
     typedef typename EventSequence::const_iterator EventIterator;
 
     AbstractEventSequencer()
@@ -52,6 +55,7 @@ public:
     virtual ~AbstractEventSequencer()
     {
         m_playbackData.mainStream.resetOnReceive(this);
+        m_playbackData.mainStreamDelta.resetOnReceive(this);
         m_playbackData.offStream.resetOnReceive(this);
     }
 
@@ -60,18 +64,26 @@ public:
         ONLY_AUDIO_ENGINE_THREAD;
 
         m_playbackData = data;
+        resetSostenutoTimestamps();
 
         m_playbackData.mainStream.onReceive(this, [this](const mpe::PlaybackEventsMap& events,
                                                          const mpe::DynamicLevelLayers& dynamics) {
             m_playbackData.originEvents = events;
             m_playbackData.dynamics = dynamics;
+            resetSostenutoTimestamps();
             m_shouldUpdateMainStreamEvents = true;
+            m_maxEventSpan = -1;
 
             if (m_isActive || m_updateMainStreamWhenInactive) {
                 updateMainStream();
             }
         });
 
+        m_playbackData.mainStreamDelta.onReceive(this, [this](const mpe::PlaybackEventsMap& changes,
+                                                              const mpe::DynamicLevelLayers& dynamics) {
+            applyMainStreamDelta(changes, dynamics);
+        });
+
         m_playbackData.offStream.onReceive(this, [this](const mpe::PlaybackEventsMap& events,
                                                         const mpe::DynamicLevelLayers& dynamics,
                                                         bool flush) {
@@ -82,6 +94,7 @@ public:
             updateOffStreamEvents(events, dynamics);
         });
 
+        m_maxEventSpan = -1;
         updateMainStreamEvents(data.originEvents, data.dynamics);
     }
 
@@ -188,7 +201,7 @@ public:
         if (!m_isActive) {
             result.emplace(m_offstreamPosition, EventSequence());
 
-            if (m_currentOffSequenceIt == m_offStreamEvents.cend()) {
+            if (m_currentOffSequenceIdx >= m_offStreamEvents.size()) {
                 return result;
             }
 
@@ -202,7 +215,7 @@ public:
         result.emplace(m_playbackPosition, EventSequence());
         m_playbackPosition += nextMsecs;
 
-        if (m_currentMainSequenceIt == m_mainStreamEvents.cend()) {
+        if (m_currentMainSequenceIdx >= m_mainStreamEvents.size()) {
             return result;
         }
 
@@ -215,31 +228,67 @@ protected:
     virtual void updateOffStreamEvents(const mpe::PlaybackEventsMap& events, const mpe::DynamicLevelLayers& dynamics) = 0;
     virtual void updateMainStreamEvents(const mpe::PlaybackEventsMap& events, const mpe::DynamicLevelLayers& dynamics) = 0;
 
+    //! NOTE Replaces the main stream events of [from, to] only
+    //! events are all the origin events which may produce sequencer events in this range
+    virtual void updateMainStreamEventsInRange(const mpe::PlaybackEventsMap& /*events*/, const msecs_t /*from*/, const msecs_t /*to*/)
+    {
+        updateMainStreamEvents(m_playbackData.originEvents, m_playbackData.dynamics);
+    }
+
+    //! NOTE The articulations the sequencer renders as a sostenuto pedal
+    virtual const mpe::ArticulationTypeSet& sostenutoPedalTypes() const
+    {
+        static const mpe::ArticulationTypeSet empty;
+        return empty;
+    }
+
+    //! NOTE Whether a sostenuto pedal ends depends on the next pedal of the track,
+    //! so the pedal events can't be rendered for a part of a track which has them
+    bool hasSostenutoPedal() const
+    {
+        return !m_sostenutoTimestamps.empty();
+    }
+
+    void replaceMainStreamEvents(const msecs_t from, const msecs_t to, Timeline& events)
+    {
+        events.build();
+
+        typename Timeline::Entries entries(events.lowerBound(from), events.lowerBound(to + 1));
+        m_mainStreamEvents.replaceRange(from, to + 1, std::move(entries));
+
+        updateMainSequenceIterator();
+    }
+
     void resetAllIterators()
     {
         updateMainSequenceIterator();
         updateOffSequenceIterator();
     }
 
+    //! NOTE Sorts in the events added since the last update
     void updateMainSequenceIterator()
     {
-        m_currentMainSequenceIt = m_mainStreamEvents.lower_bound(m_playbackPosition);
+        m_mainStreamEvents.build();
+        m_currentMainSequenceIdx = m_mainStreamEvents.lowerBoundIndex(m_playbackPosition);
     }
 
     void updateOffSequenceIterator()
     {
-        m_currentOffSequenceIt = m_offStreamEvents.cbegin();
+        m_offStreamEvents.eraseFront(m_currentOffSequenceIdx);
+        m_offStreamEvents.build();
+        m_currentOffSequenceIdx = 0;
         m_offstreamPosition = 0;
     }
 
     void handleMainStream(EventSequenceMap& result)
     {
-        while (m_currentMainSequenceIt != m_mainStreamEvents.end()
-               && m_currentMainSequenceIt->first <= m_playbackPosition) {
-            EventSequence& sequence = result[m_currentMainSequenceIt->first];
-            sequence.insert(m_currentMainSequenceIt->second.cbegin(),
-                            m_currentMainSequenceIt->second.cend());
-            m_currentMainSequenceIt = std::next(m_currentMainSequenceIt);
+        const size_t size = m_mainStreamEvents.size();
+
+        while (m_currentMainSequenceIdx < size
+               && m_mainStreamEvents[m_currentMainSequenceIdx].first <= m_playbackPosition) {
+            const auto& entry = m_mainStreamEvents[m_currentMainSequenceIdx];
+            result[entry.first].insert(entry.second);
+            ++m_currentMainSequenceIdx;
         }
     }
 
@@ -249,15 +298,18 @@ protected:
             return;
         }
 
-        while (m_currentOffSequenceIt != m_offStreamEvents.end()
-               && m_currentOffSequenceIt->first <= m_offstreamPosition) {
-            EventSequence& sequence = result[m_currentOffSequenceIt->first];
-            sequence.insert(std::make_move_iterator(m_currentOffSequenceIt->second.begin()),
-                            std::make_move_iterator(m_currentOffSequenceIt->second.end()));
-            m_currentOffSequenceIt = m_offStreamEvents.erase(m_currentOffSequenceIt);
+        const size_t size = m_offStreamEvents.size();
+
+        while (m_currentOffSequenceIdx < size
+               && m_offStreamEvents[m_currentOffSequenceIdx].first <= m_offstreamPosition) {
+            auto& entry = m_offStreamEvents[m_currentOffSequenceIdx];
+            result[entry.first].insert(std::move(entry.second));
+            ++m_currentOffSequenceIdx;
         }
 
-        if (m_currentOffSequenceIt == m_offStreamEvents.end()) {
+        if (m_currentOffSequenceIdx == size) {
+            m_offStreamEvents.clear();
+            m_currentOffSequenceIdx = 0;
             m_offstreamPosition = 0;
         }
     }
@@ -265,10 +317,10 @@ protected:
     mutable msecs_t m_playbackPosition = 0;
     mutable msecs_t m_offstreamPosition = 0;
 
-    SequenceIterator m_currentMainSequenceIt;
-    SequenceIterator m_currentOffSequenceIt;
-    EventSequenceMap m_mainStreamEvents;
-    EventSequenceMap m_offStreamEvents;
+    size_t m_currentMainSequenceIdx = 0;
+    size_t m_currentOffSequenceIdx = 0;
+    Timeline m_mainStreamEvents;
+    Timeline m_offStreamEvents;
 
     mpe::PlaybackData m_playbackData;
 
@@ -278,8 +330,136 @@ protected:
     OnFlushedCallback m_onMainStreamFlushed;
 
 private:
+    static void extendEventsWindow(const mpe::timestamp_t timestamp, const mpe::PlaybackEventList& events, msecs_t& from, msecs_t& to)
+    {
+        from = std::min(from, timestamp);
+        to = std::max(to, timestamp);
+
+        for (const mpe::PlaybackEvent& event : events) {
+            if (!std::holds_alternative<mpe::NoteEvent>(event)) {
+                continue;
+            }
+
+            const mpe::NoteEvent& noteEvent = std::get<mpe::NoteEvent>(event);
+            const mpe::ArrangementContext& arrangementCtx = noteEvent.arrangementCtx();
+            from = std::min(from, arrangementCtx.actualTimestamp);
+            to = std::max(to, arrangementCtx.actualTimestamp + arrangementCtx.actualDuration);
+
+            for (const auto& artPair : noteEvent.expressionCtx().articulations) {
+                const mpe::ArticulationMeta& meta = artPair.second.meta;
+                from = std::min(from, meta.timestamp);
+                to = std::max(to, meta.timestamp + meta.overallDuration);
+            }
+        }
+    }
+
+    //! NOTE The longest time range a single timestamp of the origin events produces sequencer events for
+    void updateMaxEventSpan(const mpe::PlaybackEventsMap& events)
+    {
+        for (const auto& pair : events) {
+            msecs_t from = pair.first;
+            msecs_t to = pair.first;
+            extendEventsWindow(pair.first, pair.second, from, to);
+            m_maxEventSpan = std::max(m_maxEventSpan, to - from);
+        }
+    }
+
+    void applyMainStreamDelta(const mpe::PlaybackEventsMap& changes, const mpe::DynamicLevelLayers& dynamics)
+    {
+        ONLY_AUDIO_ENGINE_THREAD;
+
+        //! NOTE The window of the sequencer events produced by the old and the new events of the changed timestamps
+        msecs_t from = std::numeric_limits<msecs_t>::max();
+        msecs_t to = std::numeric_limits<msecs_t>::min();
+
+        for (const auto& pair : changes) {
+            auto it = m_playbackData.originEvents.find(pair.first);
+            if (it != m_playbackData.originEvents.cend()) {
+                extendEventsWindow(it->first, it->second, from, to);
+            }
+
+            extendEventsWindow(pair.first, pair.second, from, to);
+
+            if (pair.second.empty()) {
+                m_playbackData.originEvents.erase(pair.first);
+            } else {
+                m_playbackData.originEvents.insert_or_assign(pair.first, pair.second);
+            }
+
+            updateSostenutoTimestamp(pair.first, pair.second);
+        }
+
+        const bool dynamicsChanged = m_playbackData.dynamics != dynamics;
+        m_playbackData.dynamics = dynamics;
+
+        if (changes.empty() && !dynamicsChanged) {
+            return;
+        }
+
+        //! NOTE The sequence is already outdated, it will be rebuilt from the origin events anyway
+        if (m_shouldUpdateMainStreamEvents || dynamicsChanged || (!m_isActive && !m_updateMainStreamWhenInactive)) {
+            m_shouldUpdateMainStreamEvents = true;
+            m_maxEventSpan = -1;
+
+            if (m_isActive || m_updateMainStreamWhenInactive) {
+                updateMainStream();
+            }
+            return;
+        }
+
+        if (m_maxEventSpan < 0) {
+            m_maxEventSpan = 0;
+            updateMaxEventSpan(m_playbackData.originEvents);
+        } else {
+            updateMaxEventSpan(changes);
+        }
+
+        //! NOTE Every origin event whose sequencer events may fall into the window
+        mpe::PlaybackEventsMap events;
+        const mpe::PlaybackEventsMap& originEvents = m_playbackData.originEvents;
+        auto last = originEvents.upper_bound(to + m_maxEventSpan);
+        for (auto it = originEvents.lower_bound(from - m_maxEventSpan); it != last; ++it) {
+            events.insert(*it);
+        }
+
+        updateMainStreamEventsInRange(events, from, to);
+    }
+
+    void updateSostenutoTimestamp(const mpe::timestamp_t timestamp, const mpe::PlaybackEventList& events)
+    {
+        const mpe::ArticulationTypeSet& types = sostenutoPedalTypes();
+
+        for (const mpe::PlaybackEvent& event : events) {
+            if (!std::holds_alternative<mpe::NoteEvent>(event)) {
+                continue;
+            }
+
+            for (const auto& artPair : std::get<mpe::NoteEvent>(event).expressionCtx().articulations) {
+                if (types.find(artPair.second.meta.type) != types.cend()) {
+                    m_sostenutoTimestamps.insert(timestamp);
+                    return;
+                }
+            }
+        }
+
+        m_sostenutoTimestamps.erase(timestamp);
+    }
+
+    void resetSostenutoTimestamps()
+    {
+        m_sostenutoTimestamps.clear();
+
+        for (const auto& pair : m_playbackData.originEvents) {
+            updateSostenutoTimestamp(pair.first, pair.second);
+        }
+    }
+
     bool m_shouldUpdateMainStreamEvents = false;
     bool m_updateMainStreamWhenInactive = false;
+    msecs_t m_maxEventSpan = -1;
+
+    //! NOTE The timestamps of the origin events with a sostenuto pedal
+    std::set<mpe::timestamp_t> m_sostenutoTimestamps;
 };
 }
 
@@ -31,8 +31,6 @@ using namespace muse::audio::engine;
 static constexpr size_t DEFAULT_SIZE_PER_CHANNEL = 1024 * 8;
 static constexpr size_t DEFAULT_SIZE = DEFAULT_SIZE_PER_CHANNEL * 2;
 
-static const std::vector<float> SILENT_FRAMES(DEFAULT_SIZE, 0.f);
-
 //#define DEBUG_AUDIO
 #ifdef DEBUG_AUDIO
 #define LOG_AUDIO LOGD
@@ -195,30 +193,36 @@ void AudioBuffer::forward()
     m_writeIndex.store(nextWriteIdx, std::memory_order_release);
 }
 
-void AudioBuffer::pop(float* dest, size_t sampleCount)
+samples_t AudioBuffer::pop(float* dest, size_t sampleCount)
 {
+    const size_t totalSampleCount = sampleCount * m_audioChannelsCount;
+
     const auto currentReadIdx = m_readIndex.load(std::memory_order_relaxed);
     const auto currentWriteIdx = m_writeIndex.load(std::memory_order_acquire);
     if (currentReadIdx == currentWriteIdx) { // empty queue
-        std::memcpy(dest, SILENT_FRAMES.data(), sampleCount * sizeof(float) * m_audioChannelsCount);
-        return;
+        std::memset(dest, 0, totalSampleCount * sizeof(float));
+        return 0;
     }
 
+    //! NOTE Never read past the write index, otherwise the reader overtakes
+    //! the writer and the buffer plays stale data until the writer catches up
+    const size_t available = reservedFrames(currentWriteIdx, currentReadIdx);
+    const size_t samplesToRead = std::min(totalSampleCount, available);
+
 #ifdef DEBUG_AUDIO
-    if (reservedFrames(currentWriteIdx, currentReadIdx) < (sampleCount * m_audioChannelsCount)) {
+    if (samplesToRead < totalSampleCount) {
         static size_t missingFramesTotal = 0;
-        missingFramesTotal += (sampleCount * m_audioChannelsCount);
-        LOG_AUDIO() << "\n FRAMES MISSED " << sampleCount * m_audioChannelsCount << ", reserve: " <<
-            reservedFrames(currentWriteIdx, currentReadIdx) << ", total: " << missingFramesTotal;
+        missingFramesTotal += totalSampleCount - samplesToRead;
+        LOG_AUDIO() << "\n FRAMES MISSED " << totalSampleCount - samplesToRead << ", reserve: " <<
+            available << ", total: " << missingFramesTotal;
     }
 #endif
 
     size_t newReadIdx = currentReadIdx;
-    const size_t totalSampleCount = sampleCount * m_audioChannelsCount;
 
     size_t from = newReadIdx;
     auto memStep = sizeof(float);
-    size_t to = from + totalSampleCount;
+    size_t to = from + samplesToRead;
     if (to > DEFAULT_SIZE) {
         to = DEFAULT_SIZE;
     }
@@ -227,7 +231,7 @@ void AudioBuffer::pop(float* dest, size_t sampleCount)
     std::memcpy(dest, m_data.data() + from, count * memStep);
     newReadIdx += count;
 
-    size_t left = totalSampleCount - count;
+    size_t left = samplesToRead - count;
     if (left > 0) {
         std::memcpy(dest + count, m_data.data(), left * memStep);
         newReadIdx = left;
@@ -237,7 +241,13 @@ void AudioBuffer::pop(float* dest, size_t sampleCount)
         newReadIdx -= DEFAULT_SIZE;
     }
 
+    if (samplesToRead < totalSampleCount) {
+        std::memset(dest + samplesToRead, 0, (totalSampleCount - samplesToRead) * memStep);
+    }
+
     m_readIndex.store(newReadIdx, std::memory_order_release);
+
+    return samplesToRead / m_audioChannelsCount;
 }
 
 void AudioBuffer::reset()
@@ -245,7 +255,7 @@ void AudioBuffer::reset()
     m_readIndex.store(0, std::memory_order_release);
     m_writeIndex.store(0, std::memory_order_release);
 
-    m_data = SILENT_FRAMES;
+    std::fill(m_data.begin(), m_data.end(), 0.f);
 }
 
 audioch_t AudioBuffer::audioChannelCount() const
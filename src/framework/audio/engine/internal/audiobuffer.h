@@ -56,7 +56,10 @@ public:
     void setRenderStep(const samples_t renderStep);
 
     void forward();
-    void pop(float* dest, size_t sampleCount);
+
+    //! NOTE Returns the number of samples per channel taken from the buffer,
+    //! the rest of dest is filled with silence
+    samples_t pop(float* dest, size_t sampleCount);
 
     void reset();
 
@@ -219,10 +219,10 @@ void AudioEngine::processAudioData()
     m_buffer->forward();
 }
 
-void AudioEngine::popAudioData(float* dest, size_t sampleCount)
+samples_t AudioEngine::popAudioData(float* dest, size_t sampleCount)
 {
     // driver thread
-    m_buffer->pop(dest, sampleCount);
+    return m_buffer->pop(dest, sampleCount);
 }
 
 samples_t AudioEngine::fillSilent(float* buffer, samples_t samplesPerChannel)
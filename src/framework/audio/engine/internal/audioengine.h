@@ -64,7 +64,7 @@ public:
 
     void processAudioData() override;
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
-    void popAudioData(float* dest, size_t sampleCount) override;
+    samples_t popAudioData(float* dest, size_t sampleCount) override;
 
 private:
 
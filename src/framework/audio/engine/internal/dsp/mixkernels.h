@@ -0,0 +1,141 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSE_AUDIO_MIXKERNELS_H
+#define MUSE_AUDIO_MIXKERNELS_H
+
+#include <cstddef>
+
+#include "audio/common/audiotypes.h"
+
+#include "../fx/reverb/simdtypes.h"
+
+/*
+  Kernels for summing, gain and metering of interleaved buffers.
+  The scalar versions are the reference, they are also used for the tails.
+ */
+
+namespace muse::audio::dsp {
+//! NOTE The number of channels the per channel kernels work with
+static constexpr audioch_t MAX_MIX_CHANNELS = 8;
+
+namespace scalar {
+inline void mixSamples(float* dst, const float* src, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] += src[i];
+    }
+}
+
+inline void mixSamplesWithGain(float* dst, const float* src, float gain, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+/// multiplies every channel by its gain and returns the sum of squared results of each channel
+inline void applyGainsAndMeasure(float* buffer, audioch_t channelCount, samples_t samplesPerChannel,
+                                 const float* gains, float* squaredSums)
+{
+    for (audioch_t ch = 0; ch < channelCount; ++ch) {
+        squaredSums[ch] = 0.f;
+    }
+
+    for (samples_t s = 0; s < samplesPerChannel; ++s) {
+        for (audioch_t ch = 0; ch < channelCount; ++ch) {
+            const size_t idx = s * channelCount + ch;
+            const float sample = buffer[idx] * gains[ch];
+            buffer[idx] = sample;
+            squaredSums[ch] += sample * sample;
+        }
+    }
+}
+}
+
+inline void mixSamples(float* dst, const float* src, size_t count)
+{
+    using namespace muse::audio::fx::simd;
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        store_unaligned(dst + i, load_unaligned(dst + i) + load_unaligned(src + i));
+    }
+
+    scalar::mixSamples(dst + i, src + i, count - i);
+}
+
+inline void mixSamplesWithGain(float* dst, const float* src, float gain, size_t count)
+{
+    using namespace muse::audio::fx::simd;
+
+    const float_x4 gainX4(gain);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        store_unaligned(dst + i, load_unaligned(dst + i) + load_unaligned(src + i) * gainX4);
+    }
+
+    scalar::mixSamplesWithGain(dst + i, src + i, gain, count - i);
+}
+
+inline void applyGainsAndMeasure(float* buffer, audioch_t channelCount, samples_t samplesPerChannel,
+                                 const float* gains, float* squaredSums)
+{
+    using namespace muse::audio::fx::simd;
+
+    //! NOTE A vector of 4 interleaved samples has the same channel layout every time
+    //! only if the channel count divides 4
+    if (channelCount == 0 || 4 % channelCount != 0) {
+        scalar::applyGainsAndMeasure(buffer, channelCount, samplesPerChannel, gains, squaredSums);
+        return;
+    }
+
+    const float_x4 gainsX4(gains[0 % channelCount], gains[1 % channelCount], gains[2 % channelCount], gains[3 % channelCount]);
+    float_x4 sumsX4(0.f);
+
+    const size_t count = samplesPerChannel * channelCount;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float_x4 samples = load_unaligned(buffer + i) * gainsX4;
+        store_unaligned(buffer + i, samples);
+        sumsX4 = sumsX4 + samples * samples;
+    }
+
+    for (audioch_t ch = 0; ch < channelCount; ++ch) {
+        squaredSums[ch] = 0.f;
+    }
+
+    for (int lane = 0; lane < 4; ++lane) {
+        squaredSums[lane % channelCount] += sumsX4[lane];
+    }
+
+    for (; i < count; ++i) {
+        const audioch_t ch = static_cast<audioch_t>(i % channelCount);
+        const float sample = buffer[i] * gains[ch];
+        buffer[i] = sample;
+        squaredSums[ch] += sample * sample;
+    }
+}
+}
+
+#endif // MUSE_AUDIO_MIXKERNELS_H
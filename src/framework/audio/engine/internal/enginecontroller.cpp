@@ -102,6 +102,11 @@ void EngineController::registerExports()
     ioc()->registerExport<ISoundFontRepository>(moduleName(), m_soundFontRepository);
 }
 
+void EngineController::onInit()
+{
+    m_soundFontRepository->init();
+}
+
 void EngineController::onStartRunning()
 {
     //! NOTE After sending a EngineRunning,
@@ -164,7 +169,7 @@ void EngineController::process()
     m_audioEngine->processAudioData();
 }
 
-void EngineController::popAudioData(float* stream, unsigned samplesPerChannel)
+samples_t EngineController::popAudioData(float* stream, unsigned samplesPerChannel)
 {
-    m_audioEngine->popAudioData(stream, samplesPerChannel);
+    return m_audioEngine->popAudioData(stream, samplesPerChannel);
 }
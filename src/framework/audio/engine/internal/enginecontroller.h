@@ -51,6 +51,7 @@ public:
     EngineController(std::shared_ptr<rpc::IRpcChannel> rpcChannel);
 
     void registerExports() override;
+    void onInit() override;
     void onStartRunning() override;
     void init(const OutputSpec& outputSpec, const AudioEngineConfig& conf) override;
     void deinit() override;
@@ -61,7 +62,7 @@ public:
     void process(float* stream, unsigned samplesPerChannel);
 
     void process();
-    void popAudioData(float* stream, unsigned samplesPerChannel);
+    samples_t popAudioData(float* stream, unsigned samplesPerChannel);
 
 private:
     std::shared_ptr<rpc::IRpcChannel> m_rpcChannel;
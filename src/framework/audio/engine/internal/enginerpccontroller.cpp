@@ -172,8 +172,10 @@ void EngineRpcController::init()
         mpe::PlaybackData playbackData;
         AudioParams params;
         rpc::StreamId mainStreamId = 0;
+        rpc::StreamId mainDeltaStreamId = 0;
         rpc::StreamId offStreamId = 0;
-        IF_ASSERT_FAILED(RpcPacker::unpack(msg.data, seqId, trackName, playbackData, params, mainStreamId, offStreamId)) {
+        IF_ASSERT_FAILED(rpc::get_payload(msg, seqId, trackName, playbackData, params,
+                                          mainStreamId, mainDeltaStreamId, offStreamId)) {
             return;
         }
 
@@ -186,6 +188,7 @@ void EngineRpcController::init()
         };
 
         channel()->addReceiveStream(StreamName::PlaybackDataMainStream, mainStreamId, playbackData.mainStream, mainExec);
+        channel()->addReceiveStream(StreamName::PlaybackDataMainStreamDelta, mainDeltaStreamId, playbackData.mainStreamDelta, mainExec);
         channel()->addReceiveStream(StreamName::PlaybackDataOffStream, offStreamId, playbackData.offStream, offExec);
 
         auto addTrackAndSendResponce = [this](const Msg& msg, const TrackSequenceId& seqId, const TrackName& trackName,
@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "audio/common/audiotypes.h"
+
+namespace muse::audio::engine {
+//! NOTE Flat, time ordered sequence of events
+//! Events are appended in any order with add() and sorted in at once with build(),
+//! events of the same time are ordered and deduplicated like in std::set
+template<class EventType>
+class EventTimeline
+{
+public:
+    using Entry = std::pair<msecs_t, EventType>;
+    using Entries = std::vector<Entry>;
+    using const_iterator = typename Entries::const_iterator;
+
+    void add(const msecs_t timestamp, const EventType& event)
+    {
+        m_entries.emplace_back(timestamp, event);
+        m_isSorted = false;
+    }
+
+    void add(const msecs_t timestamp, EventType&& event)
+    {
+        m_entries.emplace_back(timestamp, std::move(event));
+        m_isSorted = false;
+    }
+
+    void reserve(size_t count)
+    {
+        m_entries.reserve(count);
+    }
+
+    void build()
+    {
+        if (m_isSorted) {
+            return;
+        }
+
+        std::sort(m_entries.begin(), m_entries.end(), entryLess);
+        m_entries.erase(std::unique(m_entries.begin(), m_entries.end(), entryEqual), m_entries.end());
+        m_isSorted = true;
+    }
+
+    bool isBuilt() const
+    {
+        return m_isSorted;
+    }
+
+    //! NOTE Replaces the events of [from, to) with the given ones, the rest of the timeline is kept as is
+    void replaceRange(const msecs_t from, const msecs_t to, Entries&& events)
+    {
+        build();
+
+        std::sort(events.begin(), events.end(), entryLess);
+        events.erase(std::unique(events.begin(), events.end(), entryEqual), events.end());
+
+        const size_t firstIdx = lowerBoundIndex(from);
+        const size_t lastIdx = lowerBoundIndex(to);
+        const bool isInRange = events.empty() || (events.front().first >= from && events.back().first < to);
+
+        m_entries.erase(m_entries.begin() + firstIdx, m_entries.begin() + lastIdx);
+
+        if (isInRange) {
+            m_entries.insert(m_entries.begin() + firstIdx,
+                             std::make_move_iterator(events.begin()), std::make_move_iterator(events.end()));
+            return;
+        }
+
+        for (Entry& entry : events) {
+            m_entries.push_back(std::move(entry));
+        }
+
+        m_isSorted = false;
+        build();
+    }
+
+    //! NOTE Removes the first count events, e.g. the already played ones
+    void eraseFront(size_t count)
+    {
+        count = std::min(count, m_entries.size());
+        m_entries.erase(m_entries.begin(), m_entries.begin() + count);
+    }
+
+    void clear()
+    {
+        m_entries.clear();
+        m_isSorted = true;
+    }
+
+    bool empty() const { return m_entries.empty(); }
+    size_t size() const { return m_entries.size(); }
+
+    const_iterator begin() const { return m_entries.cbegin(); }
+    const_iterator end() const { return m_entries.cend(); }
+
+    const Entry& at(size_t idx) const { return m_entries.at(idx); }
+    Entry& operator[](size_t idx) { return m_entries[idx]; }
+    const Entry& operator[](size_t idx) const { return m_entries[idx]; }
+
+    //! NOTE Binary search, the timeline must be built
+    const_iterator lowerBound(const msecs_t timestamp) const
+    {
+        return std::lower_bound(m_entries.cbegin(), m_entries.cend(), timestamp, [](const Entry& entry, msecs_t t) {
+            return entry.first < t;
+        });
+    }
+
+    size_t lowerBoundIndex(const msecs_t timestamp) const
+    {
+        return static_cast<size_t>(std::distance(m_entries.cbegin(), lowerBound(timestamp)));
+    }
+
+private:
+    static bool entryLess(const Entry& e1, const Entry& e2)
+    {
+        if (e1.first != e2.first) {
+            return e1.first < e2.first;
+        }
+        return e1.second < e2.second;
+    }
+
+    static bool entryEqual(const Entry& e1, const Entry& e2)
+    {
+        return e1.first == e2.first && !(e1.second < e2.second) && !(e2.second < e1.second);
+    }
+
+    Entries m_entries;
+    bool m_isSorted = true;
+};
+}
@@ -22,6 +22,8 @@
 
 #include "soundtrackwriter.h"
 
+#include <chrono>
+
 #include "global/defer.h"
 #include "global/async/processevents.h"
 
@@ -42,6 +44,8 @@ using namespace muse::audio::soundtrack;
 static constexpr int PREPARE_STEP = 0;
 static constexpr int ENCODE_STEP = 1;
 
+static constexpr std::chrono::milliseconds OFFLINE_EVENTS_INTERVAL(50);
+
 static encode::AbstractAudioEncoderPtr createEncoder(const SoundTrackType type)
 {
     switch (type) {
@@ -151,6 +155,10 @@ Ret SoundTrackWriter::generateAudioData()
 
     sendStepProgress(PREPARE_STEP, inputBufferOffset, inputBufferMaxOffset);
 
+    using clock = std::chrono::steady_clock;
+    const clock::time_point renderStart = clock::now();
+    clock::time_point lastEventsProcessing = renderStart;
+
     while (inputBufferOffset < inputBufferMaxOffset && !m_isAborted) {
         m_source->process(m_intermBuffer.data(), m_renderStep);
 
@@ -165,10 +173,24 @@ Ret SoundTrackWriter::generateAudioData()
 
         //! NOTE It is necessary for cancellation to work
         //! and for information about the audio signal to be transmitted.
-        async::processEvents();
-        rpcChannel()->process();
+        //! There is no need to do it after every block, the render is far ahead of realtime
+        const clock::time_point now = clock::now();
+        if (now - lastEventsProcessing >= OFFLINE_EVENTS_INTERVAL) {
+            async::processEvents();
+            rpcChannel()->process();
+            lastEventsProcessing = now;
+        }
     }
 
+    async::processEvents();
+    rpcChannel()->process();
+
+    const double renderSecs = std::chrono::duration<double>(clock::now() - renderStart).count();
+    const OutputSpec& outputSpec = m_encoderPtr->format().outputSpec;
+    const double audioSecs = static_cast<double>(inputBufferOffset) / outputSpec.audioChannelCount / outputSpec.sampleRate;
+    LOGI() << "rendered " << audioSecs << " sec of audio in " << renderSecs << " sec, realtime factor: "
+           << (renderSecs > 0.0 ? audioSecs / renderSecs : 0.0);
+
     if (m_isAborted) {
         return make_ret(Ret::Code::Cancel);
     }
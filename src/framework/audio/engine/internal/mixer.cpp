@@ -21,10 +21,13 @@
  */
 #include "mixer.h"
 
+#include <array>
+
 #include "audio/common/audiosanitizer.h"
 #include "audio/common/audioerrors.h"
 
 #include "dsp/audiomathutils.h"
+#include "dsp/mixkernels.h"
 
 #include "muse_framework_config.h"
 
@@ -474,15 +477,7 @@ void Mixer::mixOutputFromChannel(float* outBuffer, const float* inBuffer, unsign
         return;
     }
 
-    for (samples_t s = 0; s < samplesCount; ++s) {
-        size_t samplePos = s * m_outputSpec.audioChannelCount;
-
-        for (audioch_t audioChNum = 0; audioChNum < m_outputSpec.audioChannelCount; ++audioChNum) {
-            size_t idx = samplePos + audioChNum;
-            float sample = inBuffer[idx];
-            outBuffer[idx] += sample;
-        }
-    }
+    dsp::mixSamples(outBuffer, inBuffer, samplesCount * m_outputSpec.audioChannelCount);
 }
 
 void Mixer::prepareAuxBuffers(size_t outBufferSize)
@@ -522,14 +517,7 @@ void Mixer::writeTrackToAuxBuffers(const float* trackBuffer, const AuxSendsParam
         float* auxBuffer = aux.buffer.data();
         float signalAmount = auxSend.signalAmount;
 
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            size_t samplePos = s * m_outputSpec.audioChannelCount;
-
-            for (audioch_t audioChNum = 0; audioChNum < m_outputSpec.audioChannelCount; ++audioChNum) {
-                size_t idx = samplePos + audioChNum;
-                auxBuffer[idx] += trackBuffer[idx] * signalAmount;
-            }
-        }
+        dsp::mixSamplesWithGain(auxBuffer, trackBuffer, signalAmount, samplesPerChannel * m_outputSpec.audioChannelCount);
 
         aux.receivedAudioSignal = true;
     }
@@ -557,26 +545,44 @@ void Mixer::completeOutput(float* buffer, samples_t samplesPerChannel)
         return;
     }
 
-    float totalSquaredSum = 0.f;
+    const audioch_t channelCount = m_outputSpec.audioChannelCount;
     float volume = muse::db_to_linear(m_masterParams.volume);
+    float totalSquaredSum = 0.f;
 
-    for (audioch_t audioChNum = 0; audioChNum < m_outputSpec.audioChannelCount; ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
-        gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * volume;
+    if (channelCount <= dsp::MAX_MIX_CHANNELS) {
+        std::array<gain_t, dsp::MAX_MIX_CHANNELS> gains;
+        std::array<float, dsp::MAX_MIX_CHANNELS> squaredSums;
+        for (audioch_t audioChNum = 0; audioChNum < channelCount; ++audioChNum) {
+            gains[audioChNum] = dsp::balanceGain(m_masterParams.balance, audioChNum) * volume;
+        }
 
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            int idx = s * m_outputSpec.audioChannelCount + audioChNum;
+        dsp::applyGainsAndMeasure(buffer, channelCount, samplesPerChannel, gains.data(), squaredSums.data());
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+        for (audioch_t audioChNum = 0; audioChNum < channelCount; ++audioChNum) {
+            totalSquaredSum += squaredSums[audioChNum];
 
-            float squaredSample = resultSample * resultSample;
-            totalSquaredSum += squaredSample;
-            singleChannelSquaredSum += squaredSample;
+            float rms = dsp::samplesRootMeanSquare(squaredSums[audioChNum], samplesPerChannel);
+            m_audioSignalNotifier.updateSignalValues(audioChNum, rms);
         }
+    } else {
+        for (audioch_t audioChNum = 0; audioChNum < channelCount; ++audioChNum) {
+            float singleChannelSquaredSum = 0.f;
+            gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * volume;
+
+            for (samples_t s = 0; s < samplesPerChannel; ++s) {
+                int idx = s * channelCount + audioChNum;
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
-        m_audioSignalNotifier.updateSignalValues(audioChNum, rms);
+                float resultSample = buffer[idx] * totalGain;
+                buffer[idx] = resultSample;
+
+                float squaredSample = resultSample * resultSample;
+                totalSquaredSum += squaredSample;
+                singleChannelSquaredSum += squaredSample;
+            }
+
+            float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
+            m_audioSignalNotifier.updateSignalValues(audioChNum, rms);
+        }
     }
 
     m_isSilence = RealIsNull(totalSquaredSum);
@@ -22,10 +22,12 @@
 #include "mixerchannel.h"
 
 #include <algorithm>
+#include <array>
 
 #include "audio/common/audiosanitizer.h"
 
 #include "dsp/audiomathutils.h"
+#include "dsp/mixkernels.h"
 
 #include "log.h"
 
@@ -223,24 +225,41 @@ void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount)
     float volume = muse::db_to_linear(m_params.volume);
     float totalSquaredSum = 0.f;
 
-    for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
-
-        gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * volume;
+    if (channelsCount <= dsp::MAX_MIX_CHANNELS) {
+        std::array<gain_t, dsp::MAX_MIX_CHANNELS> gains;
+        std::array<float, dsp::MAX_MIX_CHANNELS> squaredSums;
+        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+            gains[audioChNum] = dsp::balanceGain(m_params.balance, audioChNum) * volume;
+        }
 
-        for (unsigned int s = 0; s < samplesCount; ++s) {
-            int idx = s * channelsCount + audioChNum;
+        dsp::applyGainsAndMeasure(buffer, channelsCount, samplesCount, gains.data(), squaredSums.data());
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+            totalSquaredSum += squaredSums[audioChNum];
 
-            float squaredSample = resultSample * resultSample;
-            singleChannelSquaredSum += squaredSample;
-            totalSquaredSum += squaredSample;
+            float rms = dsp::samplesRootMeanSquare(squaredSums[audioChNum], samplesCount);
+            m_audioSignalNotifier.updateSignalValues(audioChNum, rms);
         }
+    } else {
+        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+            float singleChannelSquaredSum = 0.f;
+
+            gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * volume;
+
+            for (unsigned int s = 0; s < samplesCount; ++s) {
+                int idx = s * channelsCount + audioChNum;
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
-        m_audioSignalNotifier.updateSignalValues(audioChNum, rms);
+                float resultSample = buffer[idx] * totalGain;
+                buffer[idx] = resultSample;
+
+                float squaredSample = resultSample * resultSample;
+                singleChannelSquaredSum += squaredSample;
+                totalSquaredSum += squaredSample;
+            }
+
+            float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
+            m_audioSignalNotifier.updateSignalValues(audioChNum, rms);
+        }
     }
 
     m_isSilent = RealIsNull(totalSquaredSum);
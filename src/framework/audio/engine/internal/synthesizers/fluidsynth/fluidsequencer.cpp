@@ -92,6 +92,32 @@ void FluidSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& events
     updateMainSequenceIterator();
 }
 
+void FluidSequencer::updateMainStreamEventsInRange(const mpe::PlaybackEventsMap& events, const msecs_t from, const msecs_t to)
+{
+    if (hasSostenutoPedal()) {
+        updateMainStreamEvents(m_playbackData.originEvents, m_playbackData.dynamics);
+        return;
+    }
+
+    if (m_onMainStreamFlushed) {
+        m_onMainStreamFlushed();
+    }
+
+    Timeline timeline;
+    addPlaybackEvents(timeline, events);
+
+    if (m_useDynamicEvents) {
+        addDynamicEvents(timeline, m_playbackData.dynamics);
+    }
+
+    replaceMainStreamEvents(from, to, timeline);
+}
+
+const mpe::ArticulationTypeSet& FluidSequencer::sostenutoPedalTypes() const
+{
+    return SOSTENUTO_PEDAL_CC_SUPPORTED_TYPES;
+}
+
 muse::async::Channel<channel_t, Program> FluidSequencer::channelAdded() const
 {
     return m_channels.channelAdded;
@@ -107,7 +133,7 @@ int FluidSequencer::lastStaff() const
     return m_lastStaff;
 }
 
-void FluidSequencer::addPlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& events)
+void FluidSequencer::addPlaybackEvents(Timeline& destination, const mpe::PlaybackEventsMap& events)
 {
     SostenutoTimeAndDurations sostenutoTimeAndDurations;
 
@@ -124,7 +150,7 @@ void FluidSequencer::addPlaybackEvents(EventSequenceMap& destination, const mpe:
     addSostenutoEvents(destination, sostenutoTimeAndDurations);
 }
 
-void FluidSequencer::addDynamicEvents(EventSequenceMap& destination, const mpe::DynamicLevelLayers& dynamics)
+void FluidSequencer::addDynamicEvents(Timeline& destination, const mpe::DynamicLevelLayers& dynamics)
 {
     for (const auto& layer : dynamics) {
         for (const auto& dynamic : layer.second) {
@@ -132,12 +158,12 @@ void FluidSequencer::addDynamicEvents(EventSequenceMap& destination, const mpe::
             event.setIndex(midi::EXPRESSION_CONTROLLER);
             event.setData(expressionLevel(dynamic.second));
 
-            destination[dynamic.first].emplace(std::move(event));
+            destination.add(dynamic.first, std::move(event));
         }
     }
 }
 
-void FluidSequencer::addNoteEvent(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void FluidSequencer::addNoteEvent(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                   SostenutoTimeAndDurations& sostenutoTimeAndDurations)
 {
     const ArrangementContext& arrangementCtx = noteEvent.arrangementCtx();
@@ -157,7 +183,7 @@ void FluidSequencer::addNoteEvent(EventSequenceMap& destination, const mpe::Note
         noteOn.setVelocity16(velocity);
         noteOn.setPitchNote(noteIdx, tuning);
 
-        destination[arrangementCtx.actualTimestamp].emplace(std::move(noteOn));
+        destination.add(arrangementCtx.actualTimestamp, std::move(noteOn));
     }
 
     if (arrangementCtx.hasEnd()) {
@@ -167,7 +193,7 @@ void FluidSequencer::addNoteEvent(EventSequenceMap& destination, const mpe::Note
         noteOff.setPitchNote(noteIdx, tuning);
 
         const timestamp_t timestampTo = arrangementCtx.actualTimestamp + noteEvent.arrangementCtx().actualDuration;
-        destination[timestampTo].emplace(std::move(noteOff));
+        destination.add(timestampTo, std::move(noteOff));
     }
 
     for (const auto& artPair : noteEvent.expressionCtx().articulations) {
@@ -195,7 +221,7 @@ void FluidSequencer::addNoteEvent(EventSequenceMap& destination, const mpe::Note
     }
 }
 
-void FluidSequencer::addPedalEvent(EventSequenceMap& destination, const mpe::ArticulationMeta& meta,
+void FluidSequencer::addPedalEvent(Timeline& destination, const mpe::ArticulationMeta& meta,
                                    const channel_t channelIdx)
 {
     //! NOTE: Endless pedals are not currently supported by SND instrument
@@ -214,7 +240,7 @@ void FluidSequencer::addPedalEvent(EventSequenceMap& destination, const mpe::Art
     }
 }
 
-void FluidSequencer::addControlChangeEvent(EventSequenceMap& destination, const mpe::timestamp_t timestamp,
+void FluidSequencer::addControlChangeEvent(Timeline& destination, const mpe::timestamp_t timestamp,
                                            const mpe::ControllerChangeEvent& event)
 {
     const channel_t lastChannelIdx = m_channels.lastIndex();
@@ -239,7 +265,7 @@ void FluidSequencer::addControlChangeEvent(EventSequenceMap& destination, const
     }
 }
 
-void FluidSequencer::addControlChange(EventSequenceMap& destination, const mpe::timestamp_t timestamp,
+void FluidSequencer::addControlChange(Timeline& destination, const mpe::timestamp_t timestamp,
                                       const int midiControlIdx, const channel_t channelIdx, const uint32_t value)
 {
     midi::Event cc(Event::Opcode::ControlChange, Event::MessageType::ChannelVoice10);
@@ -247,10 +273,10 @@ void FluidSequencer::addControlChange(EventSequenceMap& destination, const mpe::
     cc.setChannel(channelIdx);
     cc.setData(value);
 
-    destination[timestamp].emplace(std::move(cc));
+    destination.add(timestamp, std::move(cc));
 }
 
-void FluidSequencer::addPitchCurve(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void FluidSequencer::addPitchCurve(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                    const mpe::ArticulationMeta& artMeta, const channel_t channelIdx)
 {
     if (noteEvent.pitchCtx().pitchCurve.empty()) {
@@ -299,16 +325,16 @@ void FluidSequencer::addPitchCurve(EventSequenceMap& destination, const mpe::Not
     }
 }
 
-void FluidSequencer::addPitchBend(EventSequenceMap& destination, const mpe::timestamp_t timestamp,
+void FluidSequencer::addPitchBend(Timeline& destination, const mpe::timestamp_t timestamp,
                                   const midi::channel_t channelIdx, const uint32_t value)
 {
     midi::Event event(Event::Opcode::PitchBend, Event::MessageType::ChannelVoice10);
     event.setChannel(channelIdx);
     event.setData(value);
-    destination[timestamp].insert(event);
+    destination.add(timestamp, event);
 }
 
-void FluidSequencer::addSostenutoEvents(EventSequenceMap& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations)
+void FluidSequencer::addSostenutoEvents(Timeline& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations)
 {
     for (const auto& channelPair : sostenutoTimeAndDurations) {
         for (size_t i = 0; i < channelPair.second.size(); ++i) {
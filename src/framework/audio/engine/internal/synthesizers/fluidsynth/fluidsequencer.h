@@ -47,21 +47,23 @@ public:
 private:
     void updateOffStreamEvents(const mpe::PlaybackEventsMap& events, const mpe::DynamicLevelLayers& dynamics) override;
     void updateMainStreamEvents(const mpe::PlaybackEventsMap& events, const mpe::DynamicLevelLayers& dynamics) override;
+    void updateMainStreamEventsInRange(const mpe::PlaybackEventsMap& events, const msecs_t from, const msecs_t to) override;
+    const mpe::ArticulationTypeSet& sostenutoPedalTypes() const override;
 
     using SostenutoTimeAndDurations = std::map<midi::channel_t, std::vector<mpe::TimestampAndDuration> >;
 
-    void addPlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& events);
-    void addDynamicEvents(EventSequenceMap& destination, const mpe::DynamicLevelLayers& dynamics);
-    void addNoteEvent(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, SostenutoTimeAndDurations& sostenutoTimeAndDurations);
-    void addPedalEvent(EventSequenceMap& destination, const mpe::ArticulationMeta& meta, const midi::channel_t channelIdx);
-    void addControlChangeEvent(EventSequenceMap& destination, const mpe::timestamp_t timestamp, const mpe::ControllerChangeEvent& event);
-    void addControlChange(EventSequenceMap& destination, const mpe::timestamp_t timestamp, const int midiControlIdx,
+    void addPlaybackEvents(Timeline& destination, const mpe::PlaybackEventsMap& events);
+    void addDynamicEvents(Timeline& destination, const mpe::DynamicLevelLayers& dynamics);
+    void addNoteEvent(Timeline& destination, const mpe::NoteEvent& noteEvent, SostenutoTimeAndDurations& sostenutoTimeAndDurations);
+    void addPedalEvent(Timeline& destination, const mpe::ArticulationMeta& meta, const midi::channel_t channelIdx);
+    void addControlChangeEvent(Timeline& destination, const mpe::timestamp_t timestamp, const mpe::ControllerChangeEvent& event);
+    void addControlChange(Timeline& destination, const mpe::timestamp_t timestamp, const int midiControlIdx,
                           const midi::channel_t channelIdx, const uint32_t value);
-    void addPitchCurve(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationMeta& artMeta,
+    void addPitchCurve(Timeline& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationMeta& artMeta,
                        const midi::channel_t channelIdx);
-    void addPitchBend(EventSequenceMap& destination, const mpe::timestamp_t timestamp, const midi::channel_t channelIdx,
+    void addPitchBend(Timeline& destination, const mpe::timestamp_t timestamp, const midi::channel_t channelIdx,
                       const uint32_t value);
-    void addSostenutoEvents(EventSequenceMap& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations);
+    void addSostenutoEvents(Timeline& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations);
 
     midi::channel_t channel(const mpe::NoteEvent& noteEvent) const;
     midi::note_idx_t noteIndex(const mpe::pitch_level_t pitchLevel) const;
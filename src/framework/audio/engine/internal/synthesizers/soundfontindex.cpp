@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "soundfontindex.h"
+
+#include "audio/common/rpc/rpcpacker.h"
+
+using namespace muse;
+using namespace muse::audio::synth;
+
+const SoundFontMeta* SoundFontIndex::find(const SoundFontPath& path, const FileStamp& stamp) const
+{
+    auto it = m_entries.find(path);
+    if (it == m_entries.cend() || !(it->second.stamp == stamp)) {
+        return nullptr;
+    }
+
+    return &it->second.meta;
+}
+
+void SoundFontIndex::insert(const SoundFontPath& path, const FileStamp& stamp, const SoundFontMeta& meta)
+{
+    m_entries.insert_or_assign(path, Entry { stamp, meta });
+}
+
+size_t SoundFontIndex::prune(const std::set<SoundFontPath>& paths)
+{
+    size_t removed = 0;
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (paths.find(it->first) == paths.cend()) {
+            it = m_entries.erase(it);
+            ++removed;
+        } else {
+            ++it;
+        }
+    }
+
+    return removed;
+}
+
+size_t SoundFontIndex::size() const
+{
+    return m_entries.size();
+}
+
+ByteArray SoundFontIndex::toData() const
+{
+    std::vector<SoundFontPath> paths;
+    std::vector<uint64_t> sizes;
+    std::vector<std::string> modified;
+    std::vector<SoundFontMeta> metas;
+
+    for (const auto& pair : m_entries) {
+        paths.push_back(pair.first);
+        sizes.push_back(pair.second.stamp.size);
+        modified.push_back(pair.second.stamp.lastModified);
+        metas.push_back(pair.second.meta);
+    }
+
+    return rpc::RpcPacker::pack(VERSION, paths, sizes, modified, metas);
+}
+
+SoundFontIndex SoundFontIndex::fromData(const ByteArray& data)
+{
+    SoundFontIndex index;
+    if (data.empty()) {
+        return index;
+    }
+
+    int version = 0;
+    std::vector<SoundFontPath> paths;
+    std::vector<uint64_t> sizes;
+    std::vector<std::string> modified;
+    std::vector<SoundFontMeta> metas;
+
+    if (!rpc::RpcPacker::unpack(data, version, paths, sizes, modified, metas) || version != VERSION) {
+        return index;
+    }
+
+    if (sizes.size() != paths.size() || modified.size() != paths.size() || metas.size() != paths.size()) {
+        return index;
+    }
+
+    for (size_t i = 0; i < paths.size(); ++i) {
+        index.insert(paths.at(i), FileStamp { sizes.at(i), modified.at(i) }, metas.at(i));
+    }
+
+    return index;
+}
@@ -0,0 +1,72 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_AUDIO_SOUNDFONTINDEX_H
+#define MUSE_AUDIO_SOUNDFONTINDEX_H
+
+#include <map>
+#include <set>
+
+#include "global/types/bytearray.h"
+
+#include "audio/common/soundfonttypes.h"
+
+namespace muse::audio::synth {
+//! NOTE Keeps the presets of the parsed sound fonts between the launches,
+//! so that a big sound font is not parsed again until the file changes
+class SoundFontIndex
+{
+public:
+    struct FileStamp {
+        uint64_t size = 0;
+        std::string lastModified;
+
+        bool operator==(const FileStamp& other) const
+        {
+            return size == other.size && lastModified == other.lastModified;
+        }
+    };
+
+    const SoundFontMeta* find(const SoundFontPath& path, const FileStamp& stamp) const;
+    void insert(const SoundFontPath& path, const FileStamp& stamp, const SoundFontMeta& meta);
+
+    //! NOTE Removes the entries of the sound fonts that are not in the given paths, returns the number of removed entries
+    size_t prune(const std::set<SoundFontPath>& paths);
+
+    size_t size() const;
+
+    ByteArray toData() const;
+    static SoundFontIndex fromData(const ByteArray& data);
+
+private:
+    //! NOTE Increase if the stored data or the parsing of the sound fonts changes
+    static constexpr int VERSION = 1;
+
+    struct Entry {
+        FileStamp stamp;
+        SoundFontMeta meta;
+    };
+
+    std::map<SoundFontPath, Entry> m_entries;
+};
+}
+
+#endif // MUSE_AUDIO_SOUNDFONTINDEX_H
@@ -36,6 +36,18 @@ using namespace muse::audio;
 using namespace muse::audio::synth;
 using namespace muse::async;
 
+void SoundFontRepository::init()
+{
+#ifndef Q_OS_WASM
+    //! NOTE The IOC isn't thread safe, so the services are resolved here, on the main thread
+    m_fileSystem = fileSystem();
+
+    if (globalConfiguration()) {
+        m_indexPath = globalConfiguration()->userAppDataPath() + "/soundfonts_index.dat";
+    }
+#endif
+}
+
 bool SoundFontRepository::isSoundFontLoaded(const std::string& name) const
 {
     ONLY_AUDIO_ENGINE_THREAD;
@@ -63,6 +75,7 @@ void SoundFontRepository::addSoundFont(const SoundFontUri& uri)
 {
     ONLY_AUDIO_ENGINE_THREAD;
     doAddSoundFont(uri, nullptr, [this]() {
+        saveIndex();
         m_soundFontsChanged.notify();
     });
 }
@@ -119,7 +132,7 @@ void SoundFontRepository::doAddSoundFont(const SoundFontUri& uri, const SoundFon
     }
 
     auto parseAndAdd = [this, onFinished](const SoundFontUri& uri, const SoundFontPath& path) {
-        RetVal<SoundFontMeta> meta = FluidSoundFontParser::parseSoundFont(path);
+        RetVal<SoundFontMeta> meta = parseSoundFont(path);
 
         if (meta.ret) {
             m_soundFonts.insert_or_assign(uri, std::move(meta.val));
@@ -175,14 +188,103 @@ void SoundFontRepository::loadSoundFonts(const std::vector<SoundFontUri>& uris)
     size_t count = 0;
     for (const SoundFontUri& uri : uris) {
         LOGI() << "try add sound font: " << uri.toString();
-        doAddSoundFont(uri, cache, [this, &count, total, cache]() {
+        doAddSoundFont(uri, cache, [this, &uris, &count, total, cache]() {
             ++count;
             LOGI() << "added: " << count << ", total: " << total;
             if (count == total) {
                 delete cache;
+                updateIndex(uris);
                 m_soundFontsChanged.notify();
                 LOGI() << "all added notify about sound fonts changed";
             }
         });
     }
 }
+
+RetVal<SoundFontMeta> SoundFontRepository::parseSoundFont(const SoundFontPath& path)
+{
+#ifdef Q_OS_WASM
+    return FluidSoundFontParser::parseSoundFont(path);
+#else
+    if (!m_fileSystem) {
+        return FluidSoundFontParser::parseSoundFont(path);
+    }
+
+    loadIndex();
+
+    SoundFontIndex::FileStamp stamp;
+    stamp.size = m_fileSystem->fileSize(path).val;
+    stamp.lastModified = m_fileSystem->lastModified(path).toString().toStdString();
+
+    if (const SoundFontMeta* meta = m_index.find(path, stamp)) {
+        return RetVal<SoundFontMeta>::make_ok(*meta);
+    }
+
+    RetVal<SoundFontMeta> meta = FluidSoundFontParser::parseSoundFont(path);
+    if (meta.ret) {
+        m_index.insert(path, stamp, meta.val);
+        m_indexChanged = true;
+    }
+
+    return meta;
+#endif
+}
+
+void SoundFontRepository::loadIndex()
+{
+    if (m_indexLoaded) {
+        return;
+    }
+
+    m_indexLoaded = true;
+
+    if (m_indexPath.empty() || !m_fileSystem->exists(m_indexPath)) {
+        return;
+    }
+
+    RetVal<ByteArray> data = m_fileSystem->readFile(m_indexPath);
+    if (!data.ret) {
+        LOGW() << "failed read sound font index: " << data.ret.toString();
+        return;
+    }
+
+    m_index = SoundFontIndex::fromData(data.val);
+    LOGI() << "loaded sound font index, entries: " << m_index.size();
+}
+
+void SoundFontRepository::saveIndex()
+{
+    if (!m_indexChanged || m_indexPath.empty()) {
+        return;
+    }
+
+    m_indexChanged = false;
+
+    Ret ret = m_fileSystem->writeFile(m_indexPath, m_index.toData());
+    if (!ret) {
+        LOGW() << "failed write sound font index: " << ret.toString();
+    }
+}
+
+void SoundFontRepository::updateIndex(const std::vector<SoundFontUri>& uris)
+{
+    if (!m_fileSystem) {
+        return;
+    }
+
+    //! NOTE The loaded sound fonts are all installed ones, so the entries of the others are removed
+    loadIndex();
+
+    std::set<SoundFontPath> paths;
+    for (const SoundFontUri& uri : uris) {
+        if (uri.scheme() == "file") {
+            paths.insert(uri.toLocalFile());
+        }
+    }
+
+    if (m_index.prune(paths) > 0) {
+        m_indexChanged = true;
+    }
+
+    saveIndex();
+}
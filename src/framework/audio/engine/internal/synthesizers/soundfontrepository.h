@@ -22,14 +22,25 @@
 #ifndef MUSE_AUDIO_SOUNDFONTREPOSITORY_H
 #define MUSE_AUDIO_SOUNDFONTREPOSITORY_H
 
+#include "global/modularity/ioc.h"
+#include "global/iglobalconfiguration.h"
+#include "global/io/ifilesystem.h"
+
 #include "../../isoundfontrepository.h"
+#include "soundfontindex.h"
 
 namespace muse::audio::synth {
-class SoundFontRepository : public ISoundFontRepository
+class SoundFontRepository : public ISoundFontRepository, public Injectable
 {
+    Inject<IGlobalConfiguration> globalConfiguration = { this };
+    Inject<io::IFileSystem> fileSystem = { this };
+
 public:
     SoundFontRepository() = default;
 
+    //! NOTE Must be called on the main thread, before the engine thread uses the repository
+    void init();
+
     void loadSoundFonts(const std::vector<SoundFontUri>& uris) override;
     void addSoundFont(const SoundFontUri& uri) override;
     void addSoundFontData(const SoundFontUri& uri, const ByteArray& data) override;
@@ -41,8 +52,18 @@ public:
 private:
 
     void doAddSoundFont(const SoundFontUri& uri, const SoundFontsMap* cache = nullptr, std::function<void()> onFinished = nullptr);
+    RetVal<SoundFontMeta> parseSoundFont(const SoundFontPath& path);
+
+    void loadIndex();
+    void saveIndex();
+    void updateIndex(const std::vector<SoundFontUri>& uris);
 
     SoundFontsMap m_soundFonts;
+    std::shared_ptr<io::IFileSystem> m_fileSystem;
+    io::path_t m_indexPath;
+    SoundFontIndex m_index;
+    bool m_indexLoaded = false;
+    bool m_indexChanged = false;
     async::Notification m_soundFontsChanged;
 };
 }
@@ -300,11 +300,15 @@ async::Promise<TrackId, AudioParams> Playback::addTrack(const TrackSequenceId se
         ONLY_AUDIO_MAIN_THREAD;
 
         rpc::StreamId mainStreamId = channel()->addSendStream(StreamName::PlaybackDataMainStream, playbackData.mainStream);
+        rpc::StreamId mainDeltaStreamId = channel()->addSendStream(StreamName::PlaybackDataMainStreamDelta, playbackData.mainStreamDelta);
         rpc::StreamId offStreamId = channel()->addSendStream(StreamName::PlaybackDataOffStream, playbackData.offStream);
 
-        ByteArray data = RpcPacker::pack(sequenceId, trackName, playbackData, params, mainStreamId, offStreamId);
+        //! NOTE The streams are connected on the engine side by their ids, so the channels are not handed over
+        mpe::PlaybackData data { playbackData.originEvents, playbackData.setupData, playbackData.dynamics, {}, {}, {} };
 
-        Msg msg = rpc::make_request(Method::AddTrackWithPlaybackData, data);
+        Msg msg = rpc::make_request(Method::AddTrackWithPlaybackData);
+        rpc::set_payload(channel().get(), msg, sequenceId, trackName, std::move(data), params,
+                         mainStreamId, mainDeltaStreamId, offStreamId);
         channel()->send(msg, [resolve, reject](const Msg& res) {
             ONLY_AUDIO_MAIN_THREAD;
             RetVal2<TrackId, AudioParams> ret;
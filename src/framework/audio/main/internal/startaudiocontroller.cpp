@@ -21,6 +21,8 @@
  */
 #include "startaudiocontroller.h"
 
+#include <chrono>
+
 #include "global/realfn.h"
 #include "global/runtime.h"
 #include "global/async/processevents.h"
@@ -89,6 +91,10 @@ void StartAudioController::th_setupEngine()
 
 void StartAudioController::init()
 {
+#ifndef Q_OS_WASM
+    m_engineController->onInit();
+#endif
+
     m_rpcChannel->onMethod(rpc::Method::EngineRunning, [this](const rpc::Msg&) {
         soundFontController()->loadSoundFonts();
 
@@ -161,6 +167,51 @@ async::Channel<bool> StartAudioController::isAudioStartedChanged() const
     return m_isAudioStarted.ch;
 }
 
+AudioCallbackStats StartAudioController::callbackStats() const
+{
+    AudioCallbackStats stats;
+    if (m_callbackStatsResetRequested.load(std::memory_order_acquire)) {
+        return stats;
+    }
+
+    stats.callbackCount = m_callbackCount.load(std::memory_order_relaxed);
+    stats.underrunCount = m_underrunCount.load(std::memory_order_relaxed);
+    stats.missingSamples = m_missingSamples.load(std::memory_order_relaxed);
+    stats.maxCallbackDuration = m_maxCallbackDuration.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+void StartAudioController::resetCallbackStats()
+{
+    //! NOTE The counters are cleared by the driver thread on its next callback,
+    //! so they never have two writers
+    m_callbackStatsResetRequested.store(true, std::memory_order_release);
+}
+
+void StartAudioController::updateCallbackStats(msecs_t duration, samples_t requestedSamples, samples_t receivedSamples)
+{
+    //! NOTE Called from the driver callback, so only atomics, no locks
+    if (m_callbackStatsResetRequested.load(std::memory_order_acquire)) {
+        m_callbackCount.store(0, std::memory_order_relaxed);
+        m_underrunCount.store(0, std::memory_order_relaxed);
+        m_missingSamples.store(0, std::memory_order_relaxed);
+        m_maxCallbackDuration.store(0, std::memory_order_relaxed);
+        m_callbackStatsResetRequested.store(false, std::memory_order_release);
+    }
+
+    m_callbackCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (receivedSamples < requestedSamples) {
+        m_underrunCount.fetch_add(1, std::memory_order_relaxed);
+        m_missingSamples.fetch_add(requestedSamples - receivedSamples, std::memory_order_relaxed);
+    }
+
+    if (duration > m_maxCallbackDuration.load(std::memory_order_relaxed)) {
+        m_maxCallbackDuration.store(duration, std::memory_order_relaxed);
+    }
+}
+
 void StartAudioController::startAudioProcessing(const IApplication::RunMode& mode)
 {
     IAudioDriver::Spec requiredSpec;
@@ -174,12 +225,15 @@ void StartAudioController::startAudioProcessing(const IApplication::RunMode& mod
 
     bool shouldMeasureInputLag = configuration()->shouldMeasureInputLag();
     requiredSpec.callback = [this, shouldMeasureInputLag](void* /*userdata*/, uint8_t* stream, int byteCount) {
+        const auto callbackStart = std::chrono::steady_clock::now();
+
         std::memset(stream, 0, byteCount);
         auto samplesPerChannel = byteCount / (2 * sizeof(float));
         float* dest = reinterpret_cast<float*>(stream);
+        samples_t receivedSamples = samplesPerChannel;
 
 #if MUSE_MODULE_AUDIO_WORKMODE == MUSE_MODULE_AUDIO_WORKER_MODE
-        m_engineController->popAudioData(dest, samplesPerChannel);
+        receivedSamples = m_engineController->popAudioData(dest, samplesPerChannel);
 #endif
 
 #if MUSE_MODULE_AUDIO_WORKMODE == MUSE_MODULE_AUDIO_WORKERRPC_MODE
@@ -200,6 +254,10 @@ void StartAudioController::startAudioProcessing(const IApplication::RunMode& mod
         if (shouldMeasureInputLag) {
             measureInputLag(dest, samplesPerChannel * 2);
         }
+
+        const msecs_t duration = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - callbackStart).count();
+        updateCallbackStats(duration, samplesPerChannel, receivedSamples);
     };
 
 #endif // Q_OS_WASM
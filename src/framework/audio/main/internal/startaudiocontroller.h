@@ -21,6 +21,8 @@
  */
 #pragma once
 
+#include <atomic>
+
 #include "../istartaudiocontroller.h"
 
 #include "global/types/retval.h"
@@ -56,9 +58,14 @@ public:
     void startAudioProcessing(const IApplication::RunMode& mode) override;
     void stopAudioProcessing() override;
 
+    AudioCallbackStats callbackStats() const override;
+    void resetCallbackStats() override;
+
 private:
     IAudioDriverPtr audioDriver() const;
 
+    void updateCallbackStats(msecs_t duration, samples_t requestedSamples, samples_t receivedSamples);
+
     void th_setupEngine();
 
     std::shared_ptr<rpc::IRpcChannel> m_rpcChannel;
@@ -67,5 +74,12 @@ private:
 
     ValCh<bool> m_isEngineRunning;
     ValCh<bool> m_isAudioStarted;
+
+    // written by the driver thread only, a reset is requested from other threads with the flag
+    std::atomic<bool> m_callbackStatsResetRequested = false;
+    std::atomic<uint64_t> m_callbackCount = 0;
+    std::atomic<uint64_t> m_underrunCount = 0;
+    std::atomic<samples_t> m_missingSamples = 0;
+    std::atomic<msecs_t> m_maxCallbackDuration = 0;
 };
 }
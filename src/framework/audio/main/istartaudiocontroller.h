@@ -27,6 +27,8 @@
 
 #include "global/iapplication.h"
 
+#include "audio/common/audiotypes.h"
+
 namespace muse::audio {
 class IStartAudioController : MODULE_EXPORT_INTERFACE
 {
@@ -39,5 +41,8 @@ public:
 
     virtual bool isAudioStarted() const = 0;
     virtual async::Channel<bool> isAudioStartedChanged() const = 0;
+
+    virtual AudioCallbackStats callbackStats() const = 0;
+    virtual void resetCallbackStats() = 0;
 };
 }
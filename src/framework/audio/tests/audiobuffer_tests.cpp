@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "audio/engine/internal/audiobuffer.h"
+
+using namespace muse;
+using namespace muse::audio;
+using namespace muse::audio::engine;
+
+//! NOTE Renders consecutive numbers, so every sample shows where it came from
+class RampSource : public IAudioSource
+{
+public:
+    bool isActive() const override { return true; }
+    void setIsActive(bool) override {}
+    void setOutputSpec(const OutputSpec&) override {}
+    unsigned int audioChannelsCount() const override { return 2; }
+    async::Channel<unsigned int> audioChannelsCountChanged() const override { return m_channelsCountChanged; }
+
+    samples_t process(float* buffer, samples_t samplesPerChannel) override
+    {
+        for (samples_t i = 0; i < samplesPerChannel * 2; ++i) {
+            buffer[i] = static_cast<float>(m_next++);
+        }
+
+        return samplesPerChannel;
+    }
+
+private:
+    size_t m_next = 1;
+    async::Channel<unsigned int> m_channelsCountChanged;
+};
+
+class Audio_AudioBufferTests : public ::testing::Test
+{
+protected:
+    static constexpr samples_t RESERVE = 256; // samples per channel
+    static constexpr samples_t RENDER_STEP = 128;
+
+    void SetUp() override
+    {
+        m_buffer.init(2);
+        m_buffer.setMinSamplesPerChannelToReserve(RESERVE);
+        m_buffer.setRenderStep(RENDER_STEP);
+    }
+
+    AudioBuffer m_buffer;
+};
+
+TEST_F(Audio_AudioBufferTests, PopEmpty)
+{
+    // [GIVEN] Buffer without anything rendered
+    std::vector<float> dest(200, 1.f);
+
+    // [WHEN] Pop samples
+    samples_t popped = m_buffer.pop(dest.data(), 100);
+
+    // [THEN] Nothing is popped, the output is silence
+    EXPECT_EQ(popped, 0);
+    EXPECT_EQ(dest, std::vector<float>(200, 0.f));
+}
+
+TEST_F(Audio_AudioBufferTests, PopNoMoreThanAvailable)
+{
+    // [GIVEN] Buffer with RESERVE samples per channel rendered
+    m_buffer.setSource(std::make_shared<RampSource>());
+    m_buffer.forward();
+
+    // [WHEN] Pop less than available
+    std::vector<float> dest(200, -1.f);
+    samples_t popped = m_buffer.pop(dest.data(), 100);
+
+    // [THEN] The samples come in order
+    EXPECT_EQ(popped, 100);
+    for (size_t i = 0; i < dest.size(); ++i) {
+        ASSERT_EQ(dest.at(i), static_cast<float>(i + 1));
+    }
+
+    // [WHEN] Pop more than left
+    dest.assign(400, -1.f);
+    popped = m_buffer.pop(dest.data(), 200);
+
+    // [THEN] Only the rest is popped, the reader doesn't overtake the writer, and the remainder is silence
+    EXPECT_EQ(popped, RESERVE - 100);
+    for (size_t i = 0; i < dest.size(); ++i) {
+        const float expected = i < (RESERVE - 100) * 2 ? static_cast<float>(200 + i + 1) : 0.f;
+        ASSERT_EQ(dest.at(i), expected);
+    }
+
+    // [WHEN] Pop from the drained buffer
+    dest.assign(400, -1.f);
+    popped = m_buffer.pop(dest.data(), 200);
+
+    // [THEN] Nothing is popped
+    EXPECT_EQ(popped, 0);
+    EXPECT_EQ(dest, std::vector<float>(400, 0.f));
+}
+
+TEST_F(Audio_AudioBufferTests, PopAcrossBufferEnd)
+{
+    // [GIVEN] Buffer with a source
+    m_buffer.setSource(std::make_shared<RampSource>());
+
+    // [WHEN] Render and pop until the indices wrap around the end of the buffer several times
+    constexpr samples_t POP_SIZE = 100;
+    std::vector<float> dest(POP_SIZE * 2);
+    size_t expectedNext = 1;
+
+    for (int i = 0; i < 1000; ++i) {
+        m_buffer.forward();
+
+        samples_t popped = m_buffer.pop(dest.data(), POP_SIZE);
+
+        // [THEN] Every pop gets all samples, in order, without gaps or repeats
+        ASSERT_EQ(popped, POP_SIZE);
+        for (float sample : dest) {
+            ASSERT_EQ(sample, static_cast<float>(expectedNext++));
+        }
+    }
+}
+
+TEST_F(Audio_AudioBufferTests, Reset)
+{
+    // [GIVEN] Buffer with rendered samples
+    m_buffer.setSource(std::make_shared<RampSource>());
+    m_buffer.forward();
+
+    // [WHEN] Reset the buffer
+    m_buffer.reset();
+
+    // [THEN] Nothing is left to pop
+    std::vector<float> dest(200, -1.f);
+    EXPECT_EQ(m_buffer.pop(dest.data(), 100), 0);
+    EXPECT_EQ(dest, std::vector<float>(200, 0.f));
+}
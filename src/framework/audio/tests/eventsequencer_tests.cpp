@@ -0,0 +1,176 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "audio/engine/internal/abstracteventsequencer.h"
+
+using namespace muse;
+using namespace muse::audio;
+using namespace muse::audio::engine;
+using namespace muse::mpe;
+
+namespace muse::audio::engine {
+//! NOTE Produces a note on (pitch) and a note off (-pitch) for every note event
+class TestSequencer : public AbstractEventSequencer<int>
+{
+public:
+    using Entries = std::vector<std::pair<msecs_t, int> >;
+
+    Entries mainStreamEvents() const
+    {
+        Entries result;
+        for (const auto& entry : m_mainStreamEvents) {
+            result.emplace_back(entry.first, std::get<int>(entry.second));
+        }
+        return result;
+    }
+
+    int fullUpdates = 0;
+    int rangeUpdates = 0;
+
+protected:
+    void updateOffStreamEvents(const PlaybackEventsMap&, const DynamicLevelLayers&) override
+    {
+    }
+
+    void updateMainStreamEvents(const PlaybackEventsMap& events, const DynamicLevelLayers&) override
+    {
+        ++fullUpdates;
+
+        m_mainStreamEvents.clear();
+        fillEvents(events, m_mainStreamEvents);
+        updateMainSequenceIterator();
+    }
+
+    void updateMainStreamEventsInRange(const PlaybackEventsMap& events, const msecs_t from, const msecs_t to) override
+    {
+        ++rangeUpdates;
+
+        Timeline timeline;
+        fillEvents(events, timeline);
+        replaceMainStreamEvents(from, to, timeline);
+    }
+
+private:
+    static void fillEvents(const PlaybackEventsMap& events, Timeline& destination)
+    {
+        for (const auto& pair : events) {
+            for (const PlaybackEvent& event : pair.second) {
+                const NoteEvent& noteEvent = std::get<NoteEvent>(event);
+                const ArrangementContext& arrangementCtx = noteEvent.arrangementCtx();
+                const int pitch = noteEvent.pitchCtx().nominalPitchLevel;
+
+                destination.add(arrangementCtx.actualTimestamp, pitch);
+                destination.add(arrangementCtx.actualTimestamp + arrangementCtx.actualDuration, -pitch);
+            }
+        }
+    }
+};
+}
+
+class Audio_EventSequencerTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        AudioSanitizer::setupEngineThread();
+    }
+
+    static PlaybackEventList note(timestamp_t timestamp, duration_t duration, pitch_level_t pitch)
+    {
+        return { NoteEvent(timestamp, duration, 0, 0, pitch, dynamicLevelFromType(DynamicType::Natural), ArticulationMap(), 1.0) };
+    }
+};
+
+TEST_F(Audio_EventSequencerTests, MainStreamDelta)
+{
+    //! GIVEN Loaded and active sequencer
+    mpe::PlaybackData data;
+    data.originEvents.emplace(0, note(0, 500, 60));
+    data.originEvents.emplace(500, note(500, 500, 62));
+    data.originEvents.emplace(1000, note(1000, 1500, 64));
+    data.originEvents.emplace(2000, note(2000, 500, 65));
+    data.originEvents.emplace(3000, note(3000, 500, 67));
+
+    TestSequencer sequencer;
+    sequencer.load(data);
+    sequencer.setActive(true);
+
+    EXPECT_EQ(sequencer.fullUpdates, 1);
+
+    //! DO Change, remove and add a timestamp
+    PlaybackEventsMap changes;
+    changes.emplace(500, note(500, 250, 63));
+    changes.emplace(2000, PlaybackEventList());
+    changes.emplace(2500, note(2500, 250, 69));
+
+    data.mainStreamDelta.send(changes, data.dynamics);
+
+    //! CHECK Only the range was updated
+    EXPECT_EQ(sequencer.fullUpdates, 1);
+    EXPECT_EQ(sequencer.rangeUpdates, 1);
+
+    //! CHECK The result is the same as of the full update
+    mpe::PlaybackData expectedData;
+    expectedData.originEvents.emplace(0, note(0, 500, 60));
+    expectedData.originEvents.emplace(500, note(500, 250, 63));
+    expectedData.originEvents.emplace(1000, note(1000, 1500, 64));
+    expectedData.originEvents.emplace(2500, note(2500, 250, 69));
+    expectedData.originEvents.emplace(3000, note(3000, 500, 67));
+
+    TestSequencer expected;
+    expected.load(expectedData);
+
+    EXPECT_EQ(sequencer.mainStreamEvents(), expected.mainStreamEvents());
+    EXPECT_EQ(sequencer.playbackData().originEvents, expectedData.originEvents);
+}
+
+TEST_F(Audio_EventSequencerTests, MainStreamDelta_Inactive)
+{
+    //! GIVEN Loaded, but inactive sequencer
+    mpe::PlaybackData data;
+    data.originEvents.emplace(0, note(0, 500, 60));
+    data.originEvents.emplace(500, note(500, 500, 62));
+
+    TestSequencer sequencer;
+    sequencer.load(data);
+
+    //! DO
+    PlaybackEventsMap changes;
+    changes.emplace(500, note(500, 500, 64));
+
+    data.mainStreamDelta.send(changes, data.dynamics);
+
+    //! CHECK Nothing is updated until activation
+    EXPECT_EQ(sequencer.fullUpdates, 1);
+    EXPECT_EQ(sequencer.rangeUpdates, 0);
+
+    sequencer.setActive(true);
+
+    EXPECT_EQ(sequencer.fullUpdates, 2);
+    EXPECT_EQ(sequencer.rangeUpdates, 0);
+
+    TestSequencer::Entries expected = { { 0, 60 }, { 500, -60 }, { 500, 64 }, { 1000, -64 } };
+    EXPECT_EQ(sequencer.mainStreamEvents(), expected);
+}
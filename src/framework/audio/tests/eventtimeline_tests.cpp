@@ -0,0 +1,210 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <set>
+#include <variant>
+
+#include "audio/engine/internal/eventtimeline.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::audio;
+using namespace muse::audio::engine;
+
+class Audio_EventTimelineTests : public ::testing::Test
+{
+public:
+    using EventType = std::variant<int, float>;
+    using Timeline = EventTimeline<EventType>;
+    using EventSequenceMap = std::map<msecs_t, std::set<EventType> >;
+
+    static std::vector<std::pair<msecs_t, EventType> > randomEvents(size_t count, unsigned seed)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<msecs_t> time(0, 600000000);
+        std::uniform_int_distribution<int> value(0, 127);
+
+        std::vector<std::pair<msecs_t, EventType> > events;
+        events.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            msecs_t t = time(gen);
+            events.emplace_back(t, value(gen));
+            events.emplace_back(t + 500000, static_cast<float>(value(gen)));
+        }
+
+        return events;
+    }
+
+    static EventSequenceMap toSequenceMap(const Timeline& timeline)
+    {
+        EventSequenceMap result;
+        for (const auto& entry : timeline) {
+            result[entry.first].insert(entry.second);
+        }
+        return result;
+    }
+};
+
+TEST_F(Audio_EventTimelineTests, Build)
+{
+    //! GIVEN Events in random order, some of them duplicated
+    auto events = randomEvents(1000, 1);
+    events.push_back(events.front());
+    events.push_back(events.back());
+
+    //! DO
+    Timeline timeline;
+    EventSequenceMap expected;
+    for (const auto& event : events) {
+        timeline.add(event.first, event.second);
+        expected[event.first].insert(event.second);
+    }
+    timeline.build();
+
+    //! CHECK Same order and the same deduplication as the map of sets
+    EXPECT_EQ(toSequenceMap(timeline), expected);
+
+    size_t expectedSize = 0;
+    for (const auto& pair : expected) {
+        expectedSize += pair.second.size();
+    }
+    EXPECT_EQ(timeline.size(), expectedSize);
+    EXPECT_TRUE(std::is_sorted(timeline.begin(), timeline.end()));
+}
+
+TEST_F(Audio_EventTimelineTests, LowerBound)
+{
+    Timeline timeline;
+    timeline.add(30, 3);
+    timeline.add(10, 1);
+    timeline.add(20, 2);
+    timeline.add(20, 4);
+    timeline.build();
+
+    EXPECT_EQ(timeline.lowerBoundIndex(0), 0);
+    EXPECT_EQ(timeline.lowerBoundIndex(10), 0);
+    EXPECT_EQ(timeline.lowerBoundIndex(11), 1);
+    EXPECT_EQ(timeline.lowerBoundIndex(20), 1);
+    EXPECT_EQ(timeline.lowerBoundIndex(30), 3);
+    EXPECT_EQ(timeline.lowerBoundIndex(31), 4);
+}
+
+TEST_F(Audio_EventTimelineTests, ReplaceRange)
+{
+    Timeline timeline;
+    for (msecs_t t = 0; t < 100; t += 10) {
+        timeline.add(t, static_cast<int>(t));
+    }
+    timeline.build();
+
+    //! DO Replace [20, 50) with other events
+    timeline.replaceRange(20, 50, { { 25, 1 }, { 45, 2 }, { 25, 1 } });
+
+    //! CHECK
+    std::vector<msecs_t> times;
+    for (const auto& entry : timeline) {
+        times.push_back(entry.first);
+    }
+    EXPECT_EQ(times, std::vector<msecs_t>({ 0, 10, 25, 45, 50, 60, 70, 80, 90 }));
+
+    //! DO Events outside of the range are sorted in too
+    timeline.replaceRange(0, 10, { { 95, 3 } });
+
+    times.clear();
+    for (const auto& entry : timeline) {
+        times.push_back(entry.first);
+    }
+    EXPECT_EQ(times, std::vector<msecs_t>({ 10, 25, 45, 50, 60, 70, 80, 90, 95 }));
+}
+
+TEST_F(Audio_EventTimelineTests, EraseFront)
+{
+    Timeline timeline;
+    timeline.add(10, 1);
+    timeline.add(20, 2);
+    timeline.add(30, 3);
+    timeline.build();
+
+    timeline.eraseFront(2);
+    ASSERT_EQ(timeline.size(), 1);
+    EXPECT_EQ(timeline.at(0).first, 30);
+
+    timeline.eraseFront(5);
+    EXPECT_TRUE(timeline.empty());
+}
+
+//! Disabled unless MUSE_AUDIO_BENCHMARK is set, e.g.
+//!   MUSE_AUDIO_BENCHMARK=1 ./muse_audio_tests --gtest_filter=Audio_EventTimelineTests.Benchmark
+TEST_F(Audio_EventTimelineTests, Benchmark)
+{
+    if (!std::getenv("MUSE_AUDIO_BENCHMARK")) {
+        GTEST_SKIP() << "MUSE_AUDIO_BENCHMARK is not set";
+    }
+
+    //! NOTE Reloading the events of a score of 100 tracks, 5000 notes each
+    constexpr size_t trackCount = 100;
+    constexpr size_t notesPerTrack = 5000;
+
+    std::vector<std::vector<std::pair<msecs_t, EventType> > > tracks;
+    for (size_t i = 0; i < trackCount; ++i) {
+        tracks.push_back(randomEvents(notesPerTrack, static_cast<unsigned>(i)));
+    }
+
+    auto measure = [&](auto func) {
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& events : tracks) {
+            func(events);
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    size_t mapSize = 0;
+    double mapTime = measure([&](const std::vector<std::pair<msecs_t, EventType> >& events) {
+        EventSequenceMap map;
+        for (const auto& event : events) {
+            map[event.first].insert(event.second);
+        }
+        mapSize += map.size();
+    });
+
+    size_t timelineSize = 0;
+    double timelineTime = measure([&](const std::vector<std::pair<msecs_t, EventType> >& events) {
+        Timeline timeline;
+        timeline.reserve(events.size());
+        for (const auto& event : events) {
+            timeline.add(event.first, event.second);
+        }
+        timeline.build();
+        timelineSize += timeline.size();
+    });
+
+    LOGI() << "reload of " << trackCount << " tracks: map of sets " << mapTime << " ms, timeline " << timelineTime << " ms";
+
+    EXPECT_GT(mapSize, 0);
+    EXPECT_GE(timelineSize, mapSize);
+}
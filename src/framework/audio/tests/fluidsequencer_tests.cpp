@@ -0,0 +1,168 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "audio/engine/internal/synthesizers/fluidsynth/fluidsequencer.h"
+
+using namespace muse;
+using namespace muse::audio;
+using namespace muse::audio::synth;
+using namespace muse::mpe;
+
+class Audio_FluidSequencerTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        AudioSanitizer::setupEngineThread();
+    }
+
+    static PlaybackEventList note(timestamp_t timestamp, duration_t duration, pitch_level_t pitch,
+                                  ArticulationType pedalType = ArticulationType::Undefined, duration_t pedalDuration = 0)
+    {
+        ArticulationMap articulations;
+        if (pedalType != ArticulationType::Undefined) {
+            ArticulationPattern pattern;
+            pattern.emplace(0, ArticulationPatternSegment(ArrangementPattern(HUNDRED_PERCENT, 0), PitchPattern(), ExpressionPattern()));
+
+            ArticulationMeta meta(pedalType, pattern, timestamp, pedalDuration);
+            articulations.emplace(pedalType, ArticulationAppliedData(meta, 0, HUNDRED_PERCENT));
+            articulations.preCalculateAverageData();
+        }
+
+        return { NoteEvent(timestamp, duration, 0, 0, pitch, dynamicLevelFromType(DynamicType::Natural), articulations, 1.0) };
+    }
+
+    static mpe::PlaybackData trackData(ArticulationType pedalType)
+    {
+        mpe::PlaybackData data;
+        for (int i = 0; i < 16; ++i) {
+            const timestamp_t timestamp = i * 500;
+            data.originEvents.emplace(timestamp, note(timestamp, 500, pitchLevel(PitchClass::C, 4) + i * PITCH_LEVEL_STEP,
+                                                      i % 4 == 0 ? pedalType : ArticulationType::Undefined, 1500));
+        }
+        return data;
+    }
+
+    static FluidSequencer::EventSequenceMap play(FluidSequencer& sequencer)
+    {
+        sequencer.setActive(true);
+        sequencer.setPlaybackPosition(0);
+        return sequencer.movePlaybackForward(10000);
+    }
+
+    //! NOTE Applies the changes as a delta to one sequencer and as the whole track to another one
+    static void checkDeltaEqualsFullRebuild(ArticulationType pedalType)
+    {
+        // [GIVEN] Loaded and active sequencer
+        mpe::PlaybackData data = trackData(pedalType);
+
+        FluidSequencer sequencer;
+        sequencer.init(PlaybackSetupData(), std::nullopt, false);
+        sequencer.load(data);
+        sequencer.setActive(true);
+
+        // [WHEN] Add a note where the first pedal is released, change a note with a pedal and remove a note
+        PlaybackEventsMap changes;
+        changes.emplace(1520, note(1520, 100, pitchLevel(PitchClass::E, 4)));
+        changes.emplace(2000, note(2000, 250, pitchLevel(PitchClass::D, 4), pedalType, 1000));
+        changes.emplace(3500, PlaybackEventList());
+
+        data.mainStreamDelta.send(changes, data.dynamics);
+
+        // [THEN] The sequencer plays the same events as the one loaded with the changed track
+        mpe::PlaybackData expectedData = trackData(pedalType);
+        for (const auto& pair : changes) {
+            if (pair.second.empty()) {
+                expectedData.originEvents.erase(pair.first);
+            } else {
+                expectedData.originEvents.insert_or_assign(pair.first, pair.second);
+            }
+        }
+
+        FluidSequencer expected;
+        expected.init(PlaybackSetupData(), std::nullopt, false);
+        expected.load(expectedData);
+
+        EXPECT_EQ(sequencer.playbackData().originEvents, expectedData.originEvents);
+        EXPECT_EQ(play(sequencer), play(expected));
+    }
+};
+
+TEST_F(Audio_FluidSequencerTests, MainStreamDelta_Notes)
+{
+    checkDeltaEqualsFullRebuild(ArticulationType::Undefined);
+}
+
+TEST_F(Audio_FluidSequencerTests, MainStreamDelta_SustainPedal)
+{
+    checkDeltaEqualsFullRebuild(ArticulationType::Pedal);
+}
+
+TEST_F(Audio_FluidSequencerTests, MainStreamDelta_SostenutoPedal)
+{
+    //! NOTE The sostenuto pedal is pressed a bit after the note, so it ends after the events of the note
+    checkDeltaEqualsFullRebuild(ArticulationType::LaissezVibrer);
+}
+
+TEST_F(Audio_FluidSequencerTests, MainStreamDelta_SostenutoPedalAddedAndRemoved)
+{
+    // [GIVEN] Loaded and active sequencer with a track without pedals
+    mpe::PlaybackData data = trackData(ArticulationType::Undefined);
+
+    FluidSequencer sequencer;
+    sequencer.init(PlaybackSetupData(), std::nullopt, false);
+    sequencer.load(data);
+    sequencer.setActive(true);
+
+    mpe::PlaybackData expectedData = trackData(ArticulationType::Undefined);
+
+    auto applyChanges = [&data, &expectedData](const PlaybackEventsMap& changes) {
+        data.mainStreamDelta.send(changes, data.dynamics);
+
+        for (const auto& pair : changes) {
+            expectedData.originEvents.insert_or_assign(pair.first, pair.second);
+        }
+    };
+
+    auto checkSequencer = [&sequencer, &expectedData]() {
+        FluidSequencer expected;
+        expected.init(PlaybackSetupData(), std::nullopt, false);
+        expected.load(expectedData);
+
+        EXPECT_EQ(play(sequencer), play(expected));
+    };
+
+    // [WHEN] A sostenuto pedal is added, then a note after it is changed
+    applyChanges({ { 2000, note(2000, 250, pitchLevel(PitchClass::D, 4), ArticulationType::LaissezVibrer, 1000) } });
+    applyChanges({ { 2500, note(2500, 100, pitchLevel(PitchClass::E, 4)) } });
+
+    // [THEN] The sequencer plays the same events as the one loaded with the changed track
+    checkSequencer();
+
+    // [WHEN] The pedal is removed again, then another note is changed
+    applyChanges({ { 2000, note(2000, 250, pitchLevel(PitchClass::D, 4)) } });
+    applyChanges({ { 3000, note(3000, 100, pitchLevel(PitchClass::F, 4)) } });
+
+    // [THEN] The sequencer still plays the same events as the one loaded with the changed track
+    checkSequencer();
+}
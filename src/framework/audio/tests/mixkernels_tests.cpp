@@ -0,0 +1,154 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "audio/engine/internal/dsp/mixkernels.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::audio;
+
+class Audio_MixKernelsTests : public ::testing::Test
+{
+public:
+    static std::vector<float> randomSamples(size_t count, unsigned seed)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+        std::vector<float> samples(count);
+        for (float& s : samples) {
+            s = dist(gen);
+        }
+
+        return samples;
+    }
+};
+
+TEST_F(Audio_MixKernelsTests, MixSamples)
+{
+    //! NOTE Odd count to cover the scalar tail
+    constexpr size_t count = 1027;
+
+    std::vector<float> src = randomSamples(count, 1);
+    std::vector<float> dst = randomSamples(count, 2);
+    std::vector<float> expected = dst;
+
+    dsp::scalar::mixSamples(expected.data(), src.data(), count);
+    dsp::mixSamples(dst.data(), src.data(), count);
+
+    EXPECT_EQ(dst, expected);
+}
+
+TEST_F(Audio_MixKernelsTests, MixSamplesWithGain)
+{
+    constexpr size_t count = 1027;
+
+    std::vector<float> src = randomSamples(count, 3);
+    std::vector<float> dst = randomSamples(count, 4);
+    std::vector<float> expected = dst;
+
+    dsp::scalar::mixSamplesWithGain(expected.data(), src.data(), 0.3f, count);
+    dsp::mixSamplesWithGain(dst.data(), src.data(), 0.3f, count);
+
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_FLOAT_EQ(dst[i], expected[i]);
+    }
+}
+
+TEST_F(Audio_MixKernelsTests, ApplyGainsAndMeasure)
+{
+    const float gains[] = { 0.5f, 0.8f, 1.2f };
+
+    //! NOTE 1 and 2 channels take the vectorized path, 3 channels the scalar fallback
+    for (audioch_t channels : { 1, 2, 3 }) {
+        constexpr samples_t samplesPerChannel = 513;
+
+        std::vector<float> buffer = randomSamples(samplesPerChannel * channels, 5);
+        std::vector<float> expected = buffer;
+
+        float expectedSums[3] = {};
+        float sums[3] = {};
+
+        dsp::scalar::applyGainsAndMeasure(expected.data(), channels, samplesPerChannel, gains, expectedSums);
+        dsp::applyGainsAndMeasure(buffer.data(), channels, samplesPerChannel, gains, sums);
+
+        EXPECT_EQ(buffer, expected);
+
+        for (audioch_t ch = 0; ch < channels; ++ch) {
+            //! NOTE The summation order differs, so only rounding level differences are allowed
+            EXPECT_NEAR(sums[ch], expectedSums[ch], expectedSums[ch] * 1e-5f);
+        }
+    }
+}
+
+//! Disabled unless MUSE_AUDIO_BENCHMARK is set, e.g.
+//!   MUSE_AUDIO_BENCHMARK=1 ./muse_audio_tests --gtest_filter=Audio_MixKernelsTests.Benchmark
+TEST_F(Audio_MixKernelsTests, Benchmark)
+{
+    if (!std::getenv("MUSE_AUDIO_BENCHMARK")) {
+        GTEST_SKIP() << "MUSE_AUDIO_BENCHMARK is not set";
+    }
+
+    constexpr audioch_t channels = 2;
+    constexpr samples_t samplesPerChannel = 512;
+    constexpr size_t count = samplesPerChannel * channels;
+    constexpr int iterations = 20000;
+
+    const float gains[channels] = { 0.7f, 0.9f };
+    float sums[channels] = {};
+
+    std::vector<float> src = randomSamples(count, 6);
+    std::vector<float> dst(count, 0.f);
+
+    auto measure = [&](auto func) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            func();
+        }
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+    };
+
+    double scalarMix = measure([&]() { dsp::scalar::mixSamples(dst.data(), src.data(), count); });
+    double simdMix = measure([&]() { dsp::mixSamples(dst.data(), src.data(), count); });
+
+    std::vector<float> buffer = src;
+    double scalarGains = measure([&]() {
+        dsp::scalar::applyGainsAndMeasure(buffer.data(), channels, samplesPerChannel, gains, sums);
+    });
+
+    buffer = src;
+    double simdGains = measure([&]() {
+        dsp::applyGainsAndMeasure(buffer.data(), channels, samplesPerChannel, gains, sums);
+    });
+
+    LOGI() << "mix: scalar " << scalarMix << " us, simd " << simdMix << " us per block";
+    LOGI() << "gains and metering: scalar " << scalarGains << " us, simd " << simdGains << " us per block";
+
+    EXPECT_GT(sums[0], 0.f);
+}
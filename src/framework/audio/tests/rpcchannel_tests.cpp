@@ -0,0 +1,193 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <thread>
+
+#include "audio/common/audiosanitizer.h"
+#include "audio/common/rpc/platform/general/generalrpcchannel.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::audio;
+using namespace muse::audio::rpc;
+
+class Audio_RpcChannelTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        AudioSanitizer::setupMainThread();
+        m_channel.setupOnMain();
+    }
+
+    static mpe::PlaybackEventsMap makeEvents(size_t count)
+    {
+        mpe::PlaybackEventsMap events;
+
+        for (size_t i = 0; i < count; ++i) {
+            mpe::ArrangementContext arrangementCtx;
+            arrangementCtx.nominalTimestamp = static_cast<mpe::timestamp_t>(i) * 500;
+            arrangementCtx.actualTimestamp = arrangementCtx.nominalTimestamp;
+            arrangementCtx.nominalDuration = 500;
+            arrangementCtx.actualDuration = 500;
+            arrangementCtx.bps = 2;
+
+            mpe::PitchContext pitchCtx;
+            pitchCtx.nominalPitchLevel = mpe::pitchLevel(mpe::PitchClass::C, 4) + static_cast<mpe::pitch_level_t>(i % 12);
+            pitchCtx.pitchCurve.emplace(0, 0);
+            pitchCtx.pitchCurve.emplace(mpe::HUNDRED_PERCENT, 0);
+
+            mpe::ExpressionContext expressionCtx;
+            expressionCtx.nominalDynamicLevel = mpe::dynamicLevelFromType(mpe::DynamicType::mf);
+            expressionCtx.expressionCurve.emplace(0, expressionCtx.nominalDynamicLevel);
+            expressionCtx.expressionCurve.emplace(mpe::HUNDRED_PERCENT, expressionCtx.nominalDynamicLevel);
+
+            events[arrangementCtx.nominalTimestamp].emplace_back(mpe::NoteEvent(std::move(arrangementCtx),
+                                                                                std::move(pitchCtx),
+                                                                                std::move(expressionCtx)));
+        }
+
+        return events;
+    }
+
+    //! NOTE Sends the events through a stream to the worker thread, as the playback does on a score reload
+    mpe::PlaybackEventsMap sendThroughStream(const mpe::PlaybackEventsMap& events, double* msecs = nullptr)
+    {
+        mpe::MainStreamChanges mainCh;
+        mpe::MainStreamChanges workerCh;
+        StreamId streamId = m_channel.addSendStream(StreamName::PlaybackDataMainStream, mainCh);
+
+        std::promise<void> registered;
+        std::promise<void> sent;
+        std::shared_future<void> sentFuture = sent.get_future().share();
+        mpe::PlaybackEventsMap received;
+
+        std::thread worker([&]() {
+            async::Asyncable receiver;
+            m_channel.addReceiveStream(StreamName::PlaybackDataMainStream, streamId, workerCh);
+            workerCh.onReceive(&receiver, [&received](const mpe::PlaybackEventsMap& events, const mpe::DynamicLevelLayers&) {
+                received = events;
+            });
+            registered.set_value();
+
+            sentFuture.wait();
+            m_channel.process();
+
+            workerCh.resetOnReceive(&receiver);
+            m_channel.removeStream(streamId);
+        });
+
+        registered.get_future().wait();
+
+        auto start = std::chrono::steady_clock::now();
+        mainCh.send(events, mpe::DynamicLevelLayers());
+        sent.set_value();
+        worker.join();
+        auto end = std::chrono::steady_clock::now();
+
+        if (msecs) {
+            *msecs = std::chrono::duration<double, std::milli>(end - start).count();
+        }
+
+        m_channel.removeStream(streamId);
+
+        return received;
+    }
+
+    GeneralRpcChannel m_channel;
+};
+
+TEST_F(Audio_RpcChannelTests, Payload_SameAddressSpace)
+{
+    // [GIVEN] A big payload
+    mpe::PlaybackData origin;
+    origin.originEvents = makeEvents(100);
+    std::string name = "track";
+
+    // [WHEN] It is set to a message of an in-process channel
+    Msg msg = make_request(Method::AddTrackWithPlaybackData);
+    set_payload(&m_channel, msg, name, origin);
+
+    // [THEN] Nothing is packed
+    EXPECT_TRUE(msg.data.empty());
+    EXPECT_TRUE(msg.values);
+
+    // [THEN] The values are the same on the other side
+    std::string resultName;
+    mpe::PlaybackData result;
+    EXPECT_TRUE(get_payload(msg, resultName, result));
+    EXPECT_EQ(resultName, name);
+    EXPECT_EQ(result, origin);
+
+    // [THEN] The values of other types are rejected
+    int wrongType = 0;
+    EXPECT_FALSE(get_payload(msg, resultName, wrongType));
+}
+
+TEST_F(Audio_RpcChannelTests, Stream_SameAddressSpace)
+{
+    // [GIVEN] Playback events of a track
+    mpe::PlaybackEventsMap events = makeEvents(100);
+
+    // [WHEN] They are sent through the stream
+    mpe::PlaybackEventsMap received = sendThroughStream(events);
+
+    // [THEN] The worker thread receives the same events
+    EXPECT_EQ(received, events);
+}
+
+//! Disabled unless MUSE_AUDIO_BENCHMARK is set, e.g.
+//!   MUSE_AUDIO_BENCHMARK=1 ./muse_audio_tests --gtest_filter=Audio_RpcChannelTests.Stream_ReloadLatency
+TEST_F(Audio_RpcChannelTests, Stream_ReloadLatency)
+{
+    if (!std::getenv("MUSE_AUDIO_BENCHMARK")) {
+        GTEST_SKIP() << "MUSE_AUDIO_BENCHMARK is not set";
+    }
+
+    // [GIVEN] Playback events of a long track
+    mpe::PlaybackEventsMap events = makeEvents(50000);
+
+    // [WHEN] They are sent through the stream
+    double streamMsecs = 0.0;
+    mpe::PlaybackEventsMap received = sendThroughStream(events, &streamMsecs);
+    EXPECT_EQ(received.size(), events.size());
+
+    // [WHEN] They are packed and unpacked, as it is done for the channels in another address space
+    auto start = std::chrono::steady_clock::now();
+    ByteArray data = RpcPacker::pack(events, mpe::DynamicLevelLayers());
+    mpe::PlaybackEventsMap unpacked;
+    mpe::DynamicLevelLayers dynamics;
+    EXPECT_TRUE(RpcPacker::unpack(data, unpacked, dynamics));
+    auto end = std::chrono::steady_clock::now();
+    double packedMsecs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    // [THEN] The result is the same
+    EXPECT_EQ(unpacked, events);
+
+    LOGI() << "reload of " << events.size() << " events: stream " << streamMsecs << " ms, "
+           << "packing " << packedMsecs << " ms (" << data.size() << " bytes)";
+}
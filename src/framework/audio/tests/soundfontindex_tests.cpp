@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "audio/engine/internal/synthesizers/soundfontindex.h"
+
+using namespace muse;
+using namespace muse::audio;
+using namespace muse::audio::synth;
+
+class Audio_SoundFontIndexTests : public ::testing::Test
+{
+public:
+    static SoundFontMeta makeMeta(const SoundFontPath& path)
+    {
+        SoundFontMeta meta;
+        meta.name = "GM";
+        meta.path = path;
+
+        for (midi::program_t program = 0; program < 128; ++program) {
+            SoundFontPreset preset;
+            preset.program = midi::Program(0, program);
+            preset.name = "Preset " + std::to_string(program);
+            meta.presets.push_back(preset);
+        }
+
+        return meta;
+    }
+};
+
+TEST_F(Audio_SoundFontIndexTests, RestoreFromData)
+{
+    // [GIVEN] An index with a parsed sound font
+    SoundFontPath path = "/sf/GM.sf2";
+    SoundFontIndex::FileStamp stamp { 1200000000, "2025-01-01T10:00:00" };
+    SoundFontMeta meta = makeMeta(path);
+
+    SoundFontIndex index;
+    index.insert(path, stamp, meta);
+
+    // [WHEN] The index is stored and restored
+    SoundFontIndex restored = SoundFontIndex::fromData(index.toData());
+
+    // [THEN] The presets are found for the same file
+    const SoundFontMeta* found = restored.find(path, stamp);
+    ASSERT_TRUE(found);
+    EXPECT_EQ(found->name, meta.name);
+    EXPECT_EQ(found->path, meta.path);
+    ASSERT_EQ(found->presets.size(), meta.presets.size());
+    for (size_t i = 0; i < meta.presets.size(); ++i) {
+        EXPECT_EQ(found->presets.at(i).program, meta.presets.at(i).program);
+        EXPECT_EQ(found->presets.at(i).name, meta.presets.at(i).name);
+    }
+}
+
+TEST_F(Audio_SoundFontIndexTests, ChangedFile)
+{
+    // [GIVEN] An index with a parsed sound font
+    SoundFontPath path = "/sf/GM.sf2";
+    SoundFontIndex::FileStamp stamp { 1200000000, "2025-01-01T10:00:00" };
+
+    SoundFontIndex index;
+    index.insert(path, stamp, makeMeta(path));
+
+    // [THEN] Nothing is found if the file has changed
+    EXPECT_FALSE(index.find(path, SoundFontIndex::FileStamp { 1200000001, stamp.lastModified }));
+    EXPECT_FALSE(index.find(path, SoundFontIndex::FileStamp { stamp.size, "2025-02-01T10:00:00" }));
+
+    // [THEN] Nothing is found for another file
+    EXPECT_FALSE(index.find("/sf/Other.sf2", stamp));
+}
+
+TEST_F(Audio_SoundFontIndexTests, Prune)
+{
+    // [GIVEN] An index with two parsed sound fonts
+    SoundFontIndex::FileStamp stamp { 1200000000, "2025-01-01T10:00:00" };
+
+    SoundFontIndex index;
+    index.insert("/sf/GM.sf2", stamp, makeMeta("/sf/GM.sf2"));
+    index.insert("/sf/Deleted.sf2", stamp, makeMeta("/sf/Deleted.sf2"));
+
+    // [WHEN] Only one of them is still installed
+    size_t removed = index.prune({ "/sf/GM.sf2" });
+
+    // [THEN] The entry of the other one is removed
+    EXPECT_EQ(removed, 1);
+    EXPECT_EQ(index.size(), 1);
+    EXPECT_TRUE(index.find("/sf/GM.sf2", stamp));
+    EXPECT_FALSE(index.find("/sf/Deleted.sf2", stamp));
+
+    // [THEN] Nothing is removed while the sound font is installed
+    EXPECT_EQ(index.prune({ "/sf/GM.sf2", "/sf/New.sf2" }), 0);
+    EXPECT_EQ(index.size(), 1);
+}
+
+TEST_F(Audio_SoundFontIndexTests, BrokenData)
+{
+    // [WHEN] The stored data is broken
+    SoundFontIndex restored = SoundFontIndex::fromData(ByteArray("broken"));
+
+    // [THEN] The index is empty, so the sound fonts will be parsed again
+    EXPECT_EQ(restored.size(), 0);
+}
@@ -98,6 +98,9 @@ void AbPaintProvider::paintData(muse::draw::IPaintProviderPtr provider, const mu
         for (const DrawText& t : d.texts) {
             if (t.mode == DrawText::Point) {
                 provider->drawText(t.rect.topLeft(), t.text);
+            } else if (t.mode == DrawText::Symbols) {
+                std::u32string codes = t.text.toStdU32String();
+                provider->drawSymbols(t.points.data(), codes.data(), std::min(codes.size(), t.points.size()));
             } else {
                 provider->drawText(t.rect, t.flags, t.text);
             }
@@ -54,6 +54,10 @@
 
 #include "muse_framework_config.h"
 
+#ifdef MUSE_MODULE_AUDIO
+#include "view/system/audioinfomodel.h"
+#endif
+
 #include "log.h"
 
 using namespace muse::diagnostics;
@@ -109,6 +113,9 @@ void DiagnosticsModule::registerUiTypes()
     qmlRegisterType<ActionsViewModel>("Muse.Diagnostics", 1, 0, "ActionsViewModel");
     qmlRegisterType<ProfilerViewModel>("Muse.Diagnostics", 1, 0, "ProfilerViewModel");
     qmlRegisterType<GraphicsInfoModel>("Muse.Diagnostics", 1, 0, "GraphicsInfoModel");
+#ifdef MUSE_MODULE_AUDIO
+    qmlRegisterType<AudioInfoModel>("Muse.Diagnostics", 1, 0, "AudioInfoModel");
+#endif
 
     qmlRegisterType<DiagnosticNavigationModel>("Muse.Diagnostics", 1, 0, "DiagnosticNavigationModel");
     qmlRegisterUncreatableType<AbstractKeyNavDevItem>("Muse.Diagnostics", 1, 0, "AbstractKeyNavDevItem", "Cannot create a Abstract");
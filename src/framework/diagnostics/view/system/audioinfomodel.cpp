@@ -0,0 +1,70 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "audioinfomodel.h"
+
+#include <QClipboard>
+#include <QGuiApplication>
+
+using namespace muse::diagnostics;
+using namespace muse::audio;
+
+AudioInfoModel::AudioInfoModel()
+{
+}
+
+void AudioInfoModel::update()
+{
+    if (!startAudioController()) {
+        return;
+    }
+
+    const AudioCallbackStats stats = startAudioController()->callbackStats();
+
+    m_info = "\n";
+    m_info += "Audio started:        " + QString(startAudioController()->isAudioStarted() ? "yes" : "no") + "\n";
+    m_info += "Callbacks:            " + QString::number(stats.callbackCount) + "\n";
+    m_info += "Underruns:            " + QString::number(stats.underrunCount) + "\n";
+    m_info += "Missing samples:      " + QString::number(stats.missingSamples) + "\n";
+    m_info += "Max callback time:    " + QString::number(stats.maxCallbackDuration / 1000.0, 'f', 3) + " ms\n";
+
+    emit infoChanged();
+}
+
+void AudioInfoModel::resetStats()
+{
+    if (!startAudioController()) {
+        return;
+    }
+
+    startAudioController()->resetCallbackStats();
+    update();
+}
+
+void AudioInfoModel::copyToClipboard()
+{
+    QGuiApplication::clipboard()->setText(m_info);
+}
+
+QString AudioInfoModel::info() const
+{
+    return m_info;
+}
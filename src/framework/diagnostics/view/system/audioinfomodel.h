@@ -0,0 +1,53 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <QObject>
+
+#include "modularity/ioc.h"
+#include "audio/main/istartaudiocontroller.h"
+
+namespace muse::diagnostics {
+class AudioInfoModel : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QString info READ info NOTIFY infoChanged FINAL)
+
+    muse::Inject<audio::IStartAudioController> startAudioController;
+
+public:
+    AudioInfoModel();
+
+    QString info() const;
+
+    Q_INVOKABLE void update();
+    Q_INVOKABLE void resetStats();
+    Q_INVOKABLE void copyToClipboard();
+
+signals:
+    void infoChanged();
+
+private:
+    QString m_info;
+};
+}
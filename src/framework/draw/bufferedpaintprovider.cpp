@@ -44,6 +44,7 @@ void BufferedPaintProvider::beginTarget(const std::string& name)
     m_buf->name = name;
     m_stateIsUsed = false;
     m_currentStateNo = 0;
+    m_savedStates = {};
     m_buf->states[m_currentStateNo] = DrawData::State(); // default
     beginObject("target_" + name);
     m_isActive = true;
@@ -164,6 +165,24 @@ DrawData::Data& BufferedPaintProvider::editableData()
     return editableItem().datas.back();
 }
 
+DrawData::Data& BufferedPaintProvider::editableData(DataKind kind)
+{
+    DrawData::Data& data = editableData();
+
+    //! NOTE The kinds of a data are painted in order (paths, polygons, texts, pixmaps),
+    //! so if something is drawn over a later kind, we start a new data to keep the drawing order
+    bool isOverLaterKind = (kind < DataKind::Polygon && !data.polygons.empty())
+                           || (kind < DataKind::Text && !data.texts.empty())
+                           || (kind < DataKind::Pixmap && !data.pixmaps.empty());
+    if (!isOverLaterKind) {
+        return data;
+    }
+
+    DrawData::Data& next = editableItem().datas.emplace_back();
+    next.state = m_currentStateNo;
+    return next;
+}
+
 DrawData::State& BufferedPaintProvider::editableState()
 {
     {
@@ -199,6 +218,11 @@ void BufferedPaintProvider::setAntialiasing(bool arg)
     editableState().isAntialiasing = arg;
 }
 
+bool BufferedPaintProvider::isAntialiasing() const
+{
+    return currentState().isAntialiasing;
+}
+
 void BufferedPaintProvider::setCompositionMode(CompositionMode mode)
 {
     editableState().compositionMode = mode;
@@ -250,10 +274,21 @@ const Brush& BufferedPaintProvider::brush() const
 
 void BufferedPaintProvider::save()
 {
+    m_savedStates.push(currentState());
 }
 
 void BufferedPaintProvider::restore()
 {
+    IF_ASSERT_FAILED(!m_savedStates.empty()) {
+        return;
+    }
+
+    DrawData::State saved = m_savedStates.top();
+    m_savedStates.pop();
+
+    if (saved != currentState()) {
+        editableState() = saved;
+    }
 }
 
 void BufferedPaintProvider::setTransform(const Transform& transform)
@@ -278,7 +313,7 @@ void BufferedPaintProvider::drawPath(const PainterPath& path)
     } else if (st.brush.style() == BrushStyle::NoBrush) {
         mode = DrawMode::Stroke;
     }
-    editableData().paths.push_back({ path, st.pen, st.brush, mode });
+    editableData(DataKind::Path).paths.push_back({ path, st.pen, st.brush, mode });
 }
 
 void BufferedPaintProvider::drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode)
@@ -287,17 +322,17 @@ void BufferedPaintProvider::drawPolygon(const PointF* points, size_t pointCount,
     for (size_t i = 0; i < pointCount; ++i) {
         pol[i] = PointF(points[i].x(), points[i].y());
     }
-    editableData().polygons.push_back(DrawPolygon { pol, mode });
+    editableData(DataKind::Polygon).polygons.push_back(DrawPolygon { pol, mode });
 }
 
 void BufferedPaintProvider::drawText(const PointF& point, const String& text)
 {
-    editableData().texts.push_back(DrawText { DrawText::Point, RectF(point, SizeF()), 0, text });
+    editableData(DataKind::Text).texts.push_back(DrawText { DrawText::Point, RectF(point, SizeF()), 0, text });
 }
 
 void BufferedPaintProvider::drawText(const RectF& rect, int flags, const String& text)
 {
-    editableData().texts.push_back(DrawText { DrawText::Rect, rect, flags, text });
+    editableData(DataKind::Text).texts.push_back(DrawText { DrawText::Rect, rect, flags, text });
 }
 
 void BufferedPaintProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
@@ -311,48 +346,75 @@ void BufferedPaintProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
     drawText(point, String::fromUcs4(&ucs4Code, 1));
 }
 
+void BufferedPaintProvider::drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count)
+{
+    if (count == 0) {
+        return;
+    }
+
+    //! NOTE Recorded as one run, so that the replay draws it as one run too
+    DrawText run { DrawText::Symbols, RectF(points[0], SizeF()), 0, String::fromUcs4(ucs4Codes, count) };
+    run.points.assign(points, points + count);
+    editableData(DataKind::Text).texts.push_back(std::move(run));
+}
+
 void BufferedPaintProvider::drawPixmap(const PointF& p, const Pixmap& pm)
 {
-    editableData().pixmaps.push_back(DrawPixmap { DrawPixmap::Single, RectF(p, SizeF()), pm, PointF() });
+    editableData(DataKind::Pixmap).pixmaps.push_back(DrawPixmap { DrawPixmap::Single, RectF(p, SizeF()), pm, PointF() });
 }
 
 void BufferedPaintProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
 {
-    editableData().pixmaps.push_back(DrawPixmap { DrawPixmap::Tiled, rect, pm, offset });
+    editableData(DataKind::Pixmap).pixmaps.push_back(DrawPixmap { DrawPixmap::Tiled, rect, pm, offset });
 }
 
 #ifndef NO_QT_SUPPORT
 void BufferedPaintProvider::drawPixmap(const PointF& p, const QPixmap& pm)
 {
-    editableData().pixmaps.push_back(DrawPixmap { DrawPixmap::Single, RectF(p, SizeF()), Pixmap::fromQPixmap(pm), PointF() });
+    editableData(DataKind::Pixmap).pixmaps.push_back(DrawPixmap { DrawPixmap::Single, RectF(p, SizeF()), Pixmap::fromQPixmap(pm), PointF() });
 }
 
 void BufferedPaintProvider::drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset)
 {
-    editableData().pixmaps.push_back(DrawPixmap { DrawPixmap::Tiled, rect, Pixmap::fromQPixmap(pm), offset });
+    editableData(DataKind::Pixmap).pixmaps.push_back(DrawPixmap { DrawPixmap::Tiled, rect, Pixmap::fromQPixmap(pm), offset });
 }
 
 #endif
 
 bool BufferedPaintProvider::hasClipping() const
 {
-    return false;
+    return currentState().clip.mode != DrawData::Clip::None;
 }
 
 void BufferedPaintProvider::setClipRect(const RectF& rect)
 {
-    UNUSED(rect);
+    DrawData::State& st = editableState();
+    st.clip.mode = DrawData::Clip::Rect;
+    st.clip.rect = rect;
+    st.clip.maskRects.clear();
+    st.clip.transform = st.transform;
 }
 
 void BufferedPaintProvider::setMask(const RectF& background, const std::vector<RectF>& maskRects)
 {
-    UNUSED(background);
-    UNUSED(maskRects);
+    if (maskRects.empty()) {
+        setClipping(false);
+        return;
+    }
+
+    DrawData::State& st = editableState();
+    st.clip.mode = DrawData::Clip::Mask;
+    st.clip.rect = background;
+    st.clip.maskRects = maskRects;
+    st.clip.transform = st.transform;
 }
 
 void BufferedPaintProvider::setClipping(bool enable)
 {
-    UNUSED(enable);
+    //! NOTE Enabling is done by setClipRect or setMask, they are what we can replay
+    if (!enable && hasClipping()) {
+        editableState().clip = DrawData::Clip();
+    }
 }
 
 DrawDataPtr BufferedPaintProvider::drawData() const
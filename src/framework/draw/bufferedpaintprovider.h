@@ -22,6 +22,8 @@
 #ifndef MUSE_DRAW_BUFFEREDPAINTPROVIDER_H
 #define MUSE_DRAW_BUFFEREDPAINTPROVIDER_H
 
+#include <stack>
+
 #include "ipaintprovider.h"
 #include "types/drawdata.h"
 #include "types/pen.h"
@@ -44,6 +46,7 @@ public:
     void endObject() override;
 
     void setAntialiasing(bool arg) override;
+    bool isAntialiasing() const override;
     void setCompositionMode(CompositionMode mode) override;
     void setWindow(const RectF& window) override;
     void setViewport(const RectF& viewport) override;
@@ -73,6 +76,7 @@ public:
     void drawTextWorkaround(const Font& f, const PointF& pos, const String& text) override;
 
     void drawSymbol(const PointF& point, char32_t ucs4Code) override;
+    void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count) override;
 
     void drawPixmap(const PointF& p, const Pixmap& pm) override;
     void drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset = PointF()) override;
@@ -95,11 +99,19 @@ public:
 
 private:
 
+    enum class DataKind {
+        Path = 0,
+        Polygon,
+        Text,
+        Pixmap
+    };
+
     const DrawData::Item& currentItem() const;
     DrawData::Item& editableItem();
 
     const DrawData::Data& currentData() const;
     DrawData::Data& editableData();
+    DrawData::Data& editableData(DataKind kind);
 
     const DrawData::State& currentState() const;
     DrawData::State& editableState();
@@ -110,6 +122,7 @@ private:
     int m_itemLevel = -1;
     bool m_stateIsUsed = false;
     int m_currentStateNo = 0;
+    std::stack<DrawData::State> m_savedStates;
     bool m_isActive = false;
     DrawObjectsLogger* m_drawObjectsLogger = nullptr;
 };
@@ -21,6 +21,8 @@
  */
 #include "qpainterprovider.h"
 
+#include <algorithm>
+
 #include <QPainter>
 #include <QRawFont>
 #include <QTextLayout>
@@ -111,6 +113,11 @@ void QPainterProvider::setAntialiasing(bool arg)
     m_painter->setRenderHint(QPainter::TextAntialiasing, arg);
 }
 
+bool QPainterProvider::isAntialiasing() const
+{
+    return m_painter->testRenderHint(QPainter::Antialiasing);
+}
+
 void QPainterProvider::setCompositionMode(CompositionMode mode)
 {
     auto toQPainter = [](CompositionMode mode) {
@@ -313,6 +320,48 @@ void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
     drawText(point, cache.value(ucs4Code));
 }
 
+void QPainterProvider::drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count)
+{
+    if (count == 0) {
+        return;
+    }
+
+    //! NOTE The raw font depends on the resolution of the device, so it's cached for both
+    const QFont& font = m_painter->font();
+    const QPaintDevice* device = m_painter->device();
+    if (!m_symbolsRawFont.isValid() || m_symbolsFont != font || m_symbolsDevice != device) {
+        m_symbolsFont = font;
+        m_symbolsDevice = device;
+        m_symbolsRawFont = QRawFont::fromFont(QFont(font, device));
+    }
+
+    QVector<quint32> glyphIndexes;
+    if (m_symbolsRawFont.isValid()) {
+        glyphIndexes = m_symbolsRawFont.glyphIndexesForString(QString::fromUcs4(ucs4Codes, static_cast<qsizetype>(count)));
+    }
+
+    //! NOTE Symbols missing in the font are drawn one by one, so that the text engine can substitute them
+    bool allGlyphsFound = glyphIndexes.size() == static_cast<qsizetype>(count)
+                          && std::find(glyphIndexes.cbegin(), glyphIndexes.cend(), 0) == glyphIndexes.cend();
+    if (!allGlyphsFound) {
+        IPaintProvider::drawSymbols(points, ucs4Codes, count);
+        return;
+    }
+
+    QVector<QPointF> positions;
+    positions.reserve(static_cast<qsizetype>(count));
+    for (size_t i = 0; i < count; ++i) {
+        positions.push_back(points[i].toQPointF());
+    }
+
+    QGlyphRun glyphRun;
+    glyphRun.setRawFont(m_symbolsRawFont);
+    glyphRun.setGlyphIndexes(glyphIndexes);
+    glyphRun.setPositions(positions);
+
+    m_painter->drawGlyphRun(QPointF(), glyphRun);
+}
+
 void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
 {
     QString key = QString::number(pm.key());
@@ -21,9 +21,13 @@
  */
 #pragma once
 
+#include <QFont>
+#include <QRawFont>
+
 #include "../ipaintprovider.h"
 
 class QPainter;
+class QPaintDevice;
 class QImage;
 
 namespace muse::draw {
@@ -48,6 +52,7 @@ public:
     void endObject() override;
 
     void setAntialiasing(bool arg) override;
+    bool isAntialiasing() const override;
     void setCompositionMode(CompositionMode mode) override;
     void setWindow(const RectF& window) override;
     void setViewport(const RectF& viewport) override;
@@ -77,6 +82,7 @@ public:
     void drawTextWorkaround(const Font& f, const PointF& pos, const String& text) override;
 
     void drawSymbol(const PointF& point, char32_t ucs4Code) override;
+    void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count) override;
 
     void drawPixmap(const PointF& point, const Pixmap& pm) override;
     void drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset = PointF()) override;
@@ -101,5 +107,9 @@ private:
     Brush m_brush;
 
     Transform m_transform;
+
+    QFont m_symbolsFont;
+    const QPaintDevice* m_symbolsDevice = nullptr;
+    QRawFont m_symbolsRawFont;
 };
 }
@@ -48,6 +48,7 @@ public:
     virtual void endObject() = 0;
 
     virtual void setAntialiasing(bool arg) = 0;
+    virtual bool isAntialiasing() const = 0;
     virtual void setCompositionMode(CompositionMode mode) = 0;
     virtual void setWindow(const RectF& window) = 0;
     virtual void setViewport(const RectF& viewport) = 0;
@@ -77,6 +78,12 @@ public:
     virtual void drawTextWorkaround(const Font& f, const PointF& pos, const String& text) = 0; // see Painter::drawTextWorkaround .h file
 
     virtual void drawSymbol(const PointF& point, char32_t ucs4Code) = 0;
+    virtual void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            drawSymbol(points[i], ucs4Codes[i]);
+        }
+    }
 
     virtual void drawPixmap(const PointF& point, const Pixmap& pm) = 0;
     virtual void drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset = PointF()) = 0;
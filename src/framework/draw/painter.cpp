@@ -452,6 +452,14 @@ void Painter::drawSymbol(const PointF& point, char32_t ucs4Code)
     }
 }
 
+void Painter::drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count)
+{
+    m_provider->drawSymbols(points, ucs4Codes, count);
+    if (extended) {
+        extended->drawSymbols(points, ucs4Codes, count);
+    }
+}
+
 void Painter::fillRect(const RectF& rect, const Brush& brush)
 {
     Pen oldPen = this->pen();
@@ -143,6 +143,8 @@ public:
     void drawTextWorkaround(Font& f, const PointF pos, const String& text);
 
     void drawSymbol(const PointF& point, char32_t ucs4Code);
+    //! NOTE Draws a run of symbols with the current font and pen in one go
+    void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count);
 
     void fillRect(const RectF& rect, const Brush& brush);
 
@@ -21,13 +21,21 @@
  */
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdlib>
+
 #include <QPainter>
 #include <QImage>
+#include <QFontDatabase>
 
 #include "draw/painter.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
 
 #include "draw/internal/qpainterprovider.h"
 
+#include "log.h"
+
 using namespace muse;
 using namespace muse::draw;
 
@@ -41,6 +49,37 @@ static QPainter* getUnderlyingQPainter(const Painter* painter)
     return dynamic_cast<QPainterProvider*>(painter->provider().get())->qpainter();
 }
 
+static void drawSymbols(QImage& image, bool asRun, const PointF* points, const char32_t* codes, size_t count, size_t repeat = 1)
+{
+    QPainter qp(&image);
+    Painter painter(&qp, "test");
+    painter.setAntialiasing(true);
+    painter.scale(1.5, 1.5);
+
+    Font font = Font::fromQFont(QFontDatabase::systemFont(QFontDatabase::GeneralFont), Font::Type::Unknown);
+    font.setPointSizeF(20.0);
+    painter.setFont(font);
+    painter.setPen(Color::BLACK);
+
+    for (size_t r = 0; r < repeat; ++r) {
+        if (asRun) {
+            painter.drawSymbols(points, codes, count);
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                painter.drawSymbol(points[i], codes[i]);
+            }
+        }
+    }
+}
+
+static QImage renderSymbols(bool asRun, const PointF* points, const char32_t* codes, size_t count)
+{
+    QImage image(200, 100, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::white);
+    drawSymbols(image, asRun, points, codes, count);
+    return image;
+}
+
 TEST_F(Draw_PainterTests, Painter_FromNewQPainter)
 {
     //! GIVEN New QPainter
@@ -156,3 +195,278 @@ TEST_F(Draw_PainterTests, Painter_SaveRestore)
 
     EXPECT_EQ(painter.provider()->transform(), worldTransform * expectedViewTransform);
 }
+
+TEST_F(Draw_PainterTests, DrawData_ReplayKeepsOrderAndTransform)
+{
+    //! GIVEN Recorded drawing with a text between two rects
+    std::shared_ptr<BufferedPaintProvider> recorder = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(recorder, "record");
+        painter.translate(10.0, 0.0);
+        painter.drawRect(RectF(0.0, 0.0, 10.0, 1.0));
+        painter.drawText(PointF(1.0, 1.0), u"text");
+        painter.drawRect(RectF(0.0, 5.0, 10.0, 1.0));
+        painter.endDraw();
+    }
+
+    DrawDataPtr recorded = recorder->drawData();
+
+    //! DO Replay it into a painter that is already translated
+    std::shared_ptr<BufferedPaintProvider> target = std::make_shared<BufferedPaintProvider>();
+    Painter painter(target, "replay");
+    painter.translate(0.0, 20.0);
+
+    DrawDataPaint::paint(&painter, recorded);
+    painter.endDraw();
+
+    //! CHECK The text stays between the paths
+    const std::vector<DrawData::Data>& datas = target->drawData()->item.datas;
+
+    std::vector<std::string> kinds;
+    for (const DrawData::Data& d : datas) {
+        for (size_t i = 0; i < d.paths.size(); ++i) {
+            kinds.push_back("path");
+        }
+        for (size_t i = 0; i < d.texts.size(); ++i) {
+            kinds.push_back("text");
+        }
+    }
+
+    EXPECT_EQ(kinds, std::vector<std::string>({ "path", "text", "path" }));
+
+    //! CHECK The recorded transform is applied on top of the painter transform
+    const DrawData::State& state = target->drawData()->states.at(datas.back().state);
+    EXPECT_EQ(state.transform, Transform().translate(10.0, 0.0) * Transform().translate(0.0, 20.0));
+
+    //! CHECK The painter transform is restored afterwards
+    EXPECT_EQ(target->transform(), painter.worldTransform());
+}
+
+TEST_F(Draw_PainterTests, DrawData_RecordSaveRestoreAndMask)
+{
+    //! GIVEN Painter recording the drawing
+    std::shared_ptr<BufferedPaintProvider> recorder = std::make_shared<BufferedPaintProvider>();
+    Painter painter(recorder, "record");
+    painter.setPen(Pen(Color::BLACK, 1.0));
+    painter.translate(10.0, 0.0);
+
+    //! DO Draw with another pen and transform, masked, between save and restore
+    painter.save();
+    painter.setPen(Pen(Color::RED, 2.0));
+    painter.translate(0.0, 5.0);
+    painter.setMask(RectF(0.0, 0.0, 20.0, 20.0), { RectF(5.0, 5.0, 10.0, 10.0) });
+
+    //! CHECK The mask is recorded
+    EXPECT_TRUE(painter.hasClipping());
+
+    painter.drawRect(RectF(0.0, 0.0, 20.0, 20.0));
+    painter.restore();
+
+    //! CHECK Pen, transform and clipping are restored
+    EXPECT_EQ(recorder->pen(), Pen(Color::BLACK, 1.0));
+    EXPECT_EQ(recorder->transform(), Transform().translate(10.0, 0.0));
+    EXPECT_FALSE(painter.hasClipping());
+
+    painter.drawRect(RectF(0.0, 0.0, 1.0, 1.0));
+    painter.endDraw();
+
+    //! CHECK Only the masked drawing is recorded with the mask, in the coordinates it was set in
+    const DrawDataPtr data = recorder->drawData();
+    size_t maskedCount = 0;
+    for (const DrawData::Data& d : data->item.datas) {
+        const DrawData::Clip& clip = data->states.at(d.state).clip;
+        if (clip.mode == DrawData::Clip::None) {
+            continue;
+        }
+
+        ++maskedCount;
+        EXPECT_EQ(clip.mode, DrawData::Clip::Mask);
+        EXPECT_EQ(clip.rect, RectF(0.0, 0.0, 20.0, 20.0));
+        EXPECT_EQ(clip.maskRects, std::vector<RectF>({ RectF(5.0, 5.0, 10.0, 10.0) }));
+        EXPECT_EQ(clip.transform, Transform().translate(10.0, 0.0).translate(0.0, 5.0));
+    }
+
+    EXPECT_EQ(maskedCount, 1);
+}
+
+TEST_F(Draw_PainterTests, DrawData_ReplayAppliesMask)
+{
+    //! GIVEN A filled rect recorded with a mask over its middle
+    std::shared_ptr<BufferedPaintProvider> recorder = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(recorder, "record");
+        painter.setNoPen();
+        painter.setBrush(Brush(Color::BLACK));
+        painter.save();
+        painter.translate(10.0, 10.0);
+        painter.setMask(RectF(0.0, 0.0, 40.0, 40.0), { RectF(10.0, 10.0, 20.0, 20.0) });
+        painter.drawRect(RectF(0.0, 0.0, 40.0, 40.0));
+        painter.restore();
+        painter.drawRect(RectF(60.0, 60.0, 10.0, 10.0));
+        painter.endDraw();
+    }
+
+    //! DO Replay it into a QPainter
+    QImage image(100, 100, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::white);
+    {
+        QPainter qp(&image);
+        Painter painter(&qp, "replay");
+        DrawDataPaint::paint(&painter, recorder->drawData());
+
+        //! CHECK The painter isn't left clipped
+        EXPECT_FALSE(painter.hasClipping());
+        painter.endDraw();
+    }
+
+    //! CHECK The rect is drawn around the mask, not inside it, and the drawing after restore isn't masked
+    EXPECT_EQ(image.pixel(15, 15), qRgb(0, 0, 0));
+    EXPECT_EQ(image.pixel(30, 30), qRgb(255, 255, 255));
+    EXPECT_EQ(image.pixel(65, 65), qRgb(0, 0, 0));
+}
+
+TEST_F(Draw_PainterTests, Painter_DrawSymbols)
+{
+    //! GIVEN Painter recording the drawing
+    std::shared_ptr<BufferedPaintProvider> recorder = std::make_shared<BufferedPaintProvider>();
+    Painter painter(recorder, "test");
+
+    //! DO Draw a run of symbols
+    const PointF points[] = { PointF(0.0, 0.0), PointF(5.0, 1.0), PointF(10.0, 2.0) };
+    const char32_t codes[] = { 0xE0A4, 0xE0A3, 0xE0A2 };
+    painter.drawSymbols(points, codes, 3);
+    painter.endDraw();
+
+    //! CHECK The run is recorded as one, with every symbol at its own position
+    const DrawData::Data& data = recorder->drawData()->item.datas.front();
+    ASSERT_EQ(data.texts.size(), 1u);
+
+    const DrawText& run = data.texts.front();
+    EXPECT_EQ(run.mode, DrawText::Symbols);
+    EXPECT_EQ(run.text, String::fromUcs4(codes, 3));
+    EXPECT_EQ(run.points, std::vector<PointF>(points, points + 3));
+
+    //! DO Replay it
+    std::shared_ptr<BufferedPaintProvider> target = std::make_shared<BufferedPaintProvider>();
+    Painter targetPainter(target, "replay");
+    DrawDataPaint::paint(&targetPainter, recorder->drawData());
+    targetPainter.endDraw();
+
+    //! CHECK It is replayed as one run
+    const DrawData::Data& replayed = target->drawData()->item.datas.front();
+    ASSERT_EQ(replayed.texts.size(), 1u);
+    EXPECT_EQ(replayed.texts.front(), run);
+}
+
+TEST_F(Draw_PainterTests, DrawData_ReplayFollowsAntialiasing)
+{
+    //! GIVEN Drawing recorded with antialiasing
+    std::shared_ptr<BufferedPaintProvider> recorder = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(recorder, "record");
+        painter.setAntialiasing(true);
+        painter.drawRect(RectF(0.0, 0.0, 10.0, 1.0));
+        painter.endDraw();
+    }
+
+    //! DO Replay it into a painter without antialiasing
+    std::shared_ptr<BufferedPaintProvider> target = std::make_shared<BufferedPaintProvider>();
+    Painter painter(target, "replay");
+    painter.setAntialiasing(false);
+
+    DrawDataPaint::paint(&painter, recorder->drawData());
+
+    //! CHECK The painter stays without antialiasing afterwards
+    EXPECT_FALSE(target->isAntialiasing());
+
+    painter.endDraw();
+
+    //! CHECK The recorded drawing is replayed without antialiasing
+    size_t pathCount = 0;
+    for (const DrawData::Data& d : target->drawData()->item.datas) {
+        if (!d.paths.empty()) {
+            EXPECT_FALSE(target->drawData()->states.at(d.state).isAntialiasing);
+            pathCount += d.paths.size();
+        }
+    }
+
+    EXPECT_EQ(pathCount, 1);
+}
+
+TEST_F(Draw_PainterTests, QPainter_DrawSymbolsLikeDrawSymbol)
+{
+    if (QFontDatabase::families().isEmpty()) {
+        GTEST_SKIP() << "no fonts available";
+    }
+
+    //! GIVEN Symbols that are in the font, at positions that aren't on the pixel grid
+    const PointF points[] = { PointF(2.0, 30.0), PointF(20.5, 33.25), PointF(41.75, 28.5), PointF(60.0, 45.0) };
+    const char32_t codes[] = { U'A', U'g', U'#', U'b' };
+
+    //! DO Draw them one by one and as one glyph run
+    QImage expected = renderSymbols(false, points, codes, 4);
+    QImage actual = renderSymbols(true, points, codes, 4);
+
+    //! CHECK Something is drawn and the images are the same, up to the antialiasing of a few edge pixels
+    int drawn = 0;
+    int different = 0;
+    for (int y = 0; y < expected.height(); ++y) {
+        for (int x = 0; x < expected.width(); ++x) {
+            int e = qGray(expected.pixel(x, y));
+            int a = qGray(actual.pixel(x, y));
+            if (e < 128) {
+                ++drawn;
+            }
+            if (std::abs(e - a) > 64) {
+                ++different;
+            }
+        }
+    }
+
+    EXPECT_GT(drawn, 0);
+    EXPECT_LE(different, drawn / 50);
+
+    //! GIVEN Symbols that aren't in the font
+    const char32_t missingCodes[] = { U'A', 0x10FFFD, U'b', 0x10FFFD };
+
+    //! DO Draw them one by one and as one run
+    QImage expectedMissing = renderSymbols(false, points, missingCodes, 4);
+    QImage actualMissing = renderSymbols(true, points, missingCodes, 4);
+
+    //! CHECK The run falls back to drawing them one by one
+    EXPECT_EQ(actualMissing, expectedMissing);
+}
+
+//! Disabled unless MUSE_DRAW_BENCHMARK is set, e.g.
+//!   MUSE_DRAW_BENCHMARK=1 ./muse_draw_tests --gtest_filter=Draw_PainterTests.QPainter_DrawSymbolsBenchmark
+TEST_F(Draw_PainterTests, QPainter_DrawSymbolsBenchmark)
+{
+    if (!std::getenv("MUSE_DRAW_BENCHMARK")) {
+        GTEST_SKIP() << "MUSE_DRAW_BENCHMARK is not set";
+    }
+
+    //! NOTE A key signature of 7 accidentals, drawn 20000 times
+    constexpr size_t count = 7;
+    constexpr size_t repeat = 20000;
+
+    PointF points[count];
+    char32_t codes[count];
+    for (size_t i = 0; i < count; ++i) {
+        points[i] = PointF(10.0 + i * 12.0, 30.0 + (i % 3) * 5.0);
+        codes[i] = i % 2 ? U'b' : U'#';
+    }
+
+    QImage image(200, 100, QImage::Format_ARGB32_Premultiplied);
+
+    auto measure = [&](bool asRun) {
+        image.fill(Qt::white);
+        auto start = std::chrono::steady_clock::now();
+        drawSymbols(image, asRun, points, codes, count, repeat);
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    double symbolTime = measure(false);
+    double runTime = measure(true);
+
+    LOGI() << repeat << " runs of " << count << " symbols: one by one " << symbolTime << " ms, as glyph runs " << runTime << " ms";
+}
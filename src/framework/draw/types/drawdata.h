@@ -22,7 +22,9 @@
 #ifndef MUSE_DRAW_BUFFEREDDRAWTYPES_H
 #define MUSE_DRAW_BUFFEREDDRAWTYPES_H
 
+#include <map>
 #include <memory>
+#include <vector>
 
 #include "brush.h"
 #include "drawtypes.h"
@@ -76,16 +78,18 @@ struct DrawText {
     enum Mode {
         Undefined = 0,
         Point,
-        Rect
+        Rect,
+        Symbols
     };
 
     Mode mode = Mode::Undefined;
-    RectF rect;     // If mode is Point when use topLeft point
+    RectF rect;     // If mode is Point or Symbols when use topLeft point
     int flags = 0;
     String text;
+    std::vector<PointF> points; // used only for Symbols mode, a point for each symbol of the text
     bool operator==(const DrawText& o) const
     {
-        return mode == o.mode && flags == o.flags && rect == o.rect && text == o.text;
+        return mode == o.mode && flags == o.flags && rect == o.rect && text == o.text && points == o.points;
     }
 
     bool operator!=(const DrawText& o) const { return !this->operator==(o); }
@@ -108,6 +112,26 @@ struct DrawData
 {
     static const int CANVAS_DPI = 360;
 
+    struct Clip {
+        enum Mode {
+            None = 0,
+            Rect,
+            Mask
+        };
+
+        Mode mode = Mode::None;
+        RectF rect;                 // If mode is Mask when it is the background of the mask
+        std::vector<RectF> maskRects;
+        Transform transform;        // The transform at the moment the clip was set
+
+        bool operator==(const Clip& o) const
+        {
+            return mode == o.mode && rect == o.rect && maskRects == o.maskRects && transform == o.transform;
+        }
+
+        bool operator!=(const Clip& o) const { return !this->operator==(o); }
+    };
+
     struct State {
         Pen pen;
         Brush brush;
@@ -115,11 +139,13 @@ struct DrawData
         Transform transform;
         bool isAntialiasing = false;
         CompositionMode compositionMode = CompositionMode::SourceOver;
+        Clip clip;
 
         bool operator==(const State& o) const
         {
             return pen == o.pen && brush == o.brush && font == o.font && transform == o.transform
-                   && isAntialiasing == o.isAntialiasing && compositionMode == o.compositionMode;
+                   && isAntialiasing == o.isAntialiasing && compositionMode == o.compositionMode
+                   && clip == o.clip;
         }
 
         bool operator!=(const State& o) const { return !this->operator==(o); }
@@ -347,6 +347,16 @@ static bool isEqual(const DrawText& v1, const DrawText& v2, DrawDataComp::Tolera
         return false;
     }
 
+    if (v1.points.size() != v2.points.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < v1.points.size(); ++i) {
+        if (!isEqual(v1.points.at(i), v2.points.at(i), tolerance.base)) {
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -174,6 +174,37 @@ static void fromArr(const JsonArray& arr, Size& sz)
     sz = Size(arr.at(0).toInt(), arr.at(1).toInt());
 }
 
+static JsonObject toObj(const DrawData::Clip& clip)
+{
+    JsonObject obj;
+    obj["mode"] = static_cast<int>(clip.mode);
+    obj["rect"] = toArr(clip.rect);
+    JsonArray maskRects;
+    for (const RectF& r : clip.maskRects) {
+        maskRects.append(toArr(r));
+    }
+    obj["maskRects"] = maskRects;
+    obj["transform"] = toArr(clip.transform);
+    return obj;
+}
+
+static void fromObj(const JsonObject& obj, DrawData::Clip& clip)
+{
+    clip.mode = static_cast<DrawData::Clip::Mode>(obj["mode"].toInt());
+    if (clip.mode == DrawData::Clip::None) {
+        return;
+    }
+
+    fromArr(obj["rect"].toArray(), clip.rect);
+    const JsonArray maskRects = obj["maskRects"].toArray();
+    for (size_t i = 0; i < maskRects.size(); ++i) {
+        RectF r;
+        fromArr(maskRects.at(i).toArray(), r);
+        clip.maskRects.push_back(r);
+    }
+    fromArr(obj["transform"].toArray(), clip.transform);
+}
+
 static JsonObject toObj(const DrawData::State& st)
 {
     JsonObject obj;
@@ -183,6 +214,9 @@ static JsonObject toObj(const DrawData::State& st)
     obj["isAntialiasing"] = st.isAntialiasing;
     obj["transform"] = toArr(st.transform);
     obj["compositionMode"] = static_cast<int>(st.compositionMode);
+    if (st.clip.mode != DrawData::Clip::None) {
+        obj["clip"] = toObj(st.clip);
+    }
     return obj;
 }
 
@@ -194,6 +228,7 @@ static void fromObj(const JsonObject& obj, DrawData::State& st)
     st.isAntialiasing = obj["isAntialiasing"].toBool();
     fromArr(obj["transform"].toArray(), st.transform);
     st.compositionMode = static_cast<CompositionMode>(obj["compositionMode"].toInt());
+    fromObj(obj["clip"].toObject(), st.clip);
 }
 
 static JsonObject toObj(const PainterPath& path)
@@ -315,6 +350,12 @@ static JsonObject toObj(const DrawText& text)
     JsonObject o;
     if (text.mode == DrawText::Point) {
         o["point"] = toArr(text.rect.topLeft());
+    } else if (text.mode == DrawText::Symbols) {
+        JsonArray points;
+        for (const PointF& p : text.points) {
+            points.append(toArr(p));
+        }
+        o["points"] = points;
     } else {
         o["rect"] = toArr(text.rect);
     }
@@ -330,6 +371,15 @@ static void fromObj(const JsonObject& obj, DrawText& text)
         fromArr(obj["point"].toArray(), point);
         text.mode = DrawText::Point;
         text.rect = RectF(point, SizeF());
+    } else if (obj.contains("points")) {
+        const JsonArray points = obj["points"].toArray();
+        for (size_t i = 0; i < points.size(); ++i) {
+            PointF p;
+            fromArr(points.at(i).toArray(), p);
+            text.points.push_back(p);
+        }
+        text.mode = DrawText::Symbols;
+        text.rect = RectF(text.points.empty() ? PointF() : text.points.front(), SizeF());
     } else {
         fromArr(obj["rect"].toArray(), text.rect);
         text.mode = DrawText::Rect;
@@ -27,7 +27,7 @@ using namespace muse;
 using namespace muse::draw;
 
 static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, const std::map<int, DrawData::State>& states,
-                     const Color& overlay)
+                     const Transform& baseTransform, bool baseAntialiasing, const Color& overlay)
 {
     // first draw obj itself
     for (const DrawData::Data& d : item.datas) {
@@ -37,11 +37,24 @@ static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, co
             st.brush.setColor(overlay);
         }
 
+        //! NOTE The clip replaces the clip of the painter, like it does when the item is painted directly,
+        //! so it is set in between save and restore, to get the clip of the painter back
+        const bool isClipped = st.clip.mode != DrawData::Clip::None;
+        if (isClipped) {
+            provider->save();
+            provider->setTransform(st.clip.transform * baseTransform);
+            if (st.clip.mode == DrawData::Clip::Rect) {
+                provider->setClipRect(st.clip.rect);
+            } else {
+                provider->setMask(st.clip.rect, st.clip.maskRects);
+            }
+        }
+
         provider->setPen(st.pen);
         provider->setBrush(st.brush);
         provider->setFont(st.font);
-        provider->setTransform(st.transform);
-        provider->setAntialiasing(st.isAntialiasing);
+        provider->setTransform(st.transform * baseTransform);
+        provider->setAntialiasing(st.isAntialiasing && baseAntialiasing);
         provider->setCompositionMode(st.compositionMode);
 
         for (const DrawPath& path : d.paths) {
@@ -50,6 +63,11 @@ static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, co
             provider->drawPath(path.path);
         }
 
+        if (!d.paths.empty()) {
+            provider->setPen(st.pen);
+            provider->setBrush(st.brush);
+        }
+
         for (const DrawPolygon& pl : d.polygons) {
             if (pl.polygon.empty()) {
                 continue;
@@ -60,6 +78,9 @@ static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, co
         for (const DrawText& t : d.texts) {
             if (t.mode == DrawText::Point) {
                 provider->drawText(t.rect.topLeft(), t.text);
+            } else if (t.mode == DrawText::Symbols) {
+                std::u32string codes = t.text.toStdU32String();
+                provider->drawSymbols(t.points.data(), codes.data(), std::min(codes.size(), t.points.size()));
             } else {
                 provider->drawText(t.rect, t.flags, t.text);
             }
@@ -72,16 +93,35 @@ static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, co
                 provider->drawTiledPixmap(px.rect, px.pm, px.offset);
             }
         }
+
+        if (isClipped) {
+            provider->restore();
+        }
     }
 
     // second draw chilren
     for (const DrawData::Item& ch : item.chilren) {
-        drawItem(provider, ch, states, overlay);
+        drawItem(provider, ch, states, baseTransform, baseAntialiasing, overlay);
     }
 }
 
 void DrawDataPaint::paint(Painter* painter, const DrawDataPtr& data, const Color& overlay)
 {
     IPaintProviderPtr provider = painter->provider();
-    drawItem(provider, data->item, data->states, overlay);
+
+    //! NOTE The data is drawn relative to the current transform of the painter, without antialiasing
+    //! if the painter has it off, and the painter state is restored afterwards
+    const Transform baseTransform = provider->transform();
+    const bool baseAntialiasing = provider->isAntialiasing();
+    const Pen pen = provider->pen();
+    const Brush brush = provider->brush();
+    const Font font = provider->font();
+
+    drawItem(provider, data->item, data->states, baseTransform, baseAntialiasing, overlay);
+
+    provider->setPen(pen);
+    provider->setBrush(brush);
+    provider->setFont(font);
+    provider->setTransform(baseTransform);
+    provider->setAntialiasing(baseAntialiasing);
 }
@@ -110,43 +110,56 @@ static void writeMSDosDate(uint8_t* dest, const std::tm& dt)
     }
 }
 
-static int inflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
+static ByteArray inflateData(const uint8_t* source, size_t sourceLen, size_t expectedLen)
 {
     z_stream stream;
-    int err;
-
     stream.next_in = const_cast<Bytef*>(source);
     stream.avail_in = (uInt)sourceLen;
-    if ((uLong)stream.avail_in != sourceLen) {
-        return Z_BUF_ERROR;
-    }
-
-    stream.next_out = dest;
-    stream.avail_out = (uInt) * destLen;
-    if ((uLong)stream.avail_out != *destLen) {
-        return Z_BUF_ERROR;
-    }
-
     stream.zalloc = (alloc_func)0;
     stream.zfree = (free_func)0;
+    stream.opaque = (voidpf)0;
 
-    err = inflateInit2(&stream, -MAX_WBITS);
-    if (err != Z_OK) {
-        return err;
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        LOGW("Zip: Z_MEM_ERROR: Not enough memory");
+        return ByteArray();
     }
 
-    err = inflate(&stream, Z_FINISH);
-    if (err != Z_STREAM_END) {
-        inflateEnd(&stream);
-        if (err == Z_NEED_DICT || (err == Z_BUF_ERROR && stream.avail_in == 0)) {
-            return Z_DATA_ERROR;
+    //! NOTE The size from the header is only a hint, the buffer grows if the data is bigger
+    ByteArray result(std::max(expectedLen, size_t(1)));
+    int err = Z_OK;
+    while (err == Z_OK) {
+        if (stream.total_out == result.size()) {
+            result.resize(result.size() * 2);
+        }
+
+        stream.next_out = result.data() + stream.total_out;
+        stream.avail_out = (uInt)(result.size() - stream.total_out);
+
+        err = inflate(&stream, Z_NO_FLUSH);
+        if (err == Z_BUF_ERROR && stream.avail_out != 0) {
+            // no progress possible, the input is truncated
+            err = Z_DATA_ERROR;
+        } else if (err == Z_BUF_ERROR) {
+            err = Z_OK;
         }
-        return err;
     }
-    *destLen = stream.total_out;
 
-    err = inflateEnd(&stream);
-    return err;
+    size_t len = stream.total_out;
+    inflateEnd(&stream);
+
+    switch (err) {
+    case Z_STREAM_END:
+        break;
+    case Z_MEM_ERROR:
+        LOGW("Zip: Z_MEM_ERROR: Not enough memory");
+        return ByteArray();
+    default:
+        LOGW("Zip: Z_DATA_ERROR: Input data is corrupted");
+        return ByteArray();
+    }
+
+    result.truncate(len);
+    return result;
 }
 
 static int deflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
@@ -787,41 +800,23 @@ ByteArray ZipContainer::fileData(const std::string& fileName) const
         return ByteArray();
     }
 
-    ByteArray compressed = p->device->read(compressed_size);
     if (compression_method == CompressionMethodStored) {
         // no compression
-        compressed.truncate(uncompressed_size);
-        return compressed;
+        ByteArray data = p->device->read(compressed_size);
+        data.truncate(uncompressed_size);
+        return data;
     } else if (compression_method == CompressionMethodDeflated) {
         // Deflate
-        //qDebug("compressed=%d", compressed.size());
-        compressed.truncate(compressed_size);
-        ByteArray baunzip;
-        ulong len = std::max(uncompressed_size,  1);
-        int res;
-        do {
-            baunzip.resize(len);
-            res = inflate((uint8_t*)baunzip.data(), &len,
-                          (const uint8_t*)compressed.constData(), compressed_size);
+        //! NOTE The devices are memory backed, so we inflate straight from the device data
+        //! into a buffer of the final size, without copying the compressed data first
+        const size_t available = p->device->size() - p->device->pos();
+        if (static_cast<size_t>(compressed_size) > available) {
+            LOGW("Zip: Z_DATA_ERROR: Input data is corrupted");
+            return ByteArray();
+        }
 
-            switch (res) {
-            case Z_OK:
-                if ((size_t)len != baunzip.size()) {
-                    baunzip.resize(len);
-                }
-                break;
-            case Z_MEM_ERROR:
-                LOGW("Zip: Z_MEM_ERROR: Not enough memory");
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            case Z_DATA_ERROR:
-                LOGW("Zip: Z_DATA_ERROR: Input data is corrupted");
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
-        return baunzip;
+        const uint8_t* compressed = p->device->readData() + p->device->pos();
+        return inflateData(compressed, compressed_size, uncompressed_size);
     }
 
     LOGW("Zip: Unsupported compression method %d is needed to extract the data.", compression_method);
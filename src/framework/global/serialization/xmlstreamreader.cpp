@@ -32,6 +32,7 @@ using namespace muse;
 using namespace muse::io;
 
 struct XmlStreamReader::Xml {
+    ByteArray buffer; // parsed in place, the nodes point into it
     pugi::xml_document doc;
     pugi::xml_node node{};
     pugi::xml_parse_result result{};
@@ -46,8 +47,7 @@ XmlStreamReader::XmlStreamReader()
 XmlStreamReader::XmlStreamReader(IODevice* device)
 {
     m_xml = new Xml();
-    ByteArray data = device->readAll();
-    setData(data);
+    setData(device->readAll());
 }
 
 XmlStreamReader::XmlStreamReader(const ByteArray& data)
@@ -56,6 +56,12 @@ XmlStreamReader::XmlStreamReader(const ByteArray& data)
     setData(data);
 }
 
+XmlStreamReader::XmlStreamReader(ByteArray&& data)
+{
+    m_xml = new Xml();
+    setData(std::move(data));
+}
+
 #ifndef NO_QT_SUPPORT
 XmlStreamReader::XmlStreamReader(const QByteArray& data)
 {
@@ -71,11 +77,18 @@ XmlStreamReader::~XmlStreamReader()
     delete m_xml;
 }
 
-void XmlStreamReader::setData(const ByteArray& data_)
+void XmlStreamReader::setData(const ByteArray& data)
+{
+    //! NOTE The data is shared, it will be copied only if the caller keeps it
+    setData(ByteArray(data));
+}
+
+void XmlStreamReader::setData(ByteArray&& data_)
 {
     TRACEFUNC;
 
     m_xml->doc.reset();
+    m_xml->buffer = ByteArray();
     m_xml->customErr.clear();
     m_token = TokenType::Invalid;
 
@@ -96,13 +109,14 @@ void XmlStreamReader::setData(const ByteArray& data_)
         return;
     }
 
-    ByteArray data = data_; // no copy, implicit sharing
     if (enc == UtfCodec::Encoding::UTF_16LE) {
         String u16 = String::fromUtf16LE(data_);
-        data = u16.toUtf8();
+        m_xml->buffer = u16.toUtf8();
     } else if (enc == UtfCodec::Encoding::UTF_16BE) {
         String u16 = String::fromUtf16BE(data_);
-        data = u16.toUtf8();
+        m_xml->buffer = u16.toUtf8();
+    } else {
+        m_xml->buffer = std::move(data_);
     }
 
     // pugi needs explicit flags to surface declaration/doctype/comments as nodes
@@ -110,7 +124,11 @@ void XmlStreamReader::setData(const ByteArray& data_)
                      | pugi::parse_declaration
                      | pugi::parse_doctype
                      | pugi::parse_comments;
-    m_xml->result = m_xml->doc.load_buffer(data.constData(), data.size(), flags);
+
+    //! NOTE Parsing in place saves pugi a copy of the whole document.
+    //! `data()` detaches, so a buffer that is still shared with the caller is copied here instead
+    const size_t size = m_xml->buffer.size();
+    m_xml->result = m_xml->doc.load_buffer_inplace(m_xml->buffer.data(), size, flags);
 
     if (m_xml->result.status == pugi::status_ok) {
         m_token = TokenType::NoToken;
@@ -351,7 +369,7 @@ String XmlStreamReader::nodeValue(Xml* xml) const
     }
 
     String str = String::fromUtf8(raw);
-    if (!m_entities.empty()) {
+    if (!m_entities.empty() && std::strchr(raw, '&')) {
         for (const auto& p : m_entities) {
             str.replace(p.first, p.second);
         }
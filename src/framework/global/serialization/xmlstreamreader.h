@@ -68,6 +68,7 @@ public:
     XmlStreamReader();
     explicit XmlStreamReader(io::IODevice* device);
     explicit XmlStreamReader(const ByteArray& data);
+    explicit XmlStreamReader(ByteArray&& data);
 #ifndef NO_QT_SUPPORT
     explicit XmlStreamReader(const QByteArray& data);
 #endif
@@ -77,6 +78,7 @@ public:
     XmlStreamReader& operator=(const XmlStreamReader&) = delete;
 
     void setData(const ByteArray& data);
+    void setData(ByteArray&& data);
 
     bool readNextStartElement();
     bool atEnd() const;
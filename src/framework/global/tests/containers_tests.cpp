@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "containers.h"
+#include "types/sharedmap.h"
 
 using namespace muse;
 
@@ -82,3 +83,33 @@ TEST_F(Global_Types_ContainersTests, FindLessOrEqual)
     // [THEN] Return cend()
     EXPECT_EQ(it, map.cend());
 }
+
+TEST_F(Global_Types_ContainersTests, SharedMap_LazyData)
+{
+    // [GIVEN] An empty map, nothing is allocated yet
+    SharedMap<int, int> map;
+    const SharedMap<int, int>& cmap = map;
+
+    // [THEN] Read access works on the empty map
+    EXPECT_TRUE(cmap.empty());
+    EXPECT_EQ(cmap.size(), 0);
+    EXPECT_EQ(cmap.find(1), cmap.cend());
+    EXPECT_EQ(cmap.begin(), cmap.end());
+    EXPECT_TRUE(map == (SharedMap<int, int> {}));
+
+    // [WHEN] A copy is made and the original one is changed
+    SharedMap<int, int> copy = map;
+    map.insert({ 1, 10 });
+
+    // [THEN] The copy stays empty
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_TRUE(copy.empty());
+
+    // [WHEN] The map is cleared while another copy shares its data
+    copy = map;
+    map.clear();
+
+    // [THEN] Only the cleared one is empty
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(copy.at(1), 10);
+}
@@ -21,13 +21,18 @@
  */
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <string>
 
 #include "types/bytearray.h"
 #include "types/string.h"
 #include "serialization/xmlstreamreader.h"
 
+#include "log.h"
+
 using namespace muse;
 
 namespace {
@@ -258,3 +263,84 @@ TEST_F(Serialization_XmlStreamReaderTests, ProcessingInstructionsIgnored)
     EXPECT_EQ(advanceTo(xr, XmlStreamReader::TokenType::EndElement), XmlStreamReader::TokenType::EndElement);
     EXPECT_EQ(advanceTo(xr, XmlStreamReader::TokenType::EndDocument), XmlStreamReader::TokenType::EndDocument);
 }
+
+// ---------- The caller's data is not changed by parsing in place ----------
+TEST_F(Serialization_XmlStreamReaderTests, SharedDataIsNotModified)
+{
+    // pugi normalizes line ends and escapes while parsing in place
+    const char* xml = "<a>x &amp; y\r\nz</a>";
+    const ByteArray data = BA(xml);
+
+    XmlStreamReader xr(data);
+    EXPECT_EQ(advanceTo(xr, XmlStreamReader::TokenType::Characters), XmlStreamReader::TokenType::Characters);
+    EXPECT_EQ(xr.text(), u"x & y\nz");
+
+    EXPECT_EQ(data, BA(xml));
+}
+
+// ---------- Moved data is parsed without a copy and gives the same tokens ----------
+TEST_F(Serialization_XmlStreamReaderTests, MovedData)
+{
+    const char* xml = "<root a=\"1\"><child>text</child></root>";
+
+    XmlStreamReader xr(BA(xml));
+
+    EXPECT_EQ(advanceTo(xr, XmlStreamReader::TokenType::StartElement), XmlStreamReader::TokenType::StartElement);
+    EXPECT_EQ(xr.name(), AsciiStringView("root"));
+    EXPECT_EQ(xr.asciiAttribute("a"), AsciiStringView("1"));
+
+    EXPECT_EQ(advanceTo(xr, XmlStreamReader::TokenType::StartElement), XmlStreamReader::TokenType::StartElement);
+    EXPECT_EQ(xr.readAsciiText(), AsciiStringView("text"));
+}
+
+// ---------- Throughput of parsing and walking a large document ----------
+//! Disabled unless MUSE_XML_BENCHMARK is set, e.g.
+//!   MUSE_XML_BENCHMARK=1 ./muse_global_tests --gtest_filter=Serialization_XmlStreamReaderTests.Benchmark
+TEST_F(Serialization_XmlStreamReaderTests, Benchmark)
+{
+    if (!std::getenv("MUSE_XML_BENCHMARK")) {
+        GTEST_SKIP() << "MUSE_XML_BENCHMARK is not set";
+    }
+
+    std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<score-partwise version=\"4.0\">\n";
+    for (int i = 0; i < 100000; ++i) {
+        xml += "  <note default-x=\"12.5\"><pitch><step>C</step><octave>4</octave></pitch>"
+               "<duration>1</duration><type>quarter</type><lyric><text>la &amp; la</text></lyric></note>\n";
+    }
+    xml += "</score-partwise>\n";
+
+    const double megabytes = static_cast<double>(xml.size()) / (1024.0 * 1024.0);
+
+    auto walk = [](XmlStreamReader& xr) {
+        size_t elements = 0;
+        while (xr.readNext() != XmlStreamReader::TokenType::EndDocument) {
+            if (xr.isStartElement()) {
+                ++elements;
+            }
+        }
+        return elements;
+    };
+
+    auto measure = [&](auto func) {
+        auto start = std::chrono::steady_clock::now();
+        size_t elements = func();
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        EXPECT_EQ(elements, 100000 * 8 + 1);
+        return megabytes / secs;
+    };
+
+    // The caller keeps the data, so it has to be copied
+    const ByteArray shared = BA(xml.c_str());
+    double sharedMbPerSec = measure([&]() {
+        XmlStreamReader xr(shared);
+        return walk(xr);
+    });
+
+    // The data is handed over, so it is parsed in place
+    double movedMbPerSec = measure([&]() {
+        XmlStreamReader xr(BA(xml.c_str()));
+        return walk(xr);
+    });
+
+    LOGI() << "size: " << megabytes << " MB, shared data: " << sharedMbPerSec << " MB/s, moved data: " << movedMbPerSec << " MB/s";
+}
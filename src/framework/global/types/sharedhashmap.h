@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 
@@ -41,10 +42,8 @@ public:
     typedef typename Data::iterator iterator;
     typedef typename Data::const_iterator const_iterator;
 
-    SharedHashMap()
-    {
-        m_dataPtr = std::make_shared<Data>();
-    }
+    //! NOTE The data is allocated on the first insertion, so empty maps are cheap
+    SharedHashMap() = default;
 
     SharedHashMap(const size_t reserveSize)
     {
@@ -69,7 +68,7 @@ public:
 
     const ValType& at(const KeyType& key) const
     {
-        return m_dataPtr->at(key);
+        return data().at(key);
     }
 
     ValType& at(const KeyType& key)
@@ -104,27 +103,27 @@ public:
 
     const_iterator begin() const noexcept
     {
-        return m_dataPtr->cbegin();
+        return data().cbegin();
     }
 
     const_iterator end() const noexcept
     {
-        return m_dataPtr->cend();
+        return data().cend();
     }
 
     const_iterator cbegin() const noexcept
     {
-        return m_dataPtr->cbegin();
+        return data().cbegin();
     }
 
     const_iterator cend() const noexcept
     {
-        return m_dataPtr->cend();
+        return data().cend();
     }
 
     const_iterator find(const KeyType& key) const noexcept
     {
-        return m_dataPtr->find(key);
+        return data().find(key);
     }
 
     iterator find(const KeyType& key) noexcept
@@ -152,12 +151,12 @@ public:
 
     bool empty() const noexcept
     {
-        return m_dataPtr->empty();
+        return data().empty();
     }
 
     size_t size() const noexcept
     {
-        return m_dataPtr->size();
+        return data().size();
     }
 
     void insert(const PairType& pair)
@@ -199,8 +198,7 @@ public:
 
     void clear() noexcept
     {
-        ensureDetach();
-        m_dataPtr->clear();
+        m_dataPtr.reset();
     }
 
     void erase(const KeyType& key)
@@ -217,7 +215,7 @@ public:
 
     bool operator ==(const SharedHashMap& another) const noexcept
     {
-        return *m_dataPtr == *another.m_dataPtr;
+        return data() == another.data();
     }
 
     bool operator !=(const SharedHashMap& another) const noexcept
@@ -226,13 +224,26 @@ public:
     }
 
 private:
+    const Data& data() const noexcept
+    {
+        if (m_dataPtr) {
+            return *m_dataPtr;
+        }
+
+        static const Data empty;
+        return empty;
+    }
+
     void ensureDetach()
     {
         if (!m_dataPtr) {
+            m_dataPtr = std::make_shared<Data>();
             return;
         }
 
         if (m_dataPtr.use_count() == 1) {
+            //! NOTE The data may have been released by the owner on another thread just now
+            std::atomic_thread_fence(std::memory_order_acquire);
             return;
         }
 
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <map>
 
@@ -44,10 +45,8 @@ public:
     typedef typename Data::reverse_iterator reverse_iterator;
     typedef typename Data::const_reverse_iterator const_reverse_iterator;
 
-    SharedMap()
-    {
-        m_dataPtr = std::make_shared<Data>();
-    }
+    //! NOTE The data is allocated on the first insertion, so empty maps are cheap
+    SharedMap() = default;
 
     SharedMap(std::initializer_list<PairType> initList)
     {
@@ -67,7 +66,7 @@ public:
 
     const ValType& at(const KeyType& key) const
     {
-        return m_dataPtr->at(key);
+        return data().at(key);
     }
 
     ValType& at(const KeyType& key)
@@ -102,37 +101,37 @@ public:
 
     const_iterator begin() const noexcept
     {
-        return m_dataPtr->cbegin();
+        return data().cbegin();
     }
 
     const_iterator end() const noexcept
     {
-        return m_dataPtr->cend();
+        return data().cend();
     }
 
     const_iterator cbegin() const noexcept
     {
-        return m_dataPtr->cbegin();
+        return data().cbegin();
     }
 
     const_iterator cend() const noexcept
     {
-        return m_dataPtr->cend();
+        return data().cend();
     }
 
     const_reverse_iterator rbegin() const noexcept
     {
-        return m_dataPtr->rbegin();
+        return data().rbegin();
     }
 
     const_reverse_iterator rend() const noexcept
     {
-        return m_dataPtr->rend();
+        return data().rend();
     }
 
     const_iterator find(const KeyType& key) const noexcept
     {
-        return m_dataPtr->find(key);
+        return data().find(key);
     }
 
     iterator lower_bound(const KeyType& key)
@@ -143,7 +142,7 @@ public:
 
     const_iterator lower_bound(const KeyType& key) const
     {
-        return m_dataPtr->lower_bound(key);
+        return data().lower_bound(key);
     }
 
     iterator upper_bound(const KeyType& key)
@@ -154,7 +153,7 @@ public:
 
     const_iterator upper_bound(const KeyType& key) const
     {
-        return m_dataPtr->upper_bound(key);
+        return data().upper_bound(key);
     }
 
     bool contains(const KeyType& key) const noexcept
@@ -164,12 +163,12 @@ public:
 
     bool empty() const noexcept
     {
-        return m_dataPtr->empty();
+        return data().empty();
     }
 
     size_t size() const noexcept
     {
-        return m_dataPtr->size();
+        return data().size();
     }
 
     void insert(const PairType& pair)
@@ -205,8 +204,7 @@ public:
 
     void clear() noexcept
     {
-        ensureDetach();
-        m_dataPtr->clear();
+        m_dataPtr.reset();
     }
 
     void erase(const KeyType& key)
@@ -223,7 +221,7 @@ public:
 
     bool operator ==(const SharedMap& another) const noexcept
     {
-        return *m_dataPtr == *another.m_dataPtr;
+        return data() == another.data();
     }
 
     bool operator !=(const SharedMap& another) const noexcept
@@ -233,22 +231,35 @@ public:
 
     bool operator <(const SharedMap& another) const noexcept
     {
-        return m_dataPtr->operator <(another.m_dataPtr);
+        return data() < another.data();
     }
 
     bool operator >(const SharedMap& another) const noexcept
     {
-        return m_dataPtr->operator >(another.m_dataPtr);
+        return data() > another.data();
     }
 
 private:
+    const Data& data() const noexcept
+    {
+        if (m_dataPtr) {
+            return *m_dataPtr;
+        }
+
+        static const Data empty;
+        return empty;
+    }
+
     void ensureDetach()
     {
         if (!m_dataPtr) {
+            m_dataPtr = std::make_shared<Data>();
             return;
         }
 
         if (m_dataPtr.use_count() == 1) {
+            //! NOTE The data may have been released by the owner on another thread just now
+            std::atomic_thread_fence(std::memory_order_acquire);
             return;
         }
 
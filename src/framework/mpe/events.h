@@ -102,9 +102,9 @@ struct NoteEvent
     explicit NoteEvent(ArrangementContext&& arrangementCtx,
                        PitchContext&& pitchCtx,
                        ExpressionContext&& expressionCtx)
-        : m_arrangementCtx(arrangementCtx),
-        m_pitchCtx(pitchCtx),
-        m_expressionCtx(expressionCtx)
+        : m_arrangementCtx(std::move(arrangementCtx)),
+        m_pitchCtx(std::move(pitchCtx)),
+        m_expressionCtx(std::move(expressionCtx))
     {
     }
 
@@ -218,6 +218,8 @@ private:
         for (auto& pair : m_pitchCtx.pitchCurve) {
             pair.second = static_cast<pitch_level_t>(RealRound(static_cast<float>(pair.second) * ratio * patternUnitRatio, 0));
         }
+
+        shareEqualCurve(m_pitchCtx.pitchCurve);
     }
 
     void calculateExpressionCurve(const ArticulationMap& articulationsApplied, const float requiredVelocityFraction)
@@ -249,6 +251,8 @@ private:
         for (auto& pair : m_expressionCtx.expressionCurve) {
             pair.second = static_cast<dynamic_level_t>(RealRound(pair.second * ratio, 0));
         }
+
+        shareEqualCurve(m_expressionCtx.expressionCurve);
     }
 
     ArrangementContext m_arrangementCtx;
@@ -341,6 +345,9 @@ using DynamicLevelMap = SharedMap<timestamp_t, dynamic_level_t>;
 using DynamicLevelLayers = SharedMap<layer_idx_t, DynamicLevelMap>;
 
 using MainStreamChanges = async::Channel<PlaybackEventsMap, DynamicLevelLayers>;
+//! NOTE Only the changed timestamps of the main stream: the new events of each of them,
+//! an empty list means that the events of the timestamp were removed
+using MainStreamDelta = async::Channel<PlaybackEventsMap, DynamicLevelLayers>;
 using OffStreamChanges = async::Channel<PlaybackEventsMap, DynamicLevelLayers, bool /*flushOffstream*/>;
 
 struct PlaybackData {
@@ -349,6 +356,7 @@ struct PlaybackData {
     DynamicLevelLayers dynamics;
 
     MainStreamChanges mainStream;
+    MainStreamDelta mainStreamDelta;
     OffStreamChanges offStream;
 
     bool operator==(const PlaybackData& other) const
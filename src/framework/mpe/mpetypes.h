@@ -26,6 +26,7 @@
 #include <stdint.h>
 #include <math.h>
 #include <algorithm>
+#include <functional>
 #include <unordered_map>
 #include <unordered_set>
 #include <map>
@@ -137,6 +138,39 @@ struct ValuesCurve : public SharedMap<duration_percentage_t, T>
     }
 };
 
+//! NOTE Most notes of a score end up with one of a handful of distinct curves.
+//! Replaces the curve with an equal one met before on this thread, so that the notes share the same data
+template<typename T>
+inline void shareEqualCurve(ValuesCurve<T>& curve)
+{
+    if (curve.empty()) {
+        return;
+    }
+
+    static constexpr size_t MAX_POOL_SIZE = 4096;
+    thread_local std::unordered_multimap<size_t, ValuesCurve<T> > pool;
+
+    size_t hash = curve.size();
+    for (const auto& pair : curve) {
+        hash = hash * 31 + std::hash<duration_percentage_t>()(pair.first);
+        hash = hash * 31 + std::hash<T>()(pair.second);
+    }
+
+    auto range = pool.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == curve) {
+            curve = it->second;
+            return;
+        }
+    }
+
+    if (pool.size() >= MAX_POOL_SIZE) {
+        pool.clear();
+    }
+
+    pool.emplace(hash, curve);
+}
+
 // Pitch
 enum class PitchClass : signed char {
     Undefined = -1,
@@ -439,3 +439,56 @@ TEST_F(MPE_SingleNoteArticulationsTest, Scoop)
     //        In other words, we'll start to playback a note with pitch offset and then finally land on the note being played
     EXPECT_EQ(event.arrangementCtx().actualTimestamp, m_nominalTimestamp + m_nominalDuration * percentageToFactor(timestampOffset));
 }
+
+/**
+ * @brief MPE_SingleNoteArticulationsTest_EqualCurvesAreShared
+ * @details In this case we're gonna build two separate notes with the same accent articulation and the same loud dynamic
+ *          Their expression curves would be scaled in the same way, so we expect them to share the same data
+ */
+TEST_F(MPE_SingleNoteArticulationsTest, EqualCurvesAreShared)
+{
+    // [GIVEN] Articulation pattern "Accent"
+    ArticulationPatternSegment accentArticulation;
+    accentArticulation.arrangementPattern = createArrangementPattern(HUNDRED_PERCENT /*duration_factor*/, 0 /*timestamp_offset*/);
+    accentArticulation.pitchPattern = createSimplePitchPattern(0 /*increment_pitch_diff*/);
+    accentArticulation.expressionPattern = createSimpleExpressionPattern(dynamicLevelFromType(DynamicType::mf));
+
+    ArticulationPattern scope;
+    scope.emplace(0, accentArticulation);
+
+    auto buildNote = [this, &scope](timestamp_t timestamp) {
+        ArticulationMeta accentMeta;
+        accentMeta.type = ArticulationType::Accent;
+        accentMeta.pattern = scope;
+        accentMeta.timestamp = timestamp;
+        accentMeta.overallDuration = m_nominalDuration;
+
+        ArticulationMap appliedArticulations = {};
+        appliedArticulations.emplace(ArticulationType::Accent, ArticulationAppliedData(std::move(accentMeta), 0, HUNDRED_PERCENT));
+        appliedArticulations.preCalculateAverageData();
+
+        return NoteEvent(timestamp,
+                         m_nominalDuration,
+                         m_voiceIdx,
+                         m_staffIdx,
+                         pitchLevel(m_pitchClass, m_octave),
+                         dynamicLevelFromType(DynamicType::ff),
+                         appliedArticulations,
+                         0);
+    };
+
+    // [WHEN] Two notes with the same articulation and dynamic being built
+    NoteEvent first = buildNote(m_nominalTimestamp);
+    NoteEvent second = buildNote(m_nominalTimestamp + m_nominalDuration);
+
+    const ExpressionCurve& firstCurve = first.expressionCtx().expressionCurve;
+    const ExpressionCurve& secondCurve = second.expressionCtx().expressionCurve;
+
+    // [THEN] We expect the expression curve to be scaled from the accent pattern
+    EXPECT_NE(firstCurve, accentArticulation.expressionPattern.dynamicOffsetMap);
+
+    // [THEN] We expect both notes to point to the same curve
+    ASSERT_FALSE(firstCurve.empty());
+    EXPECT_EQ(firstCurve, secondCurve);
+    EXPECT_EQ(&*firstCurve.cbegin(), &*secondCurve.cbegin());
+}
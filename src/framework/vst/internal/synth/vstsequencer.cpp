@@ -90,6 +90,36 @@ void VstSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& events,
     updateMainSequenceIterator();
 }
 
+void VstSequencer::updateMainStreamEventsInRange(const mpe::PlaybackEventsMap& events, const msecs_t from, const msecs_t to)
+{
+    if (!m_inited) {
+        return;
+    }
+
+    if (hasSostenutoPedal()) {
+        updateMainStreamEvents(m_playbackData.originEvents, m_playbackData.dynamics);
+        return;
+    }
+
+    if (m_onMainStreamFlushed) {
+        m_onMainStreamFlushed();
+    }
+
+    Timeline timeline;
+    addPlaybackEvents(timeline, events);
+
+    if (m_useDynamicEvents) {
+        addDynamicEvents(timeline, m_playbackData.dynamics);
+    }
+
+    replaceMainStreamEvents(from, to, timeline);
+}
+
+const mpe::ArticulationTypeSet& VstSequencer::sostenutoPedalTypes() const
+{
+    return SOSTENUTO_PEDAL_CC_SUPPORTED_TYPES;
+}
+
 muse::audio::gain_t VstSequencer::currentGain() const
 {
     if (m_useDynamicEvents) {
@@ -100,7 +130,7 @@ muse::audio::gain_t VstSequencer::currentGain() const
     return 0.5f;
 }
 
-void VstSequencer::addPlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& events)
+void VstSequencer::addPlaybackEvents(Timeline& destination, const mpe::PlaybackEventsMap& events)
 {
     SostenutoTimeAndDurations sostenutoTimeAndDurations;
 
@@ -117,16 +147,16 @@ void VstSequencer::addPlaybackEvents(EventSequenceMap& destination, const mpe::P
     addSostenutoEvents(destination, sostenutoTimeAndDurations);
 }
 
-void VstSequencer::addDynamicEvents(EventSequenceMap& destination, const mpe::DynamicLevelLayers& layers)
+void VstSequencer::addDynamicEvents(Timeline& destination, const mpe::DynamicLevelLayers& layers)
 {
     for (const auto& layer : layers) {
         for (const auto& dynamic : layer.second) {
-            destination[dynamic.first].emplace(expressionLevel(dynamic.second));
+            destination.add(dynamic.first, expressionLevel(dynamic.second));
         }
     }
 }
 
-void VstSequencer::addNoteEvent(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void VstSequencer::addNoteEvent(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                 SostenutoTimeAndDurations& sostenutoTimeAndDurations)
 {
     const mpe::ArrangementContext& arrangementCtx = noteEvent.arrangementCtx();
@@ -135,12 +165,12 @@ void VstSequencer::addNoteEvent(EventSequenceMap& destination, const mpe::NoteEv
     const float tuning = noteTuning(noteEvent, noteId);
 
     if (arrangementCtx.hasStart()) {
-        destination[arrangementCtx.actualTimestamp].emplace(buildEvent(VstEvent::kNoteOnEvent, noteId, velocityFraction, tuning));
+        destination.add(arrangementCtx.actualTimestamp, buildEvent(VstEvent::kNoteOnEvent, noteId, velocityFraction, tuning));
     }
 
     if (arrangementCtx.hasEnd()) {
         const mpe::timestamp_t timestampTo = arrangementCtx.actualTimestamp + noteEvent.arrangementCtx().actualDuration;
-        destination[timestampTo].emplace(buildEvent(VstEvent::kNoteOffEvent, noteId, velocityFraction, tuning));
+        destination.add(timestampTo, buildEvent(VstEvent::kNoteOffEvent, noteId, velocityFraction, tuning));
     }
 
     for (const auto& artPair : noteEvent.expressionCtx().articulations) {
@@ -168,7 +198,7 @@ void VstSequencer::addNoteEvent(EventSequenceMap& destination, const mpe::NoteEv
     }
 }
 
-void VstSequencer::addPedalEvent(EventSequenceMap& destination, const mpe::ArticulationMeta& meta)
+void VstSequencer::addPedalEvent(Timeline& destination, const mpe::ArticulationMeta& meta)
 {
     if (meta.hasStart()) {
         addParamChange(destination, meta.timestamp, SUSTAIN_IDX, 1);
@@ -179,7 +209,7 @@ void VstSequencer::addPedalEvent(EventSequenceMap& destination, const mpe::Artic
     }
 }
 
-void VstSequencer::addControlChangeEvent(EventSequenceMap& destination, const mpe::timestamp_t timestamp,
+void VstSequencer::addControlChangeEvent(Timeline& destination, const mpe::timestamp_t timestamp,
                                          const mpe::ControllerChangeEvent& event)
 {
     switch (event.type) {
@@ -197,7 +227,7 @@ void VstSequencer::addControlChangeEvent(EventSequenceMap& destination, const mp
     }
 }
 
-void VstSequencer::addParamChange(EventSequenceMap& destination, const mpe::timestamp_t timestamp,
+void VstSequencer::addParamChange(Timeline& destination, const mpe::timestamp_t timestamp,
                                   const ControlIdx controlIdx, const PluginParamValue value)
 {
     auto controlIt = m_mapping.find(controlIdx);
@@ -205,10 +235,10 @@ void VstSequencer::addParamChange(EventSequenceMap& destination, const mpe::time
         return;
     }
 
-    destination[timestamp].emplace(ParamChangeEvent { controlIt->second, value });
+    destination.add(timestamp, ParamChangeEvent { controlIt->second, value });
 }
 
-void VstSequencer::addPitchCurve(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void VstSequencer::addPitchCurve(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                  const mpe::ArticulationMeta& artMeta)
 {
     auto pitchBendIt = m_mapping.find(PITCH_BEND_IDX);
@@ -222,7 +252,7 @@ void VstSequencer::addPitchCurve(EventSequenceMap& destination, const mpe::NoteE
     ParamChangeEvent event;
     event.paramId = pitchBendIt->second;
     event.value = 0.5f;
-    destination[pitchBendTimestampTo].insert(event);
+    destination.add(pitchBendTimestampTo, event);
 
     auto currIt = noteEvent.pitchCtx().pitchCurve.cbegin();
     auto nextIt = std::next(currIt);
@@ -255,13 +285,13 @@ void VstSequencer::addPitchCurve(EventSequenceMap& destination, const mpe::NoteE
             if (time < pitchBendTimestampTo) {
                 float bendValue = static_cast<float>(point.y);
                 event.value = bendValue;
-                destination[time].insert(event);
+                destination.add(time, event);
             }
         }
     }
 }
 
-void VstSequencer::addSostenutoEvents(EventSequenceMap& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations)
+void VstSequencer::addSostenutoEvents(Timeline& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations)
 {
     for (size_t i = 0; i < sostenutoTimeAndDurations.size(); ++i) {
         const mpe::TimestampAndDuration& currentTnD = sostenutoTimeAndDurations.at(i);
@@ -64,18 +64,20 @@ public:
 private:
     void updateOffStreamEvents(const mpe::PlaybackEventsMap& events, const mpe::DynamicLevelLayers& dynamics) override;
     void updateMainStreamEvents(const mpe::PlaybackEventsMap& events, const mpe::DynamicLevelLayers& dynamics) override;
+    void updateMainStreamEventsInRange(const mpe::PlaybackEventsMap& events, const msecs_t from, const msecs_t to) override;
+    const mpe::ArticulationTypeSet& sostenutoPedalTypes() const override;
 
     using SostenutoTimeAndDurations = std::vector<mpe::TimestampAndDuration>;
 
-    void addPlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& events);
-    void addDynamicEvents(EventSequenceMap& destination, const mpe::DynamicLevelLayers& layers);
-    void addNoteEvent(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, SostenutoTimeAndDurations& sostenutoTimeAndDurations);
-    void addPedalEvent(EventSequenceMap& destination, const mpe::ArticulationMeta& meta);
-    void addControlChangeEvent(EventSequenceMap& destination, const mpe::timestamp_t timestamp, const mpe::ControllerChangeEvent& event);
-    void addParamChange(EventSequenceMap& destination, const mpe::timestamp_t timestamp, const ControlIdx controlIdx,
+    void addPlaybackEvents(Timeline& destination, const mpe::PlaybackEventsMap& events);
+    void addDynamicEvents(Timeline& destination, const mpe::DynamicLevelLayers& layers);
+    void addNoteEvent(Timeline& destination, const mpe::NoteEvent& noteEvent, SostenutoTimeAndDurations& sostenutoTimeAndDurations);
+    void addPedalEvent(Timeline& destination, const mpe::ArticulationMeta& meta);
+    void addControlChangeEvent(Timeline& destination, const mpe::timestamp_t timestamp, const mpe::ControllerChangeEvent& event);
+    void addParamChange(Timeline& destination, const mpe::timestamp_t timestamp, const ControlIdx controlIdx,
                         const PluginParamValue value);
-    void addPitchCurve(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationMeta& artMeta);
-    void addSostenutoEvents(EventSequenceMap& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations);
+    void addPitchCurve(Timeline& destination, const mpe::NoteEvent& noteEvent, const mpe::ArticulationMeta& artMeta);
+    void addSostenutoEvents(Timeline& destination, const SostenutoTimeAndDurations& sostenutoTimeAndDurations);
 
     VstEvent buildEvent(const Steinberg::Vst::Event::EventTypes type, const int32_t noteIdx, const float velocityFraction,
                         const float tuning) const;
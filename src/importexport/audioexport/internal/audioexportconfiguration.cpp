@@ -77,5 +77,7 @@ const std::vector<int>& AudioExportConfiguration::availableSampleRates() const
 
 samples_t AudioExportConfiguration::exportBufferSize() const
 {
-    return 4096;
+    //! NOTE Offline rendering isn't bound to the device latency,
+    //! so bigger blocks are used to reduce the per block overhead (mixer task sync, events)
+    return 8192;
 }
@@ -64,6 +64,10 @@ public:
     virtual bool exportSvgWithIllustratorCompat() const = 0;
     virtual void setExportSvgWithIllustratorCompat(bool compat) = 0;
 
+    //! NOTE 0 means to pick the count automatically
+    virtual int exportThreadCount() const = 0;
+    virtual void setExportThreadCount(int count) = 0;
+
     virtual int trimMarginPixelSize() const = 0;
     virtual void setTrimMarginPixelSize(std::optional<int> pixelSize) = 0;
 };
@@ -37,6 +37,7 @@ static const Settings::Key EXPORT_PNG_USE_TRANSPARENCY_KEY("iex_imagesexport", "
 static const Settings::Key EXPORT_PNG_USE_GRAYSCALE_KEY("iex_imagesexport", "export/png/useGrayscale");
 static const Settings::Key EXPORT_SVG_USE_TRANSPARENCY_KEY("iex_imagesexport", "export/svg/useTransparency");
 static const Settings::Key EXPORT_SVG_ILLUSTRATOR_COMPAT("iex_imagesexport", "export/svg/illustratorCompat");
+static const Settings::Key EXPORT_THREAD_COUNT_KEY("iex_imagesexport", "export/threadCount");
 
 void ImagesExportConfiguration::init()
 {
@@ -44,6 +45,7 @@ void ImagesExportConfiguration::init()
     settings()->setDefaultValue(EXPORT_PDF_DPI_RESOLUTION_KEY, Val(mu::engraving::DPI));
     settings()->setDefaultValue(EXPORT_PNG_USE_TRANSPARENCY_KEY, Val(false));
     settings()->setDefaultValue(EXPORT_SVG_ILLUSTRATOR_COMPAT, Val(false));
+    settings()->setDefaultValue(EXPORT_THREAD_COUNT_KEY, Val(0));
 }
 
 int ImagesExportConfiguration::exportPdfDpiResolution() const
@@ -135,6 +137,16 @@ void ImagesExportConfiguration::setExportSvgWithIllustratorCompat(bool compat)
     settings()->setSharedValue(EXPORT_SVG_ILLUSTRATOR_COMPAT, Val(compat));
 }
 
+int ImagesExportConfiguration::exportThreadCount() const
+{
+    return settings()->value(EXPORT_THREAD_COUNT_KEY).toInt();
+}
+
+void ImagesExportConfiguration::setExportThreadCount(int count)
+{
+    settings()->setSharedValue(EXPORT_THREAD_COUNT_KEY, Val(count));
+}
+
 int ImagesExportConfiguration::trimMarginPixelSize() const
 {
     return m_trimMarginPixelSize ? m_trimMarginPixelSize.value() : -1;
@@ -54,6 +54,9 @@ public:
     bool exportSvgWithIllustratorCompat() const override;
     void setExportSvgWithIllustratorCompat(bool compat) override;
 
+    int exportThreadCount() const override;
+    void setExportThreadCount(int count) override;
+
     int trimMarginPixelSize() const override;
     void setTrimMarginPixelSize(std::optional<int> pixelSize) override;
 
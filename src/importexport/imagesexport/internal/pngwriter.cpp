@@ -22,10 +22,19 @@
 
 #include "pngwriter.h"
 
+#include <algorithm>
 #include <cmath>
 #include <QImage>
 #include <QBuffer>
 
+#include "muse_framework_config.h"
+
+#ifdef MUSE_THREADS_SUPPORT
+#include <deque>
+
+#include "concurrency/taskscheduler.h"
+#endif
+
 #include "log.h"
 
 using namespace mu::iex::imagesexport;
@@ -45,10 +54,108 @@ Ret PngWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
         return make_ret(Ret::Code::UnknownError);
     }
 
+    const int PAGE_NUMBER = muse::value(options, OptionKey::PAGE_NUMBER, Val(0)).toInt();
+    const bool TRANSPARENT_BACKGROUND = muse::value(options, OptionKey::TRANSPARENT_BACKGROUND,
+                                                    Val(configuration()->exportPngWithTransparentBackground())).toBool();
+
+    QImage image = paintPage(notation, PAGE_NUMBER, TRANSPARENT_BACKGROUND);
+    QByteArray qdata = encodeImage(image, configuration()->exportPngWithGrayscale());
+
+    if (destinationDevice.write(ByteArray::fromQByteArrayNoCopy(qdata)) != static_cast<size_t>(qdata.size())) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    return true;
+}
+
+PngWriter::~PngWriter() = default;
+
+Ret PngWriter::writePages(INotationPtr notation, size_t pageCount, const PageDeviceFactory& openPage, const Options& options)
+{
+    IF_ASSERT_FAILED(notation) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    const bool TRANSPARENT_BACKGROUND = muse::value(options, OptionKey::TRANSPARENT_BACKGROUND,
+                                                    Val(configuration()->exportPngWithTransparentBackground())).toBool();
+    const bool GRAYSCALE = configuration()->exportPngWithGrayscale();
+
+    auto writePage = [&openPage](size_t pageIndex, const QByteArray& qdata) {
+        std::unique_ptr<io::IODevice> device = openPage(pageIndex);
+        if (!device) {
+            return false;
+        }
+
+        return device->write(ByteArray::fromQByteArrayNoCopy(qdata)) == static_cast<size_t>(qdata.size());
+    };
+
+#ifdef MUSE_THREADS_SUPPORT
+    //! NOTE Only the conversion and the compression run on the pool, the pages are painted here one by one.
+    //! Painting isn't thread-safe: it switches the printing flag of the score and the pixel ratio of MScore,
+    //! and builds the display lists of the pages. See PngWriterTests.ExportBenchmark for the share of each step
+    muse::TaskScheduler* scheduler = encodingScheduler();
+    const size_t maxPendingPages = 2 * scheduler->threadPoolSize();
+
+    std::deque<std::pair<size_t, std::future<QByteArray> > > pending;
+
+    auto writeFirstPending = [&pending, &writePage]() {
+        QByteArray qdata = pending.front().second.get();
+        const size_t pageIndex = pending.front().first;
+        pending.pop_front();
+
+        return writePage(pageIndex, qdata);
+    };
+
+    for (size_t i = 0; i < pageCount; ++i) {
+        auto image = std::make_shared<QImage>(paintPage(notation, static_cast<int>(i), TRANSPARENT_BACKGROUND));
+
+        pending.emplace_back(i, scheduler->submit([image, GRAYSCALE]() {
+            return encodeImage(*image, GRAYSCALE);
+        }));
+
+        if (pending.size() > maxPendingPages && !writeFirstPending()) {
+            return make_ret(Ret::Code::UnknownError);
+        }
+    }
+
+    while (!pending.empty()) {
+        if (!writeFirstPending()) {
+            return make_ret(Ret::Code::UnknownError);
+        }
+    }
+#else
+    for (size_t i = 0; i < pageCount; ++i) {
+        QImage image = paintPage(notation, static_cast<int>(i), TRANSPARENT_BACKGROUND);
+        if (!writePage(i, encodeImage(image, GRAYSCALE))) {
+            return make_ret(Ret::Code::UnknownError);
+        }
+    }
+#endif
+
+    return true;
+}
+
+#ifdef MUSE_THREADS_SUPPORT
+muse::TaskScheduler* PngWriter::encodingScheduler()
+{
+    //! NOTE The pool is kept for the next exports, it is only recreated if the thread count setting changes
+    const int threadCount = std::max(0, configuration()->exportThreadCount());
+    if (!m_encodingScheduler || m_encodingThreadCount != threadCount) {
+        m_encodingScheduler = std::make_unique<muse::TaskScheduler>(static_cast<muse::thread_pool_size_t>(threadCount));
+        m_encodingThreadCount = threadCount;
+    }
+
+    return m_encodingScheduler.get();
+}
+
+#endif
+
+QImage PngWriter::paintPage(INotationPtr notation, int pageNumber, bool transparentBackground) const
+{
     const float CANVAS_DPI = configuration()->exportPngDpiResolution();
 
     INotationPainting::Options opt;
-    opt.fromPage = muse::value(options, OptionKey::PAGE_NUMBER, Val(0)).toInt();
+    opt.fromPage = pageNumber;
     opt.toPage = opt.fromPage;
     opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
     opt.deviceDpi = CANVAS_DPI;
@@ -63,15 +170,19 @@ Ret PngWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
     image.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / mu::engraving::INCH));
     image.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / mu::engraving::INCH));
 
-    const bool TRANSPARENT_BACKGROUND = muse::value(options, OptionKey::TRANSPARENT_BACKGROUND,
-                                                    Val(configuration()->exportPngWithTransparentBackground())).toBool();
-    image.fill(TRANSPARENT_BACKGROUND ? Qt::transparent : Qt::white);
+    image.fill(transparentBackground ? Qt::transparent : Qt::white);
 
-    muse::draw::Painter painter(&image, "pngwriter");
+    {
+        muse::draw::Painter painter(&image, "pngwriter");
+        notation->painting()->paintPng(&painter, opt);
+    }
 
-    notation->painting()->paintPng(&painter, opt);
+    return image;
+}
 
-    if (configuration()->exportPngWithGrayscale()) {
+QByteArray PngWriter::encodeImage(QImage& image, bool grayscale)
+{
+    if (grayscale) {
         convertImageToGrayscale(image);
     }
 
@@ -81,10 +192,7 @@ Ret PngWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
 
     image.save(&buf, "png");
 
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
-
-    return true;
+    return qdata;
 }
 
 void PngWriter::convertImageToGrayscale(QImage& image)
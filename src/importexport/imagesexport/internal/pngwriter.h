@@ -23,12 +23,21 @@
 #ifndef MU_IMPORTEXPORT_PNGWRITER_H
 #define MU_IMPORTEXPORT_PNGWRITER_H
 
+#include <memory>
+
+#include "muse_framework_config.h"
+
 #include "abstractimagewriter.h"
 
 #include "../iimagesexportconfiguration.h"
 #include "modularity/ioc.h"
 
 class QImage;
+class QByteArray;
+
+namespace muse {
+class TaskScheduler;
+}
 
 namespace mu::iex::imagesexport {
 class PngWriter : public AbstractImageWriter
@@ -38,12 +47,25 @@ class PngWriter : public AbstractImageWriter
 public:
     PngWriter(const muse::modularity::ContextPtr& iocCtx)
         : AbstractImageWriter(iocCtx) {}
+    ~PngWriter() override;
 
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     muse::Ret write(notation::INotationPtr notation, muse::io::IODevice& dstDevice, const Options& options = Options()) override;
+    muse::Ret writePages(notation::INotationPtr notation, size_t pageCount, const PageDeviceFactory& openPage,
+                         const Options& options = Options()) override;
 
 private:
-    void convertImageToGrayscale(QImage& image);
+    QImage paintPage(notation::INotationPtr notation, int pageNumber, bool transparentBackground) const;
+
+    static QByteArray encodeImage(QImage& image, bool grayscale);
+    static void convertImageToGrayscale(QImage& image);
+
+#ifdef MUSE_THREADS_SUPPORT
+    muse::TaskScheduler* encodingScheduler();
+
+    std::unique_ptr<muse::TaskScheduler> m_encodingScheduler;
+    int m_encodingThreadCount = 0;
+#endif
 };
 }
 
@@ -0,0 +1,66 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "testing/environment.h"
+
+#include "draw/drawmodule.h"
+#include "engraving/engravingmodule.h"
+#include "engraving/tests/utils/scorerw.h"
+
+#include "engraving/dom/instrtemplate.h"
+#include "engraving/dom/mscore.h"
+
+#include "mocks/imagesexportconfigurationmock.h"
+
+#include "log.h"
+
+using namespace mu::iex::imagesexport;
+
+static muse::testing::SuiteEnvironment importexport_se(
+{
+    new muse::draw::DrawModule(),         // needs for engraving
+    new mu::engraving::EngravingModule()
+},
+    nullptr,
+    []() {
+    LOGI() << "imagesexport tests suite post init";
+
+    mu::engraving::ScoreRW::setRootPath(muse::String::fromUtf8(iex_imagesexport_tests_DATA_ROOT));
+
+    mu::engraving::MScore::testMode = true;
+    mu::engraving::MScore::noGui = true;
+
+    mu::engraving::loadInstrumentTemplates(":/engraving/instruments/instruments.xml");
+
+    using ConfigurationMock = ::testing::NiceMock<ImagesExportConfigurationMock>;
+
+    std::shared_ptr<ConfigurationMock> configuration(new ConfigurationMock(), [](ConfigurationMock*) {}); // no delete
+    muse::modularity::globalIoc()->registerExport<IImagesExportConfiguration>("utests", configuration);
+},
+
+    []() {
+    std::shared_ptr<IImagesExportConfiguration> mock = muse::modularity::globalIoc()->resolve<IImagesExportConfiguration>("utests");
+    muse::modularity::globalIoc()->unregister<IImagesExportConfiguration>("utests");
+
+    delete mock.get();
+}
+    );
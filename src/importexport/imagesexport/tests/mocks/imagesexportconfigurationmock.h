@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <gmock/gmock.h>
+
+#include "importexport/imagesexport/iimagesexportconfiguration.h"
+
+namespace mu::iex::imagesexport {
+class ImagesExportConfigurationMock : public IImagesExportConfiguration
+{
+public:
+    MOCK_METHOD(int, exportPdfDpiResolution, (), (const, override));
+    MOCK_METHOD(void, setExportPdfDpiResolution, (int), (override));
+
+    MOCK_METHOD(bool, exportPdfWithTransparentBackground, (), (const, override));
+    MOCK_METHOD(void, setExportPdfWithTransparentBackground, (bool), (override));
+
+    MOCK_METHOD(bool, exportPdfWithGrayscale, (), (const, override));
+    MOCK_METHOD(void, setExportPdfWithGrayscale, (bool), (override));
+
+    MOCK_METHOD(float, exportPngDpiResolution, (), (const, override));
+    MOCK_METHOD(void, setExportPngDpiResolution, (float), (override));
+    MOCK_METHOD(void, setExportPngDpiResolutionOverride, (std::optional<float>), (override));
+
+    MOCK_METHOD(bool, exportPngWithTransparentBackground, (), (const, override));
+    MOCK_METHOD(void, setExportPngWithTransparentBackground, (bool), (override));
+
+    MOCK_METHOD(bool, exportPngWithGrayscale, (), (const, override));
+    MOCK_METHOD(void, setExportPngWithGrayscale, (bool), (override));
+
+    MOCK_METHOD(bool, exportSvgWithTransparentBackground, (), (const, override));
+    MOCK_METHOD(void, setExportSvgWithTransparentBackground, (bool), (override));
+    MOCK_METHOD(bool, exportSvgWithIllustratorCompat, (), (const, override));
+    MOCK_METHOD(void, setExportSvgWithIllustratorCompat, (bool), (override));
+
+    MOCK_METHOD(int, exportThreadCount, (), (const, override));
+    MOCK_METHOD(void, setExportThreadCount, (int), (override));
+
+    MOCK_METHOD(int, trimMarginPixelSize, (), (const, override));
+    MOCK_METHOD(void, setTrimMarginPixelSize, (std::optional<int>), (override));
+};
+}
@@ -0,0 +1,248 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <cstdlib>
+
+#include <QImage>
+
+#include "importexport/imagesexport/internal/pngwriter.h"
+
+#include "engraving/dom/masterscore.h"
+#include "engraving/rendering/iscorerenderer.h"
+#include "engraving/tests/utils/scorerw.h"
+
+#include "notation/tests/mocks/notationmock.h"
+#include "notation/tests/mocks/notationpaintingmock.h"
+
+#include "mocks/imagesexportconfigurationmock.h"
+
+#include "io/buffer.h"
+
+#include "log.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using namespace mu;
+using namespace mu::iex::imagesexport;
+using namespace mu::notation;
+using namespace mu::project;
+using namespace muse;
+
+static const String TEST_SCORE_PATH(u"data/test.mscx");
+
+namespace {
+//! NOTE A device, which has no room for the data
+class FullBuffer : public io::Buffer
+{
+protected:
+    bool resizeData(size_t) override { return false; }
+};
+}
+
+class Iex_PngWriterTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_configuration = std::dynamic_pointer_cast<ImagesExportConfigurationMock>(
+            modularity::globalIoc()->resolve<IImagesExportConfiguration>("utests"));
+        ASSERT_TRUE(m_configuration);
+
+        ON_CALL(*m_configuration, exportPngDpiResolution()).WillByDefault(Return(72.0f));
+        ON_CALL(*m_configuration, trimMarginPixelSize()).WillByDefault(Return(-1));
+
+        m_renderer = modularity::globalIoc()->resolve<engraving::rendering::IScoreRenderer>("utests");
+        ASSERT_TRUE(m_renderer);
+    }
+
+    void TearDown() override
+    {
+        m_notation.reset();
+        m_painting.reset();
+        delete m_score;
+        m_score = nullptr;
+    }
+
+    //! NOTE The painting paints the score the same way as NotationPainting::paintPng
+    void setScore(engraving::MasterScore* score)
+    {
+        m_score = score;
+
+        m_painting = std::make_shared<NiceMock<NotationPaintingMock> >();
+        ON_CALL(*m_painting, pageSizeInch(_))
+        .WillByDefault(Invoke([this](const INotationPainting::Options& opt) {
+            return m_renderer->pageSizeInch(m_score, opt);
+        }));
+        ON_CALL(*m_painting, paintPng(_, _))
+        .WillByDefault(Invoke([this](draw::Painter* painter, const INotationPainting::Options& opt) {
+            auto start = std::chrono::steady_clock::now();
+
+            INotationPainting::Options myopt = opt;
+            myopt.isSetViewport = true;
+            myopt.isMultiPage = false;
+            myopt.isPrinting = true;
+            m_renderer->paintScore(painter, m_score, myopt);
+
+            m_paintingMsecs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }));
+
+        m_notation = std::make_shared<NiceMock<NotationMock> >();
+        ON_CALL(*m_notation, painting())
+        .WillByDefault(Return(m_painting));
+    }
+
+    //! NOTE Writes the pages with the writer, or page by page with write() if serial is set
+    Ret writePages(std::vector<ByteArray>& pages, bool serial)
+    {
+        PngWriter writer(modularity::globalCtx());
+
+        pages.assign(m_score->npages(), ByteArray());
+
+        auto openPage = [&pages](size_t pageIndex) -> std::unique_ptr<io::IODevice> {
+            auto buffer = std::make_unique<io::Buffer>(&pages.at(pageIndex));
+            buffer->open(io::IODevice::WriteOnly);
+            return buffer;
+        };
+
+        if (serial) {
+            return writer.INotationWriter::writePages(m_notation, pages.size(), openPage);
+        }
+
+        return writer.writePages(m_notation, pages.size(), openPage);
+    }
+
+    std::shared_ptr<ImagesExportConfigurationMock> m_configuration;
+    std::shared_ptr<engraving::rendering::IScoreRenderer> m_renderer;
+
+    engraving::MasterScore* m_score = nullptr;
+    std::shared_ptr<NiceMock<NotationPaintingMock> > m_painting;
+    std::shared_ptr<NiceMock<NotationMock> > m_notation;
+
+    double m_paintingMsecs = 0.0;
+};
+
+/**
+ * @brief Iex_PngWriterTests_WritePagesMatchesWrite
+ * @details The pages written with the encoding pool are the same as the ones written one by one
+ */
+TEST_F(Iex_PngWriterTests, WritePagesMatchesWrite)
+{
+    // [GIVEN] A score
+    engraving::MasterScore* score = engraving::ScoreRW::readScore(TEST_SCORE_PATH);
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->pages().empty());
+    setScore(score);
+
+    // [WHEN] The pages are written one by one and with the encoding pool
+    std::vector<ByteArray> serialPages;
+    ASSERT_TRUE(writePages(serialPages, true));
+
+    std::vector<ByteArray> pages;
+    ASSERT_TRUE(writePages(pages, false));
+
+    // [THEN] Every page is a PNG image, the same in both cases
+    ASSERT_EQ(pages.size(), serialPages.size());
+
+    for (size_t i = 0; i < pages.size(); ++i) {
+        QImage image;
+        EXPECT_TRUE(image.loadFromData(pages.at(i).toQByteArrayNoCopy(), "png"));
+        EXPECT_FALSE(image.isNull());
+
+        EXPECT_EQ(pages.at(i), serialPages.at(i));
+    }
+}
+
+/**
+ * @brief Iex_PngWriterTests_WritePagesFailsIfDeviceIsFull
+ * @details The export fails if a page can't be written to its device
+ */
+TEST_F(Iex_PngWriterTests, WritePagesFailsIfDeviceIsFull)
+{
+    // [GIVEN] A score
+    engraving::MasterScore* score = engraving::ScoreRW::readScore(TEST_SCORE_PATH);
+    ASSERT_TRUE(score);
+    setScore(score);
+
+    // [GIVEN] The devices of the pages can't take the data
+    PngWriter writer(modularity::globalCtx());
+
+    auto openPage = [](size_t) -> std::unique_ptr<io::IODevice> {
+        auto buffer = std::make_unique<FullBuffer>();
+        buffer->open(io::IODevice::WriteOnly);
+        return buffer;
+    };
+
+    // [THEN] Both the single page and the multipage export fail
+    FullBuffer buffer;
+    buffer.open(io::IODevice::WriteOnly);
+    EXPECT_FALSE(writer.write(m_notation, buffer));
+
+    EXPECT_FALSE(writer.writePages(m_notation, score->npages(), openPage));
+}
+
+//! PNG export benchmark of a large score, e.g. of 200 pages.
+//! Disabled unless MUE_PNG_EXPORT_BENCHMARK_SCORE is set, e.g.
+//!   MUE_PNG_EXPORT_BENCHMARK_SCORE=~/scores/200_pages.mscz ./iex_imagesexport_tests --gtest_filter=*ExportBenchmark
+//! Only the conversion and the compression run on the pool, the painting of the pages stays serial,
+//! so the painting time is the lower bound of the export time
+TEST_F(Iex_PngWriterTests, ExportBenchmark)
+{
+    const char* scorePath = std::getenv("MUE_PNG_EXPORT_BENCHMARK_SCORE");
+    if (!scorePath) {
+        GTEST_SKIP() << "MUE_PNG_EXPORT_BENCHMARK_SCORE is not set";
+    }
+
+    engraving::MasterScore* score = engraving::ScoreRW::readScore(String::fromUtf8(scorePath), true);
+    ASSERT_TRUE(score);
+    setScore(score);
+
+    ON_CALL(*m_configuration, exportPngDpiResolution()).WillByDefault(Return(300.0f));
+
+    auto measure = [this](bool serial, double& paintingMsecs) {
+        std::vector<ByteArray> pages;
+
+        m_paintingMsecs = 0.0;
+        auto start = std::chrono::steady_clock::now();
+        EXPECT_TRUE(writePages(pages, serial));
+        const double msecs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        paintingMsecs = m_paintingMsecs;
+        return msecs;
+    };
+
+    double serialPaintingMsecs = 0.0;
+    const double serialMsecs = measure(true, serialPaintingMsecs);
+
+    double paintingMsecs = 0.0;
+    const double msecs = measure(false, paintingMsecs);
+
+    LOGI() << scorePath << ": pages: " << score->npages()
+           << ", page by page: " << serialMsecs << " ms (painting: " << serialPaintingMsecs << " ms)"
+           << ", encoding pool: " << msecs << " ms (painting: " << paintingMsecs << " ms)";
+}
@@ -186,6 +186,10 @@ public:
     virtual void setIsLimitCanvasScrollArea(bool limited) = 0;
     virtual muse::async::Notification isLimitCanvasScrollAreaChanged() const = 0;
 
+    virtual bool isTileCacheEnabled() const = 0;
+    virtual void setIsTileCacheEnabled(bool enabled) = 0;
+    virtual muse::async::Notification isTileCacheEnabledChanged() const = 0;
+
     virtual bool colorNotesOutsideOfUsablePitchRange() const = 0;
     virtual void setColorNotesOutsideOfUsablePitchRange(bool value) = 0;
     virtual muse::async::Channel<bool> colorNotesOutsideOfUsablePitchRangeChanged() const = 0;
@@ -89,6 +89,7 @@ static const Settings::Key TOOLBAR_KEY(module_name, "ui/toolbar/");
 
 static const Settings::Key IS_CANVAS_ORIENTATION_VERTICAL_KEY(module_name, "ui/canvas/scroll/verticalOrientation");
 static const Settings::Key IS_LIMIT_CANVAS_SCROLL_AREA_KEY(module_name, "ui/canvas/scroll/limitScrollArea");
+static const Settings::Key IS_TILE_CACHE_ENABLED_KEY(module_name, "ui/canvas/tileCache");
 
 static const Settings::Key COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE(module_name, "score/note/warnPitchRange");
 static const Settings::Key WARN_GUITAR_BENDS(module_name, "score/note/warnGuitarBends");
@@ -299,6 +300,11 @@ void NotationConfiguration::init()
         m_isLimitCanvasScrollAreaChanged.notify();
     });
 
+    settings()->setDefaultValue(IS_TILE_CACHE_ENABLED_KEY, Val(false));
+    settings()->valueChanged(IS_TILE_CACHE_ENABLED_KEY).onReceive(this, [this](const Val&) {
+        m_isTileCacheEnabledChanged.notify();
+    });
+
     settings()->setDefaultValue(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE, Val(true));
     settings()->valueChanged(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE).onReceive(this, [this](const Val& val) {
         m_colorNotesOutsideOfUsablePitchRangeChanged.send(val.toBool());
@@ -1004,6 +1010,21 @@ Notification NotationConfiguration::isLimitCanvasScrollAreaChanged() const
     return m_isLimitCanvasScrollAreaChanged;
 }
 
+bool NotationConfiguration::isTileCacheEnabled() const
+{
+    return settings()->value(IS_TILE_CACHE_ENABLED_KEY).toBool();
+}
+
+void NotationConfiguration::setIsTileCacheEnabled(bool enabled)
+{
+    settings()->setSharedValue(IS_TILE_CACHE_ENABLED_KEY, Val(enabled));
+}
+
+Notification NotationConfiguration::isTileCacheEnabledChanged() const
+{
+    return m_isTileCacheEnabledChanged;
+}
+
 bool NotationConfiguration::colorNotesOutsideOfUsablePitchRange() const
 {
     return settings()->value(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE).toBool();
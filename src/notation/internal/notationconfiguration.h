@@ -190,6 +190,10 @@ public:
     void setIsLimitCanvasScrollArea(bool limited) override;
     muse::async::Notification isLimitCanvasScrollAreaChanged() const override;
 
+    bool isTileCacheEnabled() const override;
+    void setIsTileCacheEnabled(bool enabled) override;
+    muse::async::Notification isTileCacheEnabledChanged() const override;
+
     bool colorNotesOutsideOfUsablePitchRange() const override;
     void setColorNotesOutsideOfUsablePitchRange(bool value) override;
     muse::async::Channel<bool> colorNotesOutsideOfUsablePitchRangeChanged() const override;
@@ -306,6 +310,7 @@ private:
     muse::async::Channel<muse::io::path_t> m_userMusicFontsPathChanged;
     muse::async::Notification m_scoreOrderListPathsChanged;
     muse::async::Notification m_isLimitCanvasScrollAreaChanged;
+    muse::async::Notification m_isTileCacheEnabledChanged;
     muse::async::Channel<int> m_selectionProximityChanged;
     muse::async::Channel<bool> m_colorNotesOutsideOfUsablePitchRangeChanged;
     muse::async::Channel<bool> m_warnGuitarBendsChanged;
@@ -176,6 +176,10 @@ public:
     MOCK_METHOD(void, setIsLimitCanvasScrollArea, (bool), (override));
     MOCK_METHOD(muse::async::Notification, isLimitCanvasScrollAreaChanged, (), (const, override));
 
+    MOCK_METHOD(bool, isTileCacheEnabled, (), (const, override));
+    MOCK_METHOD(void, setIsTileCacheEnabled, (bool), (override));
+    MOCK_METHOD(muse::async::Notification, isTileCacheEnabledChanged, (), (const, override));
+
     MOCK_METHOD(bool, colorNotesOutsideOfUsablePitchRange, (), (const, override));
     MOCK_METHOD(void, setColorNotesOutsideOfUsablePitchRange, (bool), (override));
     MOCK_METHOD((muse::async::Channel<bool>), colorNotesOutsideOfUsablePitchRangeChanged, (), (const, override));
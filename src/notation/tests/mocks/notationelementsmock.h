@@ -0,0 +1,42 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <gmock/gmock.h>
+
+#include "notation/inotationelements.h"
+
+namespace mu::notation {
+class NotationElementsMock : public INotationElements
+{
+public:
+    MOCK_METHOD(mu::engraving::Score*, msScore, (), (const, override));
+
+    MOCK_METHOD(EngravingItem*, search, (const std::string&), (const, override));
+    MOCK_METHOD(std::vector<EngravingItem*>, elements, (const FilterElementsOptions&), (const, override));
+
+    MOCK_METHOD(Measure*, measure, (const int), (const, override));
+
+    MOCK_METHOD(const PageList&, pages, (), (const, override));
+    MOCK_METHOD(const Page*, pageByPoint, (const muse::PointF&), (const, override));
+};
+}
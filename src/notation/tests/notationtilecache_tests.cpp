@@ -0,0 +1,460 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cmath>
+
+#include <QImage>
+#include <QPainter>
+
+#include "mocks/notationmock.h"
+#include "mocks/notationelementsmock.h"
+#include "mocks/notationpaintingmock.h"
+
+#include "engraving/tests/utils/scorerw.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/page.h"
+
+#include "notation/view/notationtilecache.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+using namespace mu;
+using namespace mu::notation;
+using namespace muse;
+using namespace muse::draw;
+
+static const String TEST_SCORE_PATH(u"data/test.mscx");
+
+static const QSize VIEW_SIZE(640, 480);
+
+namespace mu::notation {
+class NotationTileCacheTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_score = engraving::ScoreRW::readScore(TEST_SCORE_PATH);
+        ASSERT_TRUE(m_score);
+        ASSERT_FALSE(m_score->pages().empty());
+
+        m_pages = m_score->pages();
+
+        m_elements = std::make_shared<NiceMock<NotationElementsMock> >();
+        ON_CALL(*m_elements, pages())
+        .WillByDefault(ReturnRef(m_pages));
+
+        m_painting = std::make_shared<NiceMock<NotationPaintingMock> >();
+        ON_CALL(*m_painting, paintView(_, _, _))
+        .WillByDefault(Invoke([this](Painter* painter, const RectF&, bool) {
+            paintPattern(painter);
+        }));
+
+        m_notation = std::make_shared<NiceMock<NotationMock> >();
+        ON_CALL(*m_notation, elements())
+        .WillByDefault(Return(m_elements));
+        ON_CALL(*m_notation, painting())
+        .WillByDefault(Return(m_painting));
+
+        m_cache.setNotation(m_notation);
+
+        //! NOTE The first page fits into the width of the view
+        m_scale = (VIEW_SIZE.width() - 40) / m_pages.front()->ldata()->bbox().width();
+    }
+
+    void TearDown() override
+    {
+        m_cache.setNotation(nullptr);
+        delete m_score;
+    }
+
+protected:
+    using TileKey = NotationTileCache::TileKey;
+    using TileGeometry = NotationTileCache::TileGeometry;
+    using TileRange = NotationTileCache::TileRange;
+    using PageStamps = NotationTileCache::PageStamps;
+
+    //! NOTE Small rects at fractional positions inside the pages, so that any shift shows up
+    void paintPattern(Painter* painter) const
+    {
+        painter->setAntialiasing(m_antialiasing);
+        painter->setNoPen();
+
+        for (const engraving::Page* page : m_pages) {
+            const RectF pageRect = page->ldata()->bbox().translated(page->pos());
+            const double step = pageRect.width() / 37.3;
+            const RectF area = pageRect.adjusted(step, step, -step, -step);
+
+            if (m_masked) {
+                painter->save();
+                painter->setMask(pageRect, { maskRect(page) });
+            }
+
+            for (double y = area.top(); y < area.bottom(); y += step) {
+                for (double x = area.left(); x < area.right(); x += step) {
+                    painter->fillRect(RectF(x, y, step * 0.4, step * 0.3), Color::BLACK);
+                }
+            }
+
+            if (m_masked) {
+                painter->restore();
+            }
+        }
+    }
+
+    static RectF maskRect(const engraving::Page* page)
+    {
+        const RectF pageRect = page->ldata()->bbox().translated(page->pos());
+        return pageRect.adjusted(pageRect.width() * 0.3, pageRect.height() * 0.1, -pageRect.width() * 0.3, -pageRect.height() * 0.7);
+    }
+
+    static QImage makeImage(qreal devicePixelRatio)
+    {
+        QImage image(VIEW_SIZE * devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(devicePixelRatio);
+        image.fill(Qt::white);
+        return image;
+    }
+
+    QImage paintDirectly(const Transform& viewTransform, qreal devicePixelRatio) const
+    {
+        QImage image = makeImage(devicePixelRatio);
+        QPainter qp(&image);
+        {
+            Painter painter(&qp, "direct");
+            painter.setWorldTransform(viewTransform);
+            paintPattern(&painter);
+        }
+        qp.end();
+        return image;
+    }
+
+    QImage paintTiled(const Transform& viewTransform, qreal devicePixelRatio)
+    {
+        QImage image = makeImage(devicePixelRatio);
+        QPainter qp(&image);
+        EXPECT_TRUE(m_cache.paint(&qp, viewTransform, RectF(0.0, 0.0, VIEW_SIZE.width(), VIEW_SIZE.height()), devicePixelRatio));
+        qp.end();
+        return image;
+    }
+
+    static QImage tileImage(size_t bytes)
+    {
+        QImage image(NotationTileCache::TILE_SIZE, NotationTileCache::TILE_SIZE, QImage::Format_ARGB32_Premultiplied);
+        EXPECT_EQ(static_cast<size_t>(image.sizeInBytes()), bytes);
+        return image;
+    }
+
+    static TileKey makeKey(const TileGeometry& geometry) { return NotationTileCache::makeKey(geometry); }
+    static PointF tileOrigin(const Transform& viewTransform) { return NotationTileCache::tileOrigin(viewTransform); }
+    static TileRange tileRange(const PointF& origin, const RectF& viewRect) { return NotationTileCache::tileRange(origin, viewRect); }
+    static int tileSizePx(qreal devicePixelRatio) { return NotationTileCache::tileSizePx(devicePixelRatio); }
+
+    bool hasTile(const TileKey& key, const PageStamps& pages) { return m_cache.findTile(key, pages) != nullptr; }
+    void insertTile(const TileKey& key, QImage image, PageStamps pages) { m_cache.insertTile(key, std::move(image), std::move(pages)); }
+    PageStamps pagesStamps(const TileGeometry& geometry) const
+    {
+        return m_cache.pagesStamps(NotationTileCache::tileCanvasRect(geometry));
+    }
+
+    engraving::MasterScore* m_score = nullptr;
+    PageList m_pages;
+    double m_scale = 1.0;
+    bool m_antialiasing = false;
+    bool m_masked = false;
+
+    std::shared_ptr<NotationMock> m_notation;
+    std::shared_ptr<NotationElementsMock> m_elements;
+    std::shared_ptr<NotationPaintingMock> m_painting;
+
+    NotationTileCache m_cache;
+};
+}
+
+/**
+ * @brief Keys
+ * @details Checks that the same zoom gives the same tiles, and that the tiles of another zoom or pixel ratio are separate
+ */
+TEST_F(NotationTileCacheTests, Keys)
+{
+    //! [THEN] The rounding error of a zoom computed in another way doesn't matter
+    EXPECT_EQ(makeKey({ 0.1 * 3.0, 1.0, 2, 3 }), makeKey({ 0.3, 1.0, 2, 3 }));
+
+    //! [THEN] Zoom, pixel ratio, column and row are all part of the key
+    EXPECT_NE(makeKey({ 0.3, 1.0, 2, 3 }), makeKey({ 0.301, 1.0, 2, 3 }));
+    EXPECT_NE(makeKey({ 0.3, 1.0, 2, 3 }), makeKey({ 0.3, 2.0, 2, 3 }));
+    EXPECT_NE(makeKey({ 0.3, 1.0, 2, 3 }), makeKey({ 0.3, 1.0, 3, 2 }));
+    EXPECT_NE(makeKey({ 0.3, 1.0, 2, 3 }), makeKey({ 0.3, 1.0, -2, 3 }));
+}
+
+/**
+ * @brief Geometry
+ * @details Checks where the tiles are placed in the view and how many device pixels they take
+ */
+TEST_F(NotationTileCacheTests, Geometry)
+{
+    //! [THEN] The tiles are placed on whole pixels, the content shifts by half a pixel at most
+    const Transform viewTransform(m_scale, 0.0, 0.0, m_scale, 20.4, -7.6);
+    const PointF origin = tileOrigin(viewTransform);
+    EXPECT_EQ(origin, PointF(20.0, -8.0));
+    EXPECT_LE(std::abs(origin.x() - viewTransform.dx()), 0.5);
+    EXPECT_LE(std::abs(origin.y() - viewTransform.dy()), 0.5);
+
+    //! [THEN] The visible tiles are exactly the ones covering the view
+    const RectF viewRect(0.0, 0.0, 600.0, 300.0);
+    const TileRange range = tileRange(origin, viewRect);
+    EXPECT_EQ(range.firstColumn, -1);
+    EXPECT_EQ(range.lastColumn, 2);
+    EXPECT_EQ(range.firstRow, 0);
+    EXPECT_EQ(range.lastRow, 1);
+
+    const double size = NotationTileCache::TILE_SIZE;
+    EXPECT_LE(range.firstColumn * size + origin.x(), viewRect.left());
+    EXPECT_GT((range.firstColumn + 1) * size + origin.x(), viewRect.left());
+    EXPECT_GE((range.lastColumn + 1) * size + origin.x(), viewRect.right());
+    EXPECT_LT(range.lastColumn * size + origin.x(), viewRect.right());
+    EXPECT_LE(range.firstRow * size + origin.y(), viewRect.top());
+    EXPECT_GE((range.lastRow + 1) * size + origin.y(), viewRect.bottom());
+    EXPECT_LT(range.lastRow * size + origin.y(), viewRect.bottom());
+
+    //! [THEN] The tile images cover the tile size in view pixels for any pixel ratio
+    EXPECT_EQ(tileSizePx(1.0), 256);
+    EXPECT_EQ(tileSizePx(1.5), 384);
+    EXPECT_EQ(tileSizePx(2.0), 512);
+    EXPECT_EQ(tileSizePx(1.3), 333);
+
+    for (qreal devicePixelRatio : { 1.0, 1.25, 1.3, 1.5, 1.75, 2.0, 3.0 }) {
+        EXPECT_GE(tileSizePx(devicePixelRatio) / devicePixelRatio, size);
+        EXPECT_LT((tileSizePx(devicePixelRatio) - 1) / devicePixelRatio, size);
+    }
+}
+
+/**
+ * @brief LeastRecentlyUsedIsEvicted
+ * @details Checks that the memory budget evicts the tile that was used the longest time ago
+ */
+TEST_F(NotationTileCacheTests, LeastRecentlyUsedIsEvicted)
+{
+    //! [GIVEN] Budget for two tiles
+    const size_t tileBytes = NotationTileCache::TILE_SIZE * NotationTileCache::TILE_SIZE * 4;
+    m_cache.setMemoryBudget(2 * tileBytes);
+
+    const TileKey a = makeKey({ 1.0, 1.0, 0, 0 });
+    const TileKey b = makeKey({ 1.0, 1.0, 1, 0 });
+    const TileKey c = makeKey({ 1.0, 1.0, 2, 0 });
+
+    //! [WHEN] Insert two tiles, use the first one and insert a third one
+    insertTile(a, tileImage(tileBytes), {});
+    insertTile(b, tileImage(tileBytes), {});
+    EXPECT_TRUE(hasTile(a, {}));
+    insertTile(c, tileImage(tileBytes), {});
+
+    //! [THEN] The second tile is evicted
+    EXPECT_EQ(m_cache.stats().evictions, 1u);
+    EXPECT_EQ(m_cache.stats().memoryUsage, 2 * tileBytes);
+    EXPECT_FALSE(hasTile(b, {}));
+    EXPECT_TRUE(hasTile(a, {}));
+    EXPECT_TRUE(hasTile(c, {}));
+
+    //! [WHEN] Lower the budget to one tile
+    m_cache.setMemoryBudget(tileBytes);
+
+    //! [THEN] Only the last used tile is kept
+    EXPECT_EQ(m_cache.stats().evictions, 2u);
+    EXPECT_EQ(m_cache.stats().memoryUsage, tileBytes);
+    EXPECT_TRUE(hasTile(c, {}));
+    EXPECT_FALSE(hasTile(a, {}));
+}
+
+/**
+ * @brief ChangedPageInvalidatesTiles
+ * @details Checks that only the tiles over a changed page are painted again
+ */
+TEST_F(NotationTileCacheTests, ChangedPageInvalidatesTiles)
+{
+    //! [GIVEN] Tile over the first page
+    const TileGeometry geometry { m_scale, 1.0, 0, 0 };
+    const TileKey key = makeKey(geometry);
+    PageStamps pages = pagesStamps(geometry);
+    ASSERT_FALSE(pages.empty());
+
+    insertTile(key, tileImage(NotationTileCache::TILE_SIZE * NotationTileCache::TILE_SIZE * 4), pages);
+    EXPECT_TRUE(hasTile(key, pagesStamps(geometry)));
+
+    //! [WHEN] Change the page
+    m_pages.front()->touchContent();
+
+    //! [THEN] The tile is stale and dropped
+    EXPECT_FALSE(hasTile(key, pagesStamps(geometry)));
+    EXPECT_EQ(m_cache.stats().memoryUsage, 0u);
+
+    //! [GIVEN] The view painted from the tiles
+    const Transform viewTransform(m_scale, 0.0, 0.0, m_scale, 20.0, 12.0);
+    paintTiled(viewTransform, 1.0);
+    const size_t misses = m_cache.stats().misses;
+    EXPECT_GT(misses, 0u);
+
+    //! [WHEN] Paint it again
+    paintTiled(viewTransform, 1.0);
+
+    //! [THEN] Nothing is painted again
+    EXPECT_EQ(m_cache.stats().misses, misses);
+    EXPECT_EQ(m_cache.stats().hits, misses);
+
+    //! [WHEN] Change the page and paint again
+    m_pages.front()->touchContent();
+    paintTiled(viewTransform, 1.0);
+
+    //! [THEN] The tiles over the page are painted again
+    EXPECT_GT(m_cache.stats().misses, misses);
+}
+
+/**
+ * @brief TiledPaintEqualsDirectPaint
+ * @details Checks that the view painted from the tiles is the same as the view painted directly
+ */
+TEST_F(NotationTileCacheTests, TiledPaintEqualsDirectPaint)
+{
+    for (qreal devicePixelRatio : { 1.0, 2.0 }) {
+        //! [GIVEN] View scrolled by whole pixels
+        const Transform viewTransform(m_scale, 0.0, 0.0, m_scale, 20.0, -130.0);
+
+        //! [WHEN] Paint it from the tiles and directly
+        const QImage tiled = paintTiled(viewTransform, devicePixelRatio);
+        const QImage direct = paintDirectly(viewTransform, devicePixelRatio);
+
+        //! [THEN] The images are the same
+        EXPECT_TRUE(tiled == direct) << "device pixel ratio: " << devicePixelRatio;
+
+        //! [THEN] They are also the same when painted from the cached tiles
+        EXPECT_TRUE(paintTiled(viewTransform, devicePixelRatio) == direct) << "device pixel ratio: " << devicePixelRatio;
+    }
+}
+
+/**
+ * @brief TiledPaintWithGuiScaling
+ * @details Checks the view transform with the compensation of the gui scaling, as the paint view makes it
+ */
+TEST_F(NotationTileCacheTests, TiledPaintWithGuiScaling)
+{
+    //! [GIVEN] View zoomed and scrolled, on a screen with gui scaling and a high pixel ratio
+    Transform matrix;
+    matrix.translate(14.0, -22.0);
+    matrix.scale(m_scale * 0.8, m_scale * 0.8);
+
+    const double guiScaling = 1.5;
+    Transform guiScalingCompensation;
+    guiScalingCompensation.scale(guiScaling, guiScaling);
+
+    const Transform viewTransform = matrix * guiScalingCompensation;
+    ASSERT_DOUBLE_EQ(viewTransform.m11(), m_scale * 0.8 * guiScaling);
+    ASSERT_DOUBLE_EQ(viewTransform.dx(), 21.0);
+    ASSERT_DOUBLE_EQ(viewTransform.dy(), -33.0);
+
+    //! [WHEN] Paint it from the tiles and directly
+    const QImage tiled = paintTiled(viewTransform, 2.0);
+    const QImage direct = paintDirectly(viewTransform, 2.0);
+
+    //! [THEN] The images are the same
+    EXPECT_TRUE(tiled == direct);
+}
+
+/**
+ * @brief TiledPaintWithFractionalOffset
+ * @details Checks that the tiles of a view scrolled by a fraction of a pixel are placed on the nearest whole pixel
+ */
+TEST_F(NotationTileCacheTests, TiledPaintWithFractionalOffset)
+{
+    //! [GIVEN] View scrolled by fractions of a pixel
+    const Transform viewTransform(m_scale, 0.0, 0.0, m_scale, 20.4, -129.6);
+
+    //! [WHEN] Paint it from the tiles
+    const QImage tiled = paintTiled(viewTransform, 1.0);
+
+    //! [THEN] The image is the same as the view painted directly with the offset rounded
+    const Transform roundedTransform(m_scale, 0.0, 0.0, m_scale, 20.0, -130.0);
+    EXPECT_TRUE(tiled == paintDirectly(roundedTransform, 1.0));
+
+    //! [THEN] The same tiles are used as for the rounded offset
+    const size_t misses = m_cache.stats().misses;
+    paintTiled(roundedTransform, 1.0);
+    EXPECT_EQ(m_cache.stats().misses, misses);
+}
+
+/**
+ * @brief TiledPaintWithAntialiasing
+ * @details Checks that the tiles are antialiased, the same way as the view painted directly
+ */
+TEST_F(NotationTileCacheTests, TiledPaintWithAntialiasing)
+{
+    //! [GIVEN] Antialiased content
+    m_antialiasing = true;
+
+    const Transform viewTransform(m_scale, 0.0, 0.0, m_scale, 20.0, -130.0);
+
+    //! [WHEN] Paint it from the tiles and directly
+    const QImage tiled = paintTiled(viewTransform, 1.0);
+    const QImage direct = paintDirectly(viewTransform, 1.0);
+
+    //! [THEN] The edges of the rects are antialiased in the tiles
+    int partlyCovered = 0;
+    for (int y = 0; y < tiled.height(); ++y) {
+        for (int x = 0; x < tiled.width(); ++x) {
+            int gray = qGray(tiled.pixel(x, y));
+            if (gray > 0 && gray < 255) {
+                ++partlyCovered;
+            }
+        }
+    }
+    EXPECT_GT(partlyCovered, 0);
+
+    //! [THEN] The images are the same
+    EXPECT_TRUE(tiled == direct);
+}
+
+/**
+ * @brief TiledPaintWithMask
+ * @details Checks that a mask set while painting, as for bar lines and slurs, is kept in the tiles
+ */
+TEST_F(NotationTileCacheTests, TiledPaintWithMask)
+{
+    //! [GIVEN] Content masked in the middle of every page
+    m_masked = true;
+
+    const Transform viewTransform(m_scale, 0.0, 0.0, m_scale, 20.0, 12.0);
+
+    //! [WHEN] Paint it from the tiles and directly
+    const QImage tiled = paintTiled(viewTransform, 1.0);
+    const QImage direct = paintDirectly(viewTransform, 1.0);
+
+    //! [THEN] Nothing is painted inside the mask
+    const PointF maskCenter = viewTransform.map(maskRect(m_pages.front()).center());
+    EXPECT_EQ(tiled.pixel(std::lrint(maskCenter.x()), std::lrint(maskCenter.y())), qRgb(255, 255, 255));
+
+    //! [THEN] The images are the same
+    EXPECT_TRUE(tiled == direct);
+}
@@ -92,6 +92,7 @@ void AbstractNotationPaintView::load()
     m_loopOutMarker = std::make_unique<LoopMarker>(LoopBoundaryType::LoopOut, iocContext());
 
     m_continuousPanel = std::make_unique<ContinuousPanel>(iocContext());
+    m_tileCache = std::make_unique<NotationTileCache>();
 
     //! NOTE For diagnostic tools
     if (!dispatcher()->isReg(this)) {
@@ -116,6 +117,11 @@ void AbstractNotationPaintView::load()
         emit viewportChanged();
     });
 
+    configuration()->isTileCacheEnabledChanged().onNotify(this, [this]() {
+        m_tileCache->clear();
+        scheduleRedraw();
+    });
+
     scheduleRedraw();
 }
 
@@ -660,10 +666,19 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     Transform guiScalingCompensation;
     guiScalingCompensation.scale(guiScaling, guiScaling);
 
-    painter->setWorldTransform(m_matrix * guiScalingCompensation);
+    const Transform viewTransform = m_matrix * guiScalingCompensation;
 
+    //! NOTE In printing mode nothing depends on the selection or the edit state,
+    //! so the score can be reused from the tiles painted before
     bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    bool isPaintedFromTiles = isPrinting && configuration()->isTileCacheEnabled()
+                              && m_tileCache->paint(qp, viewTransform, rect, qp->device()->devicePixelRatioF());
+
+    painter->setWorldTransform(viewTransform);
+
+    if (!isPaintedFromTiles) {
+        notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    }
 
     const ui::UiContext& uiCtx = uiContextResolver()->currentUiContext();
     const bool isOnNotationPage = uiCtx == ui::UiCtxProjectOpened || uiCtx == ui::UiCtxProjectFocused;
@@ -713,14 +728,17 @@ void AbstractNotationPaintView::onNotationSetup()
     });
 
     configuration()->foregroundChanged().onNotify(this, [this]() {
+        m_tileCache->clear();
         scheduleRedraw();
     });
 
     uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
+        m_tileCache->clear();
         scheduleRedraw();
     });
 
     engravingConfiguration()->debuggingOptionsChanged().onNotify(this, [this]() {
+        m_tileCache->clear();
         scheduleRedraw();
     });
 }
@@ -1350,6 +1368,7 @@ void AbstractNotationPaintView::setNotation(INotationPtr notation)
 
     if (m_loadCalled) {
         m_continuousPanel->setNotation(m_notation);
+        m_tileCache->setNotation(m_notation);
         m_playbackCursor->setNotation(m_notation);
         m_loopInMarker->setNotation(m_notation);
         m_loopOutMarker->setNotation(m_notation);
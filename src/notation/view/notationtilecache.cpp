@@ -0,0 +1,510 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "notationtilecache.h"
+
+#include <cmath>
+
+#include <QPainter>
+#include <QPainterPath>
+
+#ifdef MUSE_THREADS_SUPPORT
+#include "async/async.h"
+#include "concurrency/taskscheduler.h"
+#endif
+
+#include "draw/painter.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
+#include "realfn.h"
+
+#include "engraving/dom/page.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::draw;
+using namespace mu::notation;
+
+//! NOTE Keys are made of rounded values, so the same zoom gives the same tiles
+static constexpr double SCALE_KEY_PRECISION = 1e6;
+static constexpr double PIXEL_RATIO_KEY_PRECISION = 1e3;
+
+//! NOTE How many tiles around the visible ones are rendered ahead of scrolling
+static constexpr int PREFETCH_MARGIN = 1;
+
+static QImage makeTileImage(int sizePx, qreal devicePixelRatio)
+{
+    QImage image(sizePx, sizePx, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(devicePixelRatio);
+    image.fill(Qt::transparent);
+    return image;
+}
+
+static void setTileClip(QPainter& painter, const std::vector<RectF>& clipRects)
+{
+    //! NOTE In printing mode the items are clipped by their page
+    QPainterPath clip;
+    clip.setFillRule(Qt::WindingFill);
+    for (const RectF& rect : clipRects) {
+        clip.addRect(rect.toQRectF());
+    }
+
+    painter.setClipPath(clip);
+}
+
+NotationTileCache::NotationTileCache()
+{
+#ifdef MUSE_THREADS_SUPPORT
+    m_scheduler = std::make_unique<TaskScheduler>();
+#endif
+}
+
+NotationTileCache::~NotationTileCache()
+{
+    clear();
+}
+
+void NotationTileCache::setNotation(INotationPtr notation)
+{
+    if (m_notation == notation) {
+        return;
+    }
+
+    clear();
+    m_notation = notation;
+}
+
+size_t NotationTileCache::memoryBudget() const
+{
+    return m_memoryBudget;
+}
+
+void NotationTileCache::setMemoryBudget(size_t bytes)
+{
+    m_memoryBudget = bytes;
+    evictTiles();
+}
+
+const NotationTileCache::Stats& NotationTileCache::stats() const
+{
+    return m_stats;
+}
+
+void NotationTileCache::clear()
+{
+    m_tiles.clear();
+    m_lru.clear();
+    m_stats.memoryUsage = 0;
+
+#ifdef MUSE_THREADS_SUPPORT
+    //! NOTE The jobs own their data, so there is no need to wait for them
+    m_pending.clear();
+#endif
+}
+
+bool NotationTileCache::paint(QPainter* painter, const Transform& viewTransform, const RectF& viewRect, qreal devicePixelRatio)
+{
+    TRACEFUNC;
+
+    if (!m_notation || !viewRect.isValid()) {
+        return false;
+    }
+
+    const double scale = viewTransform.m11();
+    if (scale <= 0.0 || !RealIsEqual(viewTransform.m22(), scale)
+        || !RealIsNull(viewTransform.m12()) || !RealIsNull(viewTransform.m21())) {
+        return false;
+    }
+
+    collectPrefetched();
+
+    const PointF origin = tileOrigin(viewTransform);
+    const TileRange range = tileRange(origin, viewRect);
+    const int sizePx = tileSizePx(devicePixelRatio);
+
+    struct VisibleTile {
+        TileGeometry geometry;
+        QImage image;
+    };
+
+    std::vector<VisibleTile> visibleTiles;
+
+#ifdef MUSE_THREADS_SUPPORT
+    std::vector<std::pair<size_t, PendingTile> > awaitedTiles;
+#endif
+
+    for (int row = range.firstRow; row <= range.lastRow; ++row) {
+        for (int column = range.firstColumn; column <= range.lastColumn; ++column) {
+            TileGeometry geometry { scale, devicePixelRatio, column, row };
+            PageStamps pages = pagesStamps(tileCanvasRect(geometry));
+            if (pages.empty()) {
+                continue;
+            }
+
+            const TileKey key = makeKey(geometry);
+            visibleTiles.push_back({ geometry, QImage() });
+            VisibleTile& visibleTile = visibleTiles.back();
+
+            if (const Tile* tile = findTile(key, pages)) {
+                ++m_stats.hits;
+                visibleTile.image = tile->image;
+                continue;
+            }
+
+#ifdef MUSE_THREADS_SUPPORT
+            auto pendingIt = m_pending.find(key);
+            if (pendingIt != m_pending.end()) {
+                PendingTile pending = std::move(pendingIt->second);
+                m_pending.erase(pendingIt);
+
+                if (pending.pages == pages) {
+                    ++m_stats.hits;
+                    awaitedTiles.emplace_back(visibleTiles.size() - 1, std::move(pending));
+                    continue;
+                }
+            }
+#endif
+
+            ++m_stats.misses;
+            TileJob job = recordTile(geometry, pages);
+
+#ifdef MUSE_THREADS_SUPPORT
+            if (!job.hasImages) {
+                PendingTile pending;
+                pending.pages = std::move(pages);
+                pending.image = m_scheduler->submit([job = std::move(job), sizePx, devicePixelRatio]() {
+                    return rasterizeTile(job, sizePx, devicePixelRatio);
+                });
+
+                awaitedTiles.emplace_back(visibleTiles.size() - 1, std::move(pending));
+                continue;
+            }
+#endif
+
+            visibleTile.image = job.hasImages ? paintTile(geometry, job, sizePx) : rasterizeTile(job, sizePx, devicePixelRatio);
+            insertTile(key, visibleTile.image, std::move(pages));
+        }
+    }
+
+#ifdef MUSE_THREADS_SUPPORT
+    for (auto& [index, pending] : awaitedTiles) {
+        VisibleTile& visibleTile = visibleTiles.at(index);
+        visibleTile.image = pending.image.get();
+        insertTile(makeKey(visibleTile.geometry), visibleTile.image, std::move(pending.pages));
+    }
+#endif
+
+    for (const VisibleTile& tile : visibleTiles) {
+        const QPointF pos(tile.geometry.column * TILE_SIZE + origin.x(), tile.geometry.row * TILE_SIZE + origin.y());
+        painter->drawImage(pos, tile.image);
+    }
+
+#ifdef MUSE_THREADS_SUPPORT
+    schedulePrefetch(scale, devicePixelRatio, range);
+#endif
+
+    return true;
+}
+
+NotationTileCache::TileKey NotationTileCache::makeKey(const TileGeometry& geometry)
+{
+    return TileKey(std::llround(geometry.scale * SCALE_KEY_PRECISION),
+                   std::llround(geometry.devicePixelRatio * PIXEL_RATIO_KEY_PRECISION),
+                   geometry.column, geometry.row);
+}
+
+RectF NotationTileCache::tileCanvasRect(const TileGeometry& geometry)
+{
+    const double size = TILE_SIZE / geometry.scale;
+    return RectF(geometry.column * size, geometry.row * size, size, size);
+}
+
+Transform NotationTileCache::tileTransform(const TileGeometry& geometry)
+{
+    return Transform(geometry.scale, 0.0, 0.0, geometry.scale,
+                     -static_cast<double>(geometry.column * TILE_SIZE), -static_cast<double>(geometry.row * TILE_SIZE));
+}
+
+PointF NotationTileCache::tileOrigin(const Transform& viewTransform)
+{
+    //! NOTE Tiles are placed on whole pixels, the content may shift by less than half a pixel
+    return PointF(std::round(viewTransform.dx()), std::round(viewTransform.dy()));
+}
+
+NotationTileCache::TileRange NotationTileCache::tileRange(const PointF& origin, const RectF& viewRect)
+{
+    TileRange range;
+    range.firstColumn = static_cast<int>(std::floor((viewRect.left() - origin.x()) / TILE_SIZE));
+    range.lastColumn = static_cast<int>(std::ceil((viewRect.right() - origin.x()) / TILE_SIZE)) - 1;
+    range.firstRow = static_cast<int>(std::floor((viewRect.top() - origin.y()) / TILE_SIZE));
+    range.lastRow = static_cast<int>(std::ceil((viewRect.bottom() - origin.y()) / TILE_SIZE)) - 1;
+    return range;
+}
+
+int NotationTileCache::tileSizePx(qreal devicePixelRatio)
+{
+    return static_cast<int>(std::ceil(TILE_SIZE * devicePixelRatio));
+}
+
+NotationTileCache::PageStamps NotationTileCache::pagesStamps(const RectF& canvasRect) const
+{
+    PageStamps stamps;
+
+    for (const mu::engraving::Page* page : m_notation->elements()->pages()) {
+        const RectF pageRect = page->ldata()->bbox().translated(page->pos());
+        if (pageRect.intersects(canvasRect)) {
+            stamps.push_back({ page, page->contentStamp(), page->pos() });
+        }
+    }
+
+    return stamps;
+}
+
+const NotationTileCache::Tile* NotationTileCache::findTile(const TileKey& key, const PageStamps& pages)
+{
+    auto it = m_tiles.find(key);
+    if (it == m_tiles.end()) {
+        return nullptr;
+    }
+
+    //! NOTE One of the pages under the tile has changed
+    if (it->second.pages != pages) {
+        m_stats.memoryUsage -= it->second.image.sizeInBytes();
+        m_lru.erase(it->second.lruIt);
+        m_tiles.erase(it);
+        return nullptr;
+    }
+
+    m_lru.splice(m_lru.begin(), m_lru, it->second.lruIt);
+    return &it->second;
+}
+
+void NotationTileCache::insertTile(const TileKey& key, QImage image, PageStamps pages)
+{
+    auto it = m_tiles.find(key);
+    if (it != m_tiles.end()) {
+        m_stats.memoryUsage -= it->second.image.sizeInBytes();
+        m_lru.erase(it->second.lruIt);
+        m_tiles.erase(it);
+    }
+
+    m_stats.memoryUsage += image.sizeInBytes();
+    m_lru.push_front(key);
+    m_tiles.emplace(key, Tile { std::move(image), std::move(pages), m_lru.begin() });
+
+    evictTiles();
+}
+
+void NotationTileCache::evictTiles()
+{
+    while (m_stats.memoryUsage > m_memoryBudget && !m_lru.empty()) {
+        auto it = m_tiles.find(m_lru.back());
+        m_lru.pop_back();
+
+        if (it != m_tiles.end()) {
+            m_stats.memoryUsage -= it->second.image.sizeInBytes();
+            m_tiles.erase(it);
+            ++m_stats.evictions;
+        }
+    }
+}
+
+NotationTileCache::TileJob NotationTileCache::recordTile(const TileGeometry& geometry, PageStamps pages)
+{
+    TRACEFUNC;
+
+    TileJob job;
+    job.pages = std::move(pages);
+
+    const RectF canvasRect = tileCanvasRect(geometry);
+    const Transform transform = tileTransform(geometry);
+
+    for (mu::engraving::Page* page : m_notation->elements()->pages()) {
+        const RectF pageRect = page->ldata()->bbox().translated(page->pos());
+        if (!pageRect.intersects(canvasRect)) {
+            continue;
+        }
+
+        job.clipRects.push_back(transform.map(pageRect));
+
+        //! NOTE Images are drawn straight on the paint device, so they can't be recorded
+        for (const mu::engraving::EngravingItem* item : page->items(canvasRect.translated(-page->pos()))) {
+            if (item->isImage()) {
+                job.hasImages = true;
+            }
+        }
+    }
+
+    if (job.hasImages) {
+        return job;
+    }
+
+    std::shared_ptr<BufferedPaintProvider> recorder = std::make_shared<BufferedPaintProvider>();
+    Painter painter(recorder, "notation_tile");
+    painter.setWorldTransform(transform);
+    m_notation->painting()->paintView(&painter, canvasRect, true);
+    painter.endDraw();
+
+    job.data = recorder->drawData();
+
+    return job;
+}
+
+QImage NotationTileCache::rasterizeTile(const TileJob& job, int sizePx, qreal devicePixelRatio)
+{
+    TRACEFUNC;
+
+    QImage image = makeTileImage(sizePx, devicePixelRatio);
+
+    QPainter qp(&image);
+    setTileClip(qp, job.clipRects);
+
+    //! NOTE The replay is antialiased only if the target painter is, the view paints with antialiasing
+    qp.setRenderHint(QPainter::Antialiasing, true);
+    qp.setRenderHint(QPainter::TextAntialiasing, true);
+
+    {
+        Painter painter(&qp, "notation_tile");
+        DrawDataPaint::paint(&painter, job.data);
+    }
+
+    qp.end();
+
+    return image;
+}
+
+QImage NotationTileCache::paintTile(const TileGeometry& geometry, const TileJob& job, int sizePx)
+{
+    TRACEFUNC;
+
+    QImage image = makeTileImage(sizePx, geometry.devicePixelRatio);
+
+    QPainter qp(&image);
+    setTileClip(qp, job.clipRects);
+
+    {
+        Painter painter(&qp, "notation_tile");
+        painter.setWorldTransform(tileTransform(geometry));
+        m_notation->painting()->paintView(&painter, tileCanvasRect(geometry), true);
+    }
+
+    qp.end();
+
+    return image;
+}
+
+#ifdef MUSE_THREADS_SUPPORT
+void NotationTileCache::collectPrefetched()
+{
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+        if (it->second.image.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++it;
+            continue;
+        }
+
+        insertTile(it->first, it->second.image.get(), std::move(it->second.pages));
+        it = m_pending.erase(it);
+    }
+}
+
+void NotationTileCache::schedulePrefetch(double scale, qreal devicePixelRatio, const TileRange& visibleRange)
+{
+    m_prefetch.scale = scale;
+    m_prefetch.devicePixelRatio = devicePixelRatio;
+    m_prefetch.visibleRange = visibleRange;
+
+    if (m_prefetch.isScheduled) {
+        return;
+    }
+
+    m_prefetch.isScheduled = true;
+    muse::async::Async::call(this, [this]() {
+        prefetchNext();
+    });
+}
+
+void NotationTileCache::prefetchNext()
+{
+    m_prefetch.isScheduled = false;
+
+    if (!m_notation || m_pending.size() >= m_scheduler->threadPoolSize()) {
+        return;
+    }
+
+    //! NOTE The items can only be read on the main thread, so the tiles are recorded here too.
+    //! That is done after the paint, one tile per event loop iteration, so that neither the paint
+    //! nor the input events wait for the surrounding tiles
+    const TileRange& visible = m_prefetch.visibleRange;
+    for (int row = visible.firstRow - PREFETCH_MARGIN; row <= visible.lastRow + PREFETCH_MARGIN; ++row) {
+        for (int column = visible.firstColumn - PREFETCH_MARGIN; column <= visible.lastColumn + PREFETCH_MARGIN; ++column) {
+            if (visible.contains(column, row)) {
+                continue;
+            }
+
+            if (prefetch(TileGeometry { m_prefetch.scale, m_prefetch.devicePixelRatio, column, row })) {
+                schedulePrefetch(m_prefetch.scale, m_prefetch.devicePixelRatio, visible);
+                return;
+            }
+        }
+    }
+}
+
+bool NotationTileCache::prefetch(const TileGeometry& geometry)
+{
+    PageStamps pages = pagesStamps(tileCanvasRect(geometry));
+    if (pages.empty()) {
+        return false;
+    }
+
+    const TileKey key = makeKey(geometry);
+    if (m_pending.find(key) != m_pending.end()) {
+        return false;
+    }
+
+    auto it = m_tiles.find(key);
+    if (it != m_tiles.end() && it->second.pages == pages) {
+        return false;
+    }
+
+    TileJob job = recordTile(geometry, pages);
+    if (job.hasImages) {
+        return false;
+    }
+
+    PendingTile pending;
+    pending.pages = std::move(pages);
+    pending.image = m_scheduler->submit([job = std::move(job), sizePx = tileSizePx(geometry.devicePixelRatio),
+                                         devicePixelRatio = geometry.devicePixelRatio]() {
+        return rasterizeTile(job, sizePx, devicePixelRatio);
+    });
+
+    m_pending.emplace(key, std::move(pending));
+
+    return true;
+}
+
+#else
+void NotationTileCache::collectPrefetched()
+{
+}
+
+#endif
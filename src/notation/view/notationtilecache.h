@@ -0,0 +1,190 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <QImage>
+
+#include "muse_framework_config.h"
+
+#ifdef MUSE_THREADS_SUPPORT
+#include <future>
+#endif
+
+#include "draw/types/geometry.h"
+#include "draw/types/transform.h"
+#include "draw/types/drawdata.h"
+#include "async/asyncable.h"
+
+#include "notation/inotation.h"
+
+class QPainter;
+
+namespace muse {
+class TaskScheduler;
+}
+
+namespace mu::notation {
+//! NOTE Keeps the notation painted in printing mode as raster tiles of the current zoom,
+//! so scrolling only blits images. Tiles are recorded on the main thread, rasterized on
+//! worker threads, and dropped when a page they show has changed.
+class NotationTileCache : public muse::async::Asyncable
+{
+public:
+    NotationTileCache();
+    ~NotationTileCache();
+
+    static constexpr int TILE_SIZE = 256; // in view pixels
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 128 * 1024 * 1024;
+
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t memoryUsage = 0; // in bytes
+
+        double hitRate() const { return hits + misses > 0 ? double(hits) / double(hits + misses) : 0.0; }
+    };
+
+    void setNotation(INotationPtr notation);
+
+    size_t memoryBudget() const;
+    void setMemoryBudget(size_t bytes);
+
+    const Stats& stats() const;
+
+    //! NOTE Paints the given rect of the view, the painter must have no transform set.
+    //! Returns false if the view transform can't be tiled (ex. rotated),
+    //! then the notation must be painted directly
+    bool paint(QPainter* painter, const muse::draw::Transform& viewTransform, const muse::RectF& viewRect, qreal devicePixelRatio);
+
+    void clear();
+
+private:
+    using TileKey = std::tuple<int64_t /*scale*/, int64_t /*devicePixelRatio*/, int /*column*/, int /*row*/>;
+
+    struct PageStamp {
+        const mu::engraving::Page* page = nullptr;
+        uint64_t stamp = 0;
+        muse::PointF pos;
+
+        bool operator==(const PageStamp& other) const
+        {
+            return page == other.page && stamp == other.stamp && pos == other.pos;
+        }
+    };
+
+    using PageStamps = std::vector<PageStamp>;
+
+    struct Tile {
+        QImage image;
+        PageStamps pages;
+        std::list<TileKey>::iterator lruIt;
+    };
+
+    struct TileJob {
+        PageStamps pages;
+        muse::draw::DrawDataPtr data;
+        std::vector<muse::RectF> clipRects;
+        bool hasImages = false;
+    };
+
+    struct TileGeometry {
+        double scale = 1.0;
+        qreal devicePixelRatio = 1.0;
+        int column = 0;
+        int row = 0;
+    };
+
+    struct TileRange {
+        int firstColumn = 0;
+        int lastColumn = -1;
+        int firstRow = 0;
+        int lastRow = -1;
+
+        bool contains(int column, int row) const
+        {
+            return column >= firstColumn && column <= lastColumn && row >= firstRow && row <= lastRow;
+        }
+    };
+
+    friend class NotationTileCacheTests;
+
+    static TileKey makeKey(const TileGeometry& geometry);
+    static muse::RectF tileCanvasRect(const TileGeometry& geometry);
+    static muse::draw::Transform tileTransform(const TileGeometry& geometry);
+
+    //! NOTE Where the tile (0, 0) is placed in the view, see paint()
+    static muse::PointF tileOrigin(const muse::draw::Transform& viewTransform);
+    static TileRange tileRange(const muse::PointF& origin, const muse::RectF& viewRect);
+    static int tileSizePx(qreal devicePixelRatio);
+
+    PageStamps pagesStamps(const muse::RectF& canvasRect) const;
+
+    const Tile* findTile(const TileKey& key, const PageStamps& pages);
+    void insertTile(const TileKey& key, QImage image, PageStamps pages);
+    void evictTiles();
+
+    TileJob recordTile(const TileGeometry& geometry, PageStamps pages);
+    static QImage rasterizeTile(const TileJob& job, int sizePx, qreal devicePixelRatio);
+    QImage paintTile(const TileGeometry& geometry, const TileJob& job, int sizePx);
+
+    void collectPrefetched();
+#ifdef MUSE_THREADS_SUPPORT
+    void schedulePrefetch(double scale, qreal devicePixelRatio, const TileRange& visibleRange);
+    void prefetchNext();
+    bool prefetch(const TileGeometry& geometry);
+#endif
+
+    INotationPtr m_notation;
+
+    std::map<TileKey, Tile> m_tiles;
+    std::list<TileKey> m_lru; // most recently used first
+
+    size_t m_memoryBudget = DEFAULT_MEMORY_BUDGET;
+    Stats m_stats;
+
+#ifdef MUSE_THREADS_SUPPORT
+    struct PendingTile {
+        PageStamps pages;
+        std::future<QImage> image;
+    };
+
+    struct Prefetch {
+        double scale = 1.0;
+        qreal devicePixelRatio = 1.0;
+        TileRange visibleRange;
+        bool isScheduled = false;
+    };
+
+    std::unique_ptr<muse::TaskScheduler> m_scheduler;
+    std::map<TileKey, PendingTile> m_pending;
+    Prefetch m_prefetch;
+#endif
+};
+}
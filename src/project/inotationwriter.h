@@ -23,7 +23,9 @@
 #ifndef MU_PROJECT_INOTATIONWRITER_H
 #define MU_PROJECT_INOTATIONWRITER_H
 
+#include <functional>
 #include <map>
+#include <memory>
 
 #include "global/types/ret.h"
 #include "global/types/val.h"
@@ -61,6 +63,32 @@ public:
     virtual muse::Ret writeList(const notation::INotationPtrList& notations, muse::io::IODevice& device,
                                 const Options& options = Options()) = 0;
 
+    //! NOTE Opens the device of a page when the page is written, returns nullptr if it can't be opened
+    using PageDeviceFactory = std::function<std::unique_ptr<muse::io::IODevice>(size_t pageIndex)>;
+
+    //! NOTE Writes the first pageCount pages of the notation, each to its own device.
+    //! Writers able to produce several pages at once may override it
+    virtual muse::Ret writePages(notation::INotationPtr notation, size_t pageCount, const PageDeviceFactory& openPage,
+                                 const Options& options = Options())
+    {
+        Options pageOptions = options;
+        for (size_t i = 0; i < pageCount; ++i) {
+            std::unique_ptr<muse::io::IODevice> device = openPage(i);
+            if (!device) {
+                return muse::make_ret(muse::Ret::Code::UnknownError);
+            }
+
+            pageOptions[OptionKey::PAGE_NUMBER] = muse::Val(static_cast<int>(i));
+
+            muse::Ret ret = write(notation, *device, pageOptions);
+            if (!ret) {
+                return ret;
+            }
+        }
+
+        return muse::make_ok();
+    }
+
     virtual muse::Progress* progress() { return nullptr; }
     virtual void abort() {}
 };
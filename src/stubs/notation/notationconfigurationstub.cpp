@@ -501,6 +501,21 @@ muse::async::Notification NotationConfigurationStub::isLimitCanvasScrollAreaChan
     return n;
 }
 
+bool NotationConfigurationStub::isTileCacheEnabled() const
+{
+    return false;
+}
+
+void NotationConfigurationStub::setIsTileCacheEnabled(bool)
+{
+}
+
+muse::async::Notification NotationConfigurationStub::isTileCacheEnabledChanged() const
+{
+    static muse::async::Notification n;
+    return n;
+}
+
 bool NotationConfigurationStub::colorNotesOutsideOfUsablePitchRange() const
 {
     return false;
@@ -172,6 +172,10 @@ public:
     void setIsLimitCanvasScrollArea(bool limited)  override;
     muse::async::Notification isLimitCanvasScrollAreaChanged() const override;
 
+    bool isTileCacheEnabled() const override;
+    void setIsTileCacheEnabled(bool enabled) override;
+    muse::async::Notification isTileCacheEnabledChanged() const override;
+
     bool colorNotesOutsideOfUsablePitchRange() const override;
     void setColorNotesOutsideOfUsablePitchRange(bool value)  override;
     muse::async::Channel<bool> colorNotesOutsideOfUsablePitchRangeChanged() const override;